@@ -106,6 +106,7 @@ tests = [
     ("IceGrid/admin", ["service", "novc100", "nomingw","nows", "noc++11"]),
     ("Glacier2/router", ["service", "novc100", "nomingw", "noc++11"]),
     ("Glacier2/attack", ["service", "novc100", "nomingw", "nomx", "noc++11"]),
+    ("Glacier2/sessions", ["service", "novc100", "nomingw", "nomx", "noc++11"]),
     ("Glacier2/override", ["service", "novc100", "nomingw", "noc++11"]),
     ("Glacier2/sessionControl", ["service", "novc100", "nomingw", "noc++11"]),
     ("Glacier2/ssl", ["service", "novalgrind", "novc100", "nomingw", "noc++11"]), # valgrind doesn't work well with openssl
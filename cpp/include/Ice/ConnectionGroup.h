@@ -0,0 +1,87 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_CONNECTION_GROUP_H
+#define ICE_CONNECTION_GROUP_H
+
+#include <IceUtil/Shared.h>
+#include <IceUtil/Mutex.h>
+#include <Ice/InstanceF.h>
+#include <Ice/ConnectionIF.h>
+#include <Ice/CommunicatorF.h>
+#include <Ice/Connection.h>
+#include <Ice/Current.h>
+
+#include <map>
+
+namespace Ice
+{
+
+//
+// A group of connections to broadcast oneway requests to, for example
+// the bidirectional connections of the clients a server pushes updates
+// to. The request is marshaled once and the same message is queued on
+// each connection of the group, the target Ice object must therefore
+// have the same identity for all the connections.
+//
+// Connections are removed from the group once they're closed or
+// closing.
+//
+// For example:
+//
+// Ice::ConnectionGroupPtr group = new Ice::ConnectionGroup(communicator);
+// group->add(current.con); // From the client's subscribe call.
+// ...
+// group->broadcast(Ice::stringToIdentity("callback"), "", "update", Ice::Normal, inEncaps);
+//
+class ICE_API ConnectionGroup :
+#ifndef ICE_CPP11_MAPPING
+    public IceUtil::Shared,
+#endif
+    private IceUtil::Mutex
+{
+public:
+
+    ConnectionGroup(const CommunicatorPtr&);
+    ~ConnectionGroup();
+
+    void add(const ConnectionPtr&);
+    void remove(const ConnectionPtr&);
+    size_t size();
+
+    //
+    // Broadcast a oneway request on each connection of the group. The
+    // in-parameters are an encapsulation, like with ice_invoke. Returns
+    // the number of connections the request was sent or queued on.
+    //
+    int broadcast(const Identity&, const std::string&, const std::string&, OperationMode,
+                  const std::pair<const Byte*, const Byte*>&, const Context& = Context());
+
+    int broadcast(const Identity& id, const std::string& facet, const std::string& operation, OperationMode mode,
+                  const std::vector<Byte>& inEncaps, const Context& context = Context())
+    {
+        std::pair<const Byte*, const Byte*> encaps(static_cast<const Byte*>(0), static_cast<const Byte*>(0));
+        if(!inEncaps.empty())
+        {
+            encaps.first = &inEncaps[0];
+            encaps.second = encaps.first + inEncaps.size();
+        }
+        return broadcast(id, facet, operation, mode, encaps, context);
+    }
+
+private:
+
+    const IceInternal::InstancePtr _instance;
+    std::map<ConnectionI*, ConnectionIPtr> _connections;
+};
+ICE_DEFINE_PTR(ConnectionGroupPtr, ConnectionGroup);
+
+}
+
+#endif
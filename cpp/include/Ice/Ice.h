@@ -37,6 +37,7 @@
 #endif
 #include <Ice/Connection.h>
 #include <Ice/ConnectionAsync.h>
+#include <Ice/ConnectionGroup.h>
 #include <Ice/Functional.h>
 #include <Ice/ImplicitContext.h>
 #include <Ice/Locator.h>
@@ -60,6 +60,7 @@ public:
     void endWriteParams();
     void writeEmptyParams();
     void writeParamEncaps(const Ice::Byte*, Ice::Int, bool);
+    void adoptReplyMessage(Ice::InputStream&, bool);
 
 #ifdef ICE_CPP11_MAPPING
     void setMarshaledResult(const Ice::MarshaledResult&);
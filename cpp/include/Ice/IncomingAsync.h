@@ -12,6 +12,7 @@
 
 #include <Ice/IncomingAsyncF.h>
 #include <Ice/Incoming.h>
+#include <Ice/AsyncResultF.h>
 
 #ifndef ICE_CPP11_MAPPING
 namespace Ice
@@ -121,6 +122,14 @@ public:
 
     virtual void ice_response(bool, const std::vector<Ice::Byte>&) = 0;
     virtual void ice_response(bool, const std::pair<const Ice::Byte*, const Ice::Byte*>&) = 0;
+
+    //
+    // Send the reply of the given twoway ice_invoke invocation. The Ice
+    // run time adopts the reply message buffer of the invocation instead
+    // of copying it, the default implementation copies the reply with
+    // the ice_response overload above.
+    //
+    virtual void ice_response(const Ice::AsyncResultPtr&);
 };
 
 }
@@ -139,6 +148,7 @@ public:
 
     virtual void ice_response(bool, const std::vector< ::Ice::Byte>&);
     virtual void ice_response(bool, const std::pair<const ::Ice::Byte*, const ::Ice::Byte*>&);
+    virtual void ice_response(const ::Ice::AsyncResultPtr&);
 };
 
 }
@@ -226,7 +226,7 @@ protected:
 
     void invokeImpl(bool);
     bool sentImpl(bool);
-    bool exceptionImpl(const Ice::Exception&);
+    virtual bool exceptionImpl(const Ice::Exception&);
     bool responseImpl(bool);
 
     virtual void runTimerTask();
@@ -254,12 +254,14 @@ public:
 
     virtual bool sent();
     virtual bool response();
+    virtual bool exception(const Ice::Exception&);
 
     virtual AsyncStatus invokeRemote(const Ice::ConnectionIPtr&, bool, bool);
     virtual AsyncStatus invokeCollocated(CollocatedRequestHandler*);
 
     void abort(const Ice::Exception&);
     void invoke(const std::string&);
+    void hedgeResponse(Ice::InputStream&);
 #ifdef ICE_CPP11_MAPPING
     void invoke(const std::string&, Ice::OperationMode, Ice::FormatType, const Ice::Context&,
                 std::function<void(Ice::OutputStream*)>);
@@ -293,6 +295,8 @@ public:
 
 protected:
 
+    virtual bool exceptionImpl(const Ice::Exception&);
+
     const Ice::EncodingVersion _encoding;
 
 #ifdef ICE_CPP11_MAPPING
@@ -300,6 +304,11 @@ protected:
 #endif
 
     bool _synchronous;
+
+    HedgeTaskPtr _hedge;
+    IceUtil::UniquePtr<Ice::InputStream> _hedgeReply; // The reply of the duplicate sent by the hedge task.
+
+    IceUtil::Time _sentTime; // Set if the endpoint health tracks the reply latency.
 };
 
 //
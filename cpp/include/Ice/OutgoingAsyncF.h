@@ -20,12 +20,14 @@ class OutgoingAsyncBase;
 class OutgoingAsync;
 class ProxyOutgoingAsyncBase;
 class CommunicatorFlushBatchAsync;
+class HedgeTask;
 
 #ifdef ICE_CPP11_MAPPING
 using OutgoingAsyncBasePtr = ::std::shared_ptr<OutgoingAsyncBase>;
 using OutgoingAsyncPtr = ::std::shared_ptr<OutgoingAsync>;
 using ProxyOutgoingAsyncBasePtr = ::std::shared_ptr<ProxyOutgoingAsyncBase>;
 using CommunicatorFlushBatchAsyncPtr = ::std::shared_ptr<CommunicatorFlushBatchAsync>;
+using HedgeTaskPtr = ::std::shared_ptr<HedgeTask>;
 #else
 ICE_API IceUtil::Shared* upCast(OutgoingAsyncBase*);
 typedef IceInternal::Handle<OutgoingAsyncBase> OutgoingAsyncBasePtr;
@@ -38,6 +40,9 @@ typedef IceInternal::Handle<ProxyOutgoingAsyncBase> ProxyOutgoingAsyncBasePtr;
 
 ICE_API IceUtil::Shared* upCast(CommunicatorFlushBatchAsync*);
 typedef IceInternal::Handle<CommunicatorFlushBatchAsync> CommunicatorFlushBatchAsyncPtr;
+
+ICE_API IceUtil::Shared* upCast(HedgeTask*);
+typedef IceInternal::Handle<HedgeTask> HedgeTaskPtr;
 #endif
 }
 
@@ -499,6 +499,15 @@ public:
     bool ice_isPreferSecure() const;
     ::std::shared_ptr<::Ice::ObjectPrx> ice_preferSecure(bool) const;
 
+    bool ice_isParallelConnect() const;
+    ::std::shared_ptr<::Ice::ObjectPrx> ice_parallelConnect(bool) const;
+
+    ::Ice::Int ice_getConnectionPoolSize() const;
+    ::std::shared_ptr<::Ice::ObjectPrx> ice_connectionPoolSize(::Ice::Int) const;
+
+    bool ice_isHedging() const;
+    ::std::shared_ptr<::Ice::ObjectPrx> ice_hedging(bool) const;
+
     ::std::shared_ptr<::Ice::RouterPrx> ice_getRouter() const;
     ::std::shared_ptr<::Ice::ObjectPrx> ice_router(const ::std::shared_ptr<::Ice::RouterPrx>&) const;
 
@@ -705,6 +714,21 @@ public:
         return ::std::dynamic_pointer_cast<Prx>(ObjectPrx::ice_preferSecure(preferSecure));
     }
 
+    ::std::shared_ptr<Prx> ice_parallelConnect(bool parallelConnect) const
+    {
+        return ::std::dynamic_pointer_cast<Prx>(ObjectPrx::ice_parallelConnect(parallelConnect));
+    }
+
+    ::std::shared_ptr<Prx> ice_connectionPoolSize(::Ice::Int size) const
+    {
+        return ::std::dynamic_pointer_cast<Prx>(ObjectPrx::ice_connectionPoolSize(size));
+    }
+
+    ::std::shared_ptr<Prx> ice_hedging(bool hedging) const
+    {
+        return ::std::dynamic_pointer_cast<Prx>(ObjectPrx::ice_hedging(hedging));
+    }
+
     ::std::shared_ptr<Prx> ice_router(const ::std::shared_ptr<::Ice::RouterPrx>& router) const
     {
         return ::std::dynamic_pointer_cast<Prx>(ObjectPrx::ice_router(router));
@@ -1283,6 +1307,15 @@ public:
     bool ice_isPreferSecure() const;
     ::Ice::ObjectPrx ice_preferSecure(bool) const;
 
+    bool ice_isParallelConnect() const;
+    ::Ice::ObjectPrx ice_parallelConnect(bool) const;
+
+    ::Ice::Int ice_getConnectionPoolSize() const;
+    ::Ice::ObjectPrx ice_connectionPoolSize(::Ice::Int) const;
+
+    bool ice_isHedging() const;
+    ::Ice::ObjectPrx ice_hedging(bool) const;
+
     ::Ice::RouterPrx ice_getRouter() const;
     ::Ice::ObjectPrx ice_router(const ::Ice::RouterPrx&) const;
 
@@ -1492,6 +1525,21 @@ public:
         return dynamic_cast<Prx*>(::IceProxy::Ice::Object::ice_preferSecure(preferSecure).get());
     }
 
+    IceInternal::ProxyHandle<Prx> ice_parallelConnect(bool parallelConnect) const
+    {
+        return dynamic_cast<Prx*>(::IceProxy::Ice::Object::ice_parallelConnect(parallelConnect).get());
+    }
+
+    IceInternal::ProxyHandle<Prx> ice_connectionPoolSize(::Ice::Int size) const
+    {
+        return dynamic_cast<Prx*>(::IceProxy::Ice::Object::ice_connectionPoolSize(size).get());
+    }
+
+    IceInternal::ProxyHandle<Prx> ice_hedging(bool hedging) const
+    {
+        return dynamic_cast<Prx*>(::IceProxy::Ice::Object::ice_hedging(hedging).get());
+    }
+
     IceInternal::ProxyHandle<Prx> ice_router(const ::Ice::RouterPrx& router) const
     {
         return dynamic_cast<Prx*>(::IceProxy::Ice::Object::ice_router(router).get());
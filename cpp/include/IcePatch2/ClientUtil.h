@@ -69,6 +69,15 @@ public:
     virtual bool patchStart(const std::string&, Ice::Long, Ice::Long, Ice::Long) = 0;
     virtual bool patchProgress(Ice::Long, Ice::Long, Ice::Long, Ice::Long) = 0;
     virtual bool patchEnd() = 0;
+
+    //
+    // This method is called at most once per second during the file
+    // patching to report the download rate in bytes per second and
+    // the estimated remaining time in seconds, or -1 if it's unknown.
+    // It should return false to interrupt the patching, true
+    // otherwise. The default implementation just returns true.
+    //
+    virtual bool patchRate(Ice::Long, Ice::Long);
 };
 typedef IceUtil::Handle<PatcherFeedback> PatcherFeedbackPtr;
 
@@ -131,6 +140,9 @@ public:
     // - IcePatch2.Thorough
     // - IcePatch2.ChunkSize
     // - IcePatch2.Remove
+    // - IcePatch2Client.ChunkWindow
+    // - IcePatch2Client.DecompressThreads
+    // - IcePatch2Client.DeltaMinSize
     //
     // See the Ice manual for more information on these properties.
     //
@@ -139,6 +151,9 @@ public:
     //
     // Create a patcher with the given parameters. These parameters
     // are equivalent to the configuration properties described above.
+    // The chunk window, the number of decompression threads and the
+    // delta patching threshold are read from the properties of the
+    // server proxy's communicator.
     //
     static PatcherPtr create(const FileServerPrx&, const PatcherFeedbackPtr&, const std::string&, bool, Ice::Int, Ice::Int);
 };
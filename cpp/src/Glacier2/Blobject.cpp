@@ -79,15 +79,36 @@ Glacier2::Blobject::updateObserver(const Glacier2::Instrumentation::SessionObser
 }
 
 void
-Glacier2::Blobject::invokeResponse(bool ok, const pair<const Byte*, const Byte*>& outParams,
-                                   const AMD_Object_ice_invokePtr& amdCB)
+Glacier2::Blobject::invokeCompleted(const AsyncResultPtr& result)
 {
-    amdCB->ice_response(ok, outParams);
+    AMD_Object_ice_invokePtr amdCB = AMD_Object_ice_invokePtr::dynamicCast(result->getCookie());
+    assert(amdCB);
+    try
+    {
+        if(result->getProxy()->ice_isTwoway())
+        {
+            //
+            // Forward the reply message as is, the encapsulation isn't
+            // copied to the dispatch reply.
+            //
+            amdCB->ice_response(result);
+        }
+        else
+        {
+            result->throwLocalException(); // Oneway requests only complete on failure.
+        }
+    }
+    catch(const Exception& ex)
+    {
+        invokeException(ex, amdCB);
+    }
 }
 
 void
-Glacier2::Blobject::invokeSent(bool, const AMD_Object_ice_invokePtr& amdCB)
+Glacier2::Blobject::invokeSent(const AsyncResultPtr& result)
 {
+    AMD_Object_ice_invokePtr amdCB = AMD_Object_ice_invokePtr::dynamicCast(result->getCookie());
+    assert(amdCB);
 #if (defined(_MSC_VER) && (_MSC_VER >= 1600))
     amdCB->ice_response(true, pair<const Byte*, const Byte*>(static_cast<const Byte*>(nullptr),
                                                              static_cast<const Byte*>(nullptr)));
@@ -339,14 +360,14 @@ Glacier2::Blobject::invoke(ObjectPrx& proxy, const AMD_Object_ice_invokePtr& amd
 
         try
         {
-            Callback_Object_ice_invokePtr amiCB;
+            Ice::CallbackPtr amiCB;
             if(proxy->ice_isTwoway())
             {
-                amiCB = newCallback_Object_ice_invoke(this, &Blobject::invokeResponse, &Blobject::invokeException);
+                amiCB = newCallback(this, &Blobject::invokeCompleted);
             }
             else
             {
-                amiCB = newCallback_Object_ice_invoke(this, &Blobject::invokeException, &Blobject::invokeSent);
+                amiCB = newCallback(this, &Blobject::invokeCompleted, &Blobject::invokeSent);
             }
 
             if(_forwardContext)
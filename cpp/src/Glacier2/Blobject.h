@@ -28,9 +28,8 @@ public:
     
     virtual void updateObserver(const Glacier2::Instrumentation::SessionObserverPtr&);
     
-    void invokeResponse(bool, const std::pair<const Ice::Byte*, const Ice::Byte*>&, 
-                        const Ice::AMD_Object_ice_invokePtr&);
-    void invokeSent(bool, const Ice::AMD_Object_ice_invokePtr&);
+    void invokeCompleted(const Ice::AsyncResultPtr&);
+    void invokeSent(const Ice::AsyncResultPtr&);
     void invokeException(const Ice::Exception&, const Ice::AMD_Object_ice_invokePtr&);
 
 protected:
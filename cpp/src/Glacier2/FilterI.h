@@ -14,7 +14,7 @@
 #include <Ice/Identity.h>
 #include <string>
 #include <vector>
-#include <list>
+#include <set>
 
 namespace Glacier2
 {
@@ -24,14 +24,6 @@ class FilterT : public P, public IceUtil::Monitor<IceUtil::Mutex>
 {
 public:
 
-    //
-    // These typedefs are a compiler workaround for GCC and iterators
-    // depending on nested templates.
-    //
-    typedef typename std::vector<T>::const_iterator const_iterator;
-    typedef typename std::vector<T>::iterator iterator;
-    typedef typename std::list<iterator>::iterator literator;
-
     FilterT(const std::vector<T>&);
 
     //
@@ -49,116 +41,53 @@ public:
     {
         IceUtil::Monitor<IceUtil::Mutex>::Lock lock(*this);
         //
-        // Empty vectors mean no filtering, so all matches will succeed.
+        // Empty sets mean no filtering, so all matches will succeed.
         //
-        if(_items.size() == 0)
+        if(_items.empty())
         {
             return true;
         }
 
-        return binary_search(_items.begin(), _items.end(), candidate);
+        return _items.find(candidate) != _items.end();
     }
 
     bool 
     empty() const
     {
         IceUtil::Monitor<IceUtil::Mutex>::Lock lock(*this);
-        return _items.size() == 0;
+        return _items.empty();
     }
         
 private:
     
-    std::vector<T> _items;
+    //
+    // The filter elements are kept in a set rather than a sorted
+    // vector so that session filter updates only insert or erase the
+    // given elements instead of rebuilding the whole filter.
+    //
+    std::set<T> _items;
 };
 
 template<class T, class P>
 FilterT<T, P>::FilterT(const std::vector<T>& accept):
-    _items(accept)
+    _items(accept.begin(), accept.end())
 {
-    sort(_items.begin(), _items.end());
-    _items.erase(unique(_items.begin(), _items.end()), _items.end());
 }
 
 template<class T, class P> void
 FilterT<T, P>::add(const std::vector<T>& additions, const Ice::Current&)
 {
-    //
-    // Sort the filter elements first, erasing duplicates. Then we can
-    // simply use the STL merge algorithm to add to our list of filters.
-    //
-    std::vector<T> newItems(additions);
-    sort(newItems.begin(), newItems.end());
-    newItems.erase(unique(newItems.begin(), newItems.end()), newItems.end());
-
     IceUtil::Monitor<IceUtil::Mutex>::Lock lock(*this);
-    std::vector<T> merged(_items.size() + newItems.size());
-    merge(newItems.begin(), newItems.end(), _items.begin(), _items.end(), merged.begin());
-    merged.erase(unique(merged.begin(), merged.end()), merged.end());
-    swap(_items, merged);
+    _items.insert(additions.begin(), additions.end());
 }
 
 template<class T, class P> void
 FilterT<T, P>::remove(const std::vector<T>& deletions, const Ice::Current&)
 {
-    //
-    // Our removal algorithm depends on the filter elements to be
-    // removed to be sorted in the same order as our current elements.
-    //
-    std::vector<T> toRemove(deletions);
-    sort(toRemove.begin(), toRemove.end());
-    toRemove.erase(unique(toRemove.begin(), toRemove.end()), toRemove.end());
-
     IceUtil::Monitor<IceUtil::Mutex>::Lock lock(*this);
-
-    //
-    // Our vectors are both sorted, so if we keep track of our first
-    // match between the current set and the set of items to be removed,
-    // we do not need to traverse the whole of the current set each
-    // time. We also use a list of deletions instead of erasing things
-    // itemwise. 
-    //
-
-    //
-    // The presence of the 'typename' is a GCC specific workaround. The
-    // iterator types apparently resolve to a 'void' in GCC type
-    // causing compiler errors.
-    // 
-    const_iterator r = toRemove.begin();
-    iterator mark = _items.begin();
-    std::list<iterator> deleteList;
-
-    while(r != toRemove.end())
-    {
-        iterator i = mark;
-        while(i != _items.end() && r != toRemove.end())
-        {
-            if(*r == *i)
-            {
-                //
-                // We want this list to be in LIFO order because we are
-                // going to erase things from the tail forward.
-                //
-                deleteList.push_front(i);
-                ++i;
-                ++r;
-                mark = i;
-            }
-            else
-            {
-                ++i;
-            }
-        }
-
-        if(r == toRemove.end())
-        {
-            break;
-        }
-        ++r;
-    }
-
-    for(literator i = deleteList.begin(); i != deleteList.end(); ++i)
+    for(typename std::vector<T>::const_iterator p = deletions.begin(); p != deletions.end(); ++p)
     {
-        _items.erase(*i);
+        _items.erase(*p);
     }
 }
 
@@ -166,7 +95,7 @@ template<class T, class P> std::vector<T>
 FilterT<T, P>::get(const Ice::Current&)
 {
     IceUtil::Monitor<IceUtil::Mutex>::Lock lock(*this);
-    return _items;
+    return std::vector<T>(_items.begin(), _items.end());
 }
 
 typedef FilterT<Ice::Identity, Glacier2::IdentitySet> IdentitySetI;
@@ -15,6 +15,17 @@
 using namespace std;
 using namespace Ice;
 
+namespace
+{
+
+//
+// The maximum number of endpoint sequences for which the address rules
+// verdict is cached.
+//
+const size_t verdictCacheMaxSize = 1024;
+
+}
+
 //
 // TODO: Some of the address matching helper classes can probably be
 // refactored out. It's a question of whether to keep really simple
@@ -865,7 +876,8 @@ private:
 
 Glacier2::ProxyVerifier::ProxyVerifier(const CommunicatorPtr& communicator):
     _communicator(communicator),
-    _traceLevel(communicator->getProperties()->getPropertyAsInt("Glacier2.Client.Trace.Reject"))
+    _traceLevel(communicator->getProperties()->getPropertyAsInt("Glacier2.Client.Trace.Reject")),
+    _proxySizeRule(0)
 {
     //
     // Evaluation order is dependant on how the rules are stored to the
@@ -906,7 +918,7 @@ Glacier2::ProxyVerifier::ProxyVerifier(const CommunicatorPtr& communicator):
     {
         try
         {
-            _rejectRules.push_back(new ProxyLengthRule(communicator, s, _traceLevel));
+            _proxySizeRule = new ProxyLengthRule(communicator, s, _traceLevel);
 
         }
         catch(const string& msg)
@@ -927,7 +939,8 @@ Glacier2::ProxyVerifier::~ProxyVerifier()
     for(vector<ProxyRule*>::const_iterator j = _rejectRules.begin(); j != _rejectRules.end(); ++j)
     {
         delete (*j);
-   }
+    }
+    delete _proxySizeRule;
 }
 
 bool
@@ -936,34 +949,17 @@ Glacier2::ProxyVerifier::verify(const ObjectPrx& proxy)
     //
     // No rules have been defined so we accept all.
     //
-    if(_acceptRules.size() == 0 && _rejectRules.size() == 0)
+    if(_acceptRules.size() == 0 && _rejectRules.size() == 0 && !_proxySizeRule)
     {
         return true;
     }
 
-    bool result = false;
-
-    if(_rejectRules.size() == 0)
-    {
-        //
-        // If there are no reject rules, we assume "reject all".
-        //
-        result = match(_acceptRules, proxy);
-    }
-    else if(_acceptRules.size() == 0)
-    {
-        //
-        // If no accept rules are defined we assume accept all.
-        //
-        result = !match(_rejectRules, proxy);
-    }
-    else
-    {
-        if(match(_acceptRules, proxy))
-        {
-            result = !match(_rejectRules, proxy);
-        }
-    }
+    //
+    // If no accept rules are defined we assume accept all and if there
+    // are no reject rules, we assume "reject all" for proxies which
+    // don't match an accept rule.
+    //
+    bool result = verifyAddress(proxy) && (!_proxySizeRule || !_proxySizeRule->check(proxy));
 
     //
     // The proxy rules take care of the tracing for higher trace levels.
@@ -982,3 +978,41 @@ Glacier2::ProxyVerifier::verify(const ObjectPrx& proxy)
     }
     return result;
 }
+
+bool
+Glacier2::ProxyVerifier::verifyAddress(const ObjectPrx& proxy)
+{
+    if(_acceptRules.size() == 0 && _rejectRules.size() == 0)
+    {
+        return true;
+    }
+
+    //
+    // The cache is bypassed with trace level 3 or higher to let the
+    // rules trace their evaluation.
+    //
+    EndpointSeq endpoints;
+    if(_traceLevel < 3)
+    {
+        endpoints = proxy->ice_getEndpoints();
+        IceUtil::Mutex::Lock sync(_verdictCacheMutex);
+        map<EndpointSeq, bool>::const_iterator p = _verdictCache.find(endpoints);
+        if(p != _verdictCache.end())
+        {
+            return p->second;
+        }
+    }
+
+    bool result = (_acceptRules.size() == 0 || match(_acceptRules, proxy)) && !match(_rejectRules, proxy);
+
+    if(_traceLevel < 3)
+    {
+        IceUtil::Mutex::Lock sync(_verdictCacheMutex);
+        if(_verdictCache.size() >= verdictCacheMaxSize)
+        {
+            _verdictCache.clear();
+        }
+        _verdictCache.insert(make_pair(endpoints, result));
+    }
+    return result;
+}
@@ -11,6 +11,8 @@
 #define ICE_PROXY_VERIFIER_H
 
 #include <Ice/Ice.h>
+#include <IceUtil/Mutex.h>
+#include <map>
 #include <vector>
 
 namespace Glacier2
@@ -47,11 +49,22 @@ public:
 
 private:
 
+    bool verifyAddress(const Ice::ObjectPrx&);
+
     const Ice::CommunicatorPtr _communicator;
     const int _traceLevel;
 
     std::vector<ProxyRule*> _acceptRules;
     std::vector<ProxyRule*> _rejectRules;
+    ProxyRule* _proxySizeRule;
+
+    //
+    // The address rules only depend on the proxy endpoints, their
+    // verdict is cached by endpoints since most proxies added by a
+    // session share the same endpoints.
+    //
+    IceUtil::Mutex _verdictCacheMutex;
+    std::map<Ice::EndpointSeq, bool> _verdictCache;
 };
 typedef IceUtil::Handle<ProxyVerifier> ProxyVerifierPtr;
 
@@ -47,7 +47,7 @@ Glacier2::Request::addBatchProxy(set<Ice::ObjectPrx>& batchProxies)
 }
 
 Ice::AsyncResultPtr
-Glacier2::Request::invoke(const Callback_Object_ice_invokePtr& cb)
+Glacier2::Request::invoke(const Ice::CallbackPtr& cb)
 {
     pair<const Byte*, const Byte*> inPair;
     if(_inParams.size() == 0)
@@ -156,10 +156,20 @@ Glacier2::Request::override(const RequestPtr& other) const
 }
 
 void
-Glacier2::Request::response(bool ok, const pair<const Ice::Byte*, const Ice::Byte*>& outParams)
+Glacier2::Request::response(const Ice::AsyncResultPtr& result)
 {
-    assert(_proxy->ice_isTwoway());
-    _amdCB->ice_response(ok, outParams);
+    if(_proxy->ice_isTwoway())
+    {
+        //
+        // Forward the reply message as is, the encapsulation isn't
+        // copied to the dispatch reply.
+        //
+        _amdCB->ice_response(result);
+    }
+    else
+    {
+        result->throwLocalException(); // Oneway requests only complete on failure.
+    }
 }
 
 void
@@ -195,8 +205,7 @@ Glacier2::RequestQueue::RequestQueue(const RequestQueueThreadPtr& requestQueueTh
     _requestQueueThread(requestQueueThread),
     _instance(instance),
     _connection(connection),
-    _callback(newCallback_Object_ice_invoke(this, &RequestQueue::response, &RequestQueue::exception,
-                                            &RequestQueue::sent)),
+    _callback(newCallback(this, &RequestQueue::invokeCompleted, &RequestQueue::invokeSent)),
     _flushCallback(newCallback_Connection_flushBatchRequests(this, &RequestQueue::exception, &RequestQueue::sent)),
     _pendingSend(false),
     _destroyed(false)
@@ -393,15 +402,29 @@ Glacier2::RequestQueue::destroyInternal()
     //
     // Remove cyclic references.
     //
-    const_cast<Ice::Callback_Object_ice_invokePtr&>(_callback) = 0;
+    const_cast<Ice::CallbackPtr&>(_callback) = 0;
     const_cast<Ice::Callback_Connection_flushBatchRequestsPtr&>(_flushCallback) = 0;
 }
 
 void
-Glacier2::RequestQueue::response(bool ok, const pair<const Byte*, const Byte*>& outParams, const RequestPtr& request)
+Glacier2::RequestQueue::invokeCompleted(const Ice::AsyncResultPtr& result)
 {
+    RequestPtr request = RequestPtr::dynamicCast(result->getCookie());
     assert(request);
-    request->response(ok, outParams);
+    try
+    {
+        request->response(result);
+    }
+    catch(const Ice::Exception& ex)
+    {
+        exception(ex, request);
+    }
+}
+
+void
+Glacier2::RequestQueue::invokeSent(const Ice::AsyncResultPtr& result)
+{
+    sent(result->sentSynchronously(), RequestPtr::dynamicCast(result->getCookie()));
 }
 
 void
@@ -37,7 +37,7 @@ public:
     Request(const Ice::ObjectPrx&, const std::pair<const Ice::Byte*, const Ice::Byte*>&, const Ice::Current&, bool,
             const Ice::Context&, const Ice::AMD_Object_ice_invokePtr&);
 
-    Ice::AsyncResultPtr invoke(const Ice::Callback_Object_ice_invokePtr& callback);
+    Ice::AsyncResultPtr invoke(const Ice::CallbackPtr& callback);
     bool override(const RequestPtr&) const;
     void addBatchProxy(std::set<Ice::ObjectPrx>&);
     bool hasOverride() const { return !_override.empty(); }
@@ -45,7 +45,7 @@ public:
 private:
 
     friend class RequestQueue;
-    void response(bool, const std::pair<const Ice::Byte*, const Ice::Byte*>&);
+    void response(const Ice::AsyncResultPtr&);
     void exception(const Ice::Exception&);
     void queued();
 
@@ -77,14 +77,15 @@ private:
 
     void flush();
 
-    void response(bool, const std::pair<const Ice::Byte*, const Ice::Byte*>&, const RequestPtr&);
+    void invokeCompleted(const Ice::AsyncResultPtr&);
+    void invokeSent(const Ice::AsyncResultPtr&);
     void exception(const Ice::Exception&, const RequestPtr&);
     void sent(bool, const RequestPtr&);
 
     const RequestQueueThreadPtr _requestQueueThread;
     const InstancePtr _instance;
     const Ice::ConnectionPtr _connection;
-    const Ice::Callback_Object_ice_invokePtr _callback;
+    const Ice::CallbackPtr _callback;
     const Ice::Callback_Connection_flushBatchRequestsPtr _flushCallback;
 
     std::deque<RequestPtr> _requests;
@@ -227,14 +227,14 @@ Glacier2::RouterI::getSession() const
 IceUtil::Time
 Glacier2::RouterI::getTimestamp() const
 {
-    // Can only be called with the SessionRouterI mutex locked
+    IceUtil::Mutex::Lock lock(_timestampMutex);
     return _timestamp;
 }
 
 void
 Glacier2::RouterI::updateTimestamp() const
 {
-    // Can only be called with the SessionRouterI mutex locked
+    IceUtil::Mutex::Lock lock(_timestampMutex);
     _timestamp = IceUtil::Time::now(IceUtil::Time::Monotonic);
 }
 
@@ -18,7 +18,8 @@ Glacier2::RoutingTable::RoutingTable(const CommunicatorPtr& communicator, const
     _communicator(communicator),
     _traceLevel(_communicator->getProperties()->getPropertyAsInt("Glacier2.Trace.RoutingTable")),
     _maxSize(_communicator->getProperties()->getPropertyAsIntWithDefault("Glacier2.RoutingTable.MaxSize", 1000)),
-    _verifier(verifier)
+    _verifier(verifier),
+    _hand(0)
 {
 }
 
@@ -46,16 +47,14 @@ Glacier2::RoutingTable::updateObserver(const Glacier2::Instrumentation::RouterOb
 ObjectProxySeq
 Glacier2::RoutingTable::add(const ObjectProxySeq& unfiltered, const Current& current)
 {
-    IceUtil::Mutex::Lock sync(*this);
-
-    size_t sz = _map.size();
-
     //
     // We 'pre-scan' the list, applying our validation rules. The
     // ensures that our state is not modified if this operation results
-    // in a rejection.
+    // in a rejection. This doesn't require the routing table lock, the
+    // whole batch is then added with a single lock acquisition.
     //
     ObjectProxySeq proxies; 
+    proxies.reserve(unfiltered.size());
     for(ObjectProxySeq::const_iterator prx = unfiltered.begin(); prx != unfiltered.end(); ++prx)
     {
         if(!*prx) // We ignore null proxies.
@@ -72,55 +71,80 @@ Glacier2::RoutingTable::add(const ObjectProxySeq& unfiltered, const Current& cur
         proxies.push_back(proxy);
     }
 
+    IceUtil::Mutex::Lock sync(*this);
+
+    size_t sz = _map.size();
+
     ObjectProxySeq evictedProxies;
     for(ObjectProxySeq::const_iterator prx = proxies.begin(); prx != proxies.end(); ++prx)
     {
-        ObjectPrx proxy = *prx;
-        EvictorMap::iterator p = _map.find(proxy->ice_getIdentity());
+        const ObjectPrx& proxy = *prx;
+        SlotMap::iterator p = _map.find(proxy->ice_getIdentity());
         
-        if(p == _map.end())
+        if(p != _map.end())
         {
             if(_traceLevel == 1 || _traceLevel >= 3)
             {
                 Trace out(_communicator->getLogger(), "Glacier2");
-                out << "adding proxy to routing table:\n" << _communicator->proxyToString(proxy);
+                out << "proxy already in routing table:\n" << _communicator->proxyToString(proxy);
             }
             
-            EvictorEntryPtr entry = new EvictorEntry;
-            p = _map.insert(_map.begin(), pair<const Identity, EvictorEntryPtr>(proxy->ice_getIdentity(), entry));
-            EvictorQueue::iterator q = _queue.insert(_queue.end(), p);
-            entry->proxy = proxy;
-            entry->pos = q;
+            _slots[p->second].referenced = true;
+            continue;
         }
-        else
+
+        if(_traceLevel == 1 || _traceLevel >= 3)
         {
-            if(_traceLevel == 1 || _traceLevel >= 3)
-            {
-                Trace out(_communicator->getLogger(), "Glacier2");
-                out << "proxy already in routing table:\n" << _communicator->proxyToString(proxy);
-            }
-            
-            EvictorEntryPtr entry = p->second;
-            _queue.erase(entry->pos);
-            EvictorQueue::iterator q = _queue.insert(_queue.end(), p);
-            entry->pos = q;
+            Trace out(_communicator->getLogger(), "Glacier2");
+            out << "adding proxy to routing table:\n" << _communicator->proxyToString(proxy);
         }
-        
-        while(static_cast<int>(_map.size()) > _maxSize)
+
+        if(_maxSize <= 0)
         {
-            p = _queue.front();
-            
             if(_traceLevel >= 2)
             {
                 Trace out(_communicator->getLogger(), "Glacier2");
-                out << "evicting proxy from routing table:\n" << _communicator->proxyToString(p->second->proxy);
+                out << "evicting proxy from routing table:\n" << _communicator->proxyToString(proxy);
             }
-            
-            evictedProxies.push_back(p->second->proxy);
+            evictedProxies.push_back(proxy);
+            continue;
+        }
+
+        Slot slot;
+        slot.proxy = proxy;
+        slot.referenced = true;
+
+        if(_slots.size() < static_cast<size_t>(_maxSize))
+        {
+            _map.insert(p, pair<const Identity, size_t>(proxy->ice_getIdentity(), _slots.size()));
+            _slots.push_back(slot);
+            continue;
+        }
 
-            _map.erase(p);
-            _queue.pop_front();
+        //
+        // The table is full, advance the clock hand to the first
+        // unreferenced slot, giving a second chance to the referenced
+        // slots on the way. This terminates after at most one full
+        // revolution.
+        //
+        while(_slots[_hand].referenced)
+        {
+            _slots[_hand].referenced = false;
+            _hand = (_hand + 1) % _slots.size();
+        }
+
+        Slot& victim = _slots[_hand];
+        if(_traceLevel >= 2)
+        {
+            Trace out(_communicator->getLogger(), "Glacier2");
+            out << "evicting proxy from routing table:\n" << _communicator->proxyToString(victim.proxy);
         }
+        evictedProxies.push_back(victim.proxy);
+        _map.erase(victim.proxy->ice_getIdentity());
+
+        _map.insert(pair<const Identity, size_t>(proxy->ice_getIdentity(), _hand));
+        victim = slot;
+        _hand = (_hand + 1) % _slots.size();
     }
 
     if(_observer)
@@ -141,19 +165,13 @@ Glacier2::RoutingTable::get(const Identity& ident)
 
     IceUtil::Mutex::Lock sync(*this);
 
-    EvictorMap::iterator p = _map.find(ident);
-
+    SlotMap::const_iterator p = _map.find(ident);
     if(p == _map.end())
     {
         return 0;
     }
-    else
-    {
-        EvictorEntryPtr entry = p->second;
-        _queue.erase(entry->pos);
-        EvictorQueue::iterator q = _queue.insert(_queue.end(), p);
-        entry->pos = q;
 
-        return entry->proxy;
-    }
+    Slot& slot = _slots[p->second];
+    slot.referenced = true;
+    return slot.proxy;
 }
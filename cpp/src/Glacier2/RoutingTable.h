@@ -17,7 +17,8 @@
 #include <Glacier2/ProxyVerifier.h>
 #include <Glacier2/Instrumentation.h>
 
-#include <list>
+#include <map>
+#include <vector>
 
 namespace Glacier2
 {
@@ -47,21 +48,24 @@ private:
     const int _maxSize;
     const ProxyVerifierPtr _verifier; 
 
-    struct EvictorEntry;
-    typedef IceUtil::Handle<EvictorEntry> EvictorEntryPtr;
-
-    typedef std::map<Ice::Identity, EvictorEntryPtr> EvictorMap;
-    typedef std::list<EvictorMap::iterator> EvictorQueue;
-
-    friend struct EvictorEntry;
-    struct EvictorEntry : public IceUtil::Shared
+    //
+    // The routing table entries are kept in a circular array of slots
+    // and evicted with the CLOCK algorithm: lookups only set the
+    // referenced flag of the slot instead of moving the entry to the
+    // end of an LRU queue. When the table is full, the clock hand
+    // clears the referenced flags until it finds an unreferenced slot
+    // and replaces its entry.
+    //
+    struct Slot
     {
         Ice::ObjectPrx proxy;
-        EvictorQueue::iterator pos;
+        bool referenced;
     };
+    typedef std::map<Ice::Identity, size_t> SlotMap;
 
-    EvictorMap _map;
-    EvictorQueue _queue;
+    SlotMap _map;
+    std::vector<Slot> _slots;
+    size_t _hand;
 
     IceInternal::ObserverHelperT<Glacier2::Instrumentation::SessionObserver> _observer;
 };
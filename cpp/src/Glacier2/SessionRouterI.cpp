@@ -671,8 +671,6 @@ SessionRouterI::SessionRouterI(const InstancePtr& instance,
     _closeCallback(new CloseCallbackI(this)),
     _heartbeatCallback(new HeartbeatCallbackI(this)),
     _sessionThread(_sessionTimeout > IceUtil::Time() ? new SessionThread(this, _sessionTimeout) : 0),
-    _routersByConnectionHint(_routersByConnection.end()),
-    _routersByCategoryHint(_routersByCategory.end()),
     _sessionDestroyCallback(newCallback_Session_destroy(this, &SessionRouterI::sessionDestroyException)),
     _destroy(false)
 {
@@ -733,7 +731,7 @@ SessionRouterI::~SessionRouterI()
 void
 SessionRouterI::destroy()
 {
-    map<ConnectionPtr, RouterIPtr> routers;
+    vector<pair<ConnectionPtr, RouterIPtr> > routers;
     SessionThreadPtr sessionThread;
     Callback_Session_destroyPtr destroyCallback;
     {
@@ -743,11 +741,8 @@ SessionRouterI::destroy()
         _destroy = true;
         notify();
 
-        _routersByConnection.swap(routers);
-        _routersByConnectionHint = _routersByConnection.end();
-
+        _routersByConnection.clear(routers);
         _routersByCategory.clear();
-        _routersByCategoryHint = _routersByCategory.end();
 
         sessionThread = _sessionThread;
         _sessionThread = 0;
@@ -762,7 +757,7 @@ SessionRouterI::destroy()
     // We destroy the routers outside the thread synchronization, to
     // avoid deadlocks.
     //
-    for(map<ConnectionPtr, RouterIPtr>::iterator p = routers.begin(); p != routers.end(); ++p)
+    for(vector<pair<ConnectionPtr, RouterIPtr> >::const_iterator p = routers.begin(); p != routers.end(); ++p)
     {
         p->second->destroy(destroyCallback);
     }
@@ -883,15 +878,11 @@ SessionRouterI::destroySession(const Current& current)
 void
 SessionRouterI::refreshSession_async(const AMD_Router_refreshSessionPtr& callback, const Ice::Current& current)
 {
-    RouterIPtr router;
+    RouterIPtr router = getRouterImpl(current.con, current.id, false); // getRouter updates the session timestamp.
+    if(!router)
     {
-        IceUtil::Monitor<IceUtil::Mutex>::Lock lock(*this);
-        router = getRouterImpl(current.con, current.id, false); // getRouter updates the session timestamp.
-        if(!router)
-        {
-            callback->ice_exception(SessionNotExistException());
-            return;
-        }
+        callback->ice_exception(SessionNotExistException());
+        return;
     }
 
     SessionPrx session = router->getSession();
@@ -912,19 +903,15 @@ SessionRouterI::refreshSession_async(const AMD_Router_refreshSessionPtr& callbac
 void
 SessionRouterI::refreshSession(const Ice::ConnectionPtr& con)
 {
-    RouterIPtr router;
+    RouterIPtr router = getRouterImpl(con, Ice::Identity(), false); // getRouter updates the session timestamp.
+    if(!router)
     {
-        IceUtil::Monitor<IceUtil::Mutex>::Lock lock(*this);
-        router = getRouterImpl(con, Ice::Identity(), false); // getRouter updates the session timestamp.
-        if(!router)
-        {
-            //
-            // Close the connection otherwise the peer has no way to know that the
-            // session has gone.
-            //
-            con->close(true);
-            throw SessionNotExistException();
-        }
+        //
+        // Close the connection otherwise the peer has no way to know that the
+        // session has gone.
+        //
+        con->close(true);
+        throw SessionNotExistException();
     }
 
     SessionPrx session = router->getSession();
@@ -950,33 +937,16 @@ SessionRouterI::destroySession(const ConnectionPtr& connection)
             throw ObjectNotExistException(__FILE__, __LINE__);
         }
 
-        map<ConnectionPtr, RouterIPtr>::iterator p;
-
-        if(_routersByConnectionHint != _routersByConnection.end() && _routersByConnectionHint->first == connection)
-        {
-            p = _routersByConnectionHint;
-        }
-        else
-        {
-            p = _routersByConnection.find(connection);
-        }
-
-        if(p == _routersByConnection.end())
+        if(!_routersByConnection.erase(connection, router))
         {
             throw SessionNotExistException();
         }
 
-        router = p->second;
-
-        _routersByConnection.erase(p++);
-        _routersByConnectionHint = p;
-
         if(_instance->serverObjectAdapter())
         {
             string category = router->getServerProxy(Current())->ice_getIdentity().category;
             assert(!category.empty());
             _routersByCategory.erase(category);
-            _routersByCategoryHint = _routersByCategory.end();
         }
     }
 
@@ -1012,7 +982,9 @@ SessionRouterI::updateSessionObservers()
     Glacier2::Instrumentation::RouterObserverPtr observer = _instance->getObserver();
     assert(observer);
 
-    for(map<ConnectionPtr, RouterIPtr>::iterator p = _routersByConnection.begin(); p != _routersByConnection.end(); ++p)
+    vector<pair<ConnectionPtr, RouterIPtr> > routers;
+    _routersByConnection.entries(routers);
+    for(vector<pair<ConnectionPtr, RouterIPtr> >::const_iterator p = routers.begin(); p != routers.end(); ++p)
     {
         p->second->updateObserver(observer);
     }
@@ -1021,45 +993,28 @@ SessionRouterI::updateSessionObservers()
 RouterIPtr
 SessionRouterI::getRouter(const ConnectionPtr& connection, const Ice::Identity& id, bool close) const
 {
-    IceUtil::Monitor<IceUtil::Mutex>::Lock lock(*this);
     return getRouterImpl(connection, id, close);
 }
 
 Ice::ObjectPtr
 SessionRouterI::getClientBlobject(const ConnectionPtr& connection, const Ice::Identity& id) const
 {
-    IceUtil::Monitor<IceUtil::Mutex>::Lock lock(*this);
     return getRouterImpl(connection, id, true)->getClientBlobject();
 }
 
 Ice::ObjectPtr
 SessionRouterI::getServerBlobject(const string& category) const
 {
-    IceUtil::Monitor<IceUtil::Mutex>::Lock lock(*this);
-
-    if(_destroy)
-    {
-        throw ObjectNotExistException(__FILE__, __LINE__);
-    }
-
-    map<string, RouterIPtr>& routers = const_cast<map<string, RouterIPtr>&>(_routersByCategory);
-
-    if(_routersByCategoryHint != routers.end() && _routersByCategoryHint->first == category)
-    {
-        return _routersByCategoryHint->second->getServerBlobject();
-    }
-
-    map<string, RouterIPtr>::iterator p = routers.find(category);
-
-    if(p != routers.end())
-    {
-        _routersByCategoryHint = p;
-        return p->second->getServerBlobject();
-    }
-    else
+    //
+    // The router tables are cleared when the session router is
+    // destroyed, no need to check _destroy here.
+    //
+    RouterIPtr router;
+    if(!_routersByCategory.get(category, router))
     {
         throw ObjectNotExistException(__FILE__, __LINE__);
     }
+    return router->getServerBlobject();
 }
 
 void
@@ -1078,30 +1033,25 @@ SessionRouterI::expireSessions()
         assert(_sessionTimeout > IceUtil::Time());
         IceUtil::Time minTimestamp = IceUtil::Time::now(IceUtil::Time::Monotonic) - _sessionTimeout;
 
-        map<ConnectionPtr, RouterIPtr>::iterator p = _routersByConnection.begin();
+        vector<pair<ConnectionPtr, RouterIPtr> > entries;
+        _routersByConnection.entries(entries);
 
-        while(p != _routersByConnection.end())
+        for(vector<pair<ConnectionPtr, RouterIPtr> >::const_iterator p = entries.begin(); p != entries.end(); ++p)
         {
             if(p->second->getTimestamp() < minTimestamp)
             {
                 RouterIPtr router = p->second;
                 routers.push_back(router);
 
-                _routersByConnection.erase(p++);
-                _routersByConnectionHint = p;
+                _routersByConnection.erase(p->first);
 
                 if(_instance->serverObjectAdapter())
                 {
                     string category = router->getServerProxy(Current())->ice_getIdentity().category;
                     assert(!category.empty());
                     _routersByCategory.erase(category);
-                    _routersByCategoryHint = _routersByCategory.end();
                 }
             }
-            else
-            {
-                ++p;
-            }
         }
     }
 
@@ -1123,28 +1073,26 @@ SessionRouterI::expireSessions()
 RouterIPtr
 SessionRouterI::getRouterImpl(const ConnectionPtr& connection, const Ice::Identity& id, bool close) const
 {
-    if(_destroy)
+    //
+    // Must be called without the mutex locked, the lookup of the
+    // router only locks the stripe of the connection.
+    //
+    RouterIPtr router;
+    if(_routersByConnection.get(connection, router))
     {
-        throw ObjectNotExistException(__FILE__, __LINE__);
+        router->updateTimestamp();
+        return router;
     }
 
-    map<ConnectionPtr, RouterIPtr>& routers = const_cast<map<ConnectionPtr, RouterIPtr>&>(_routersByConnection);
-
-    if(_routersByConnectionHint != routers.end() && _routersByConnectionHint->first == connection)
     {
-        _routersByConnectionHint->second->updateTimestamp();
-        return _routersByConnectionHint->second;
+        IceUtil::Monitor<IceUtil::Mutex>::Lock lock(*this);
+        if(_destroy)
+        {
+            throw ObjectNotExistException(__FILE__, __LINE__);
+        }
     }
 
-    map<ConnectionPtr, RouterIPtr>::iterator p = routers.find(connection);
-
-    if(p != routers.end())
-    {
-        _routersByConnectionHint = p;
-        p->second->updateTimestamp();
-        return p->second;
-    }
-    else if(close)
+    if(close)
     {
         if(_rejectTraceLevel >= 1)
         {
@@ -1184,18 +1132,8 @@ SessionRouterI::startCreateSession(const CreateSessionPtr& cb, const ConnectionP
     // Check whether a session already exists for the connection.
     //
     {
-        map<ConnectionPtr, RouterIPtr>::iterator p;
-        if(_routersByConnectionHint != _routersByConnection.end() &&
-           _routersByConnectionHint->first == connection)
-        {
-            p = _routersByConnectionHint;
-        }
-        else
-        {
-            p = _routersByConnection.find(connection);
-        }
-
-        if(p != _routersByConnection.end())
+        RouterIPtr router;
+        if(_routersByConnection.get(connection, router))
         {
             CannotCreateSessionException exc;
             exc.reason = "session exists";
@@ -1251,17 +1189,17 @@ SessionRouterI::finishCreateSession(const ConnectionPtr& connection, const Route
         throw exc;
     }
 
-    _routersByConnectionHint = _routersByConnection.insert(
-        _routersByConnectionHint, pair<const ConnectionPtr, RouterIPtr>(connection, router));
+    _routersByConnection.insert(connection, router);
 
     if(_instance->serverObjectAdapter())
     {
         string category = router->getServerProxy()->ice_getIdentity().category;
         assert(!category.empty());
-        pair<map<string, RouterIPtr>::iterator, bool> rc =
-            _routersByCategory.insert(pair<const string, RouterIPtr>(category, router));
-        assert(rc.second);
-        _routersByCategoryHint = rc.first;
+#ifndef NDEBUG
+        bool inserted =
+#endif
+            _routersByCategory.insert(category, router);
+        assert(inserted);
     }
 
     connection->setCloseCallback(_closeCallback);
@@ -18,6 +18,7 @@
 #include <Glacier2/PermissionsVerifierF.h>
 #include <Glacier2/Router.h>
 #include <Glacier2/Instrumentation.h>
+#include <Glacier2/StripedMap.h>
 
 #include <set>
 
@@ -169,11 +170,13 @@ private:
     typedef IceUtil::Handle<SessionThread> SessionThreadPtr;
     SessionThreadPtr _sessionThread;
 
-    std::map<Ice::ConnectionPtr, RouterIPtr> _routersByConnection;
-    mutable std::map<Ice::ConnectionPtr, RouterIPtr>::iterator _routersByConnectionHint;
-
-    std::map<std::string, RouterIPtr> _routersByCategory;
-    mutable std::map<std::string, RouterIPtr>::iterator _routersByCategoryHint;
+    //
+    // The router tables are looked up on each routed request without
+    // locking the session router mutex, they are only updated with the
+    // mutex locked.
+    //
+    StripedMap<Ice::ConnectionPtr, RouterIPtr, ConnectionHash> _routersByConnection;
+    StripedMap<std::string, RouterIPtr, StringHash> _routersByCategory;
 
     std::map<Ice::ConnectionPtr, CreateSessionPtr> _pending;
 
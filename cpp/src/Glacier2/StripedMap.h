@@ -0,0 +1,160 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef GLACIER2_STRIPED_MAP_H
+#define GLACIER2_STRIPED_MAP_H
+
+#include <IceUtil/Mutex.h>
+#include <Ice/Ice.h>
+
+#include <map>
+#include <vector>
+
+namespace Glacier2
+{
+
+//
+// Hash functions for the keys of the session router tables.
+//
+struct ConnectionHash
+{
+    size_t operator()(const Ice::ConnectionPtr& connection) const
+    {
+        size_t h = reinterpret_cast<size_t>(connection.get());
+        return h ^ (h >> 7) ^ (h >> 17);
+    }
+};
+
+struct StringHash
+{
+    size_t operator()(const std::string& s) const
+    {
+        size_t h = 2166136261U; // FNV-1a
+        for(std::string::const_iterator p = s.begin(); p != s.end(); ++p)
+        {
+            h = (h ^ static_cast<unsigned char>(*p)) * 16777619U;
+        }
+        return h;
+    }
+};
+
+//
+// A map partitioned in N stripes selected by the hash of the key, each
+// stripe has its own mutex. Concurrent lookups of different keys
+// rarely contend on the same mutex and only search the entries of a
+// single stripe.
+//
+template<typename K, typename V, typename H, size_t N = 64>
+class StripedMap : private IceUtil::noncopyable
+{
+public:
+
+    bool get(const K& key, V& value) const
+    {
+        const Stripe& stripe = _stripes[index(key)];
+        IceUtil::Mutex::Lock sync(stripe.mutex);
+        typename std::map<K, V>::const_iterator p = stripe.map.find(key);
+        if(p == stripe.map.end())
+        {
+            return false;
+        }
+        value = p->second;
+        return true;
+    }
+
+    bool insert(const K& key, const V& value)
+    {
+        Stripe& stripe = _stripes[index(key)];
+        IceUtil::Mutex::Lock sync(stripe.mutex);
+        return stripe.map.insert(std::make_pair(key, value)).second;
+    }
+
+    bool erase(const K& key, V& value)
+    {
+        Stripe& stripe = _stripes[index(key)];
+        IceUtil::Mutex::Lock sync(stripe.mutex);
+        typename std::map<K, V>::iterator p = stripe.map.find(key);
+        if(p == stripe.map.end())
+        {
+            return false;
+        }
+        value = p->second;
+        stripe.map.erase(p);
+        return true;
+    }
+
+    bool erase(const K& key)
+    {
+        V value;
+        return erase(key, value);
+    }
+
+    //
+    // Returns a copy of the map entries. The entries of each stripe are
+    // consistent but the copy isn't an atomic snapshot of all stripes.
+    //
+    void entries(std::vector<std::pair<K, V> >& entries) const
+    {
+        for(size_t i = 0; i < N; ++i)
+        {
+            IceUtil::Mutex::Lock sync(_stripes[i].mutex);
+            entries.insert(entries.end(), _stripes[i].map.begin(), _stripes[i].map.end());
+        }
+    }
+
+    void clear(std::vector<std::pair<K, V> >& entries)
+    {
+        for(size_t i = 0; i < N; ++i)
+        {
+            IceUtil::Mutex::Lock sync(_stripes[i].mutex);
+            entries.insert(entries.end(), _stripes[i].map.begin(), _stripes[i].map.end());
+            _stripes[i].map.clear();
+        }
+    }
+
+    void clear()
+    {
+        for(size_t i = 0; i < N; ++i)
+        {
+            IceUtil::Mutex::Lock sync(_stripes[i].mutex);
+            _stripes[i].map.clear();
+        }
+    }
+
+    bool empty() const
+    {
+        for(size_t i = 0; i < N; ++i)
+        {
+            IceUtil::Mutex::Lock sync(_stripes[i].mutex);
+            if(!_stripes[i].map.empty())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+
+    size_t index(const K& key) const
+    {
+        return H()(key) % N;
+    }
+
+    struct Stripe
+    {
+        IceUtil::Mutex mutex;
+        std::map<K, V> map;
+    };
+    Stripe _stripes[N];
+};
+
+}
+
+#endif
@@ -205,7 +205,7 @@ IceInternal::OutgoingConnectionFactory::waitUntilFinished()
 
 void
 IceInternal::OutgoingConnectionFactory::create(const vector<EndpointIPtr>& endpts, bool hasMore,
-                                               Ice::EndpointSelectionType selType,
+                                               Ice::EndpointSelectionType selType, bool parallel,
                                                const CreateConnectionCallbackPtr& callback)
 {
     assert(!endpts.empty());
@@ -235,9 +235,9 @@ IceInternal::OutgoingConnectionFactory::create(const vector<EndpointIPtr>& endpt
     }
 
 #ifdef ICE_CPP11_MAPPING
-    auto cb = make_shared<ConnectCallback>(_instance, this, endpoints, hasMore, callback, selType);
+    auto cb = make_shared<ConnectCallback>(_instance, this, endpoints, hasMore, callback, selType, parallel);
 #else
-    ConnectCallbackPtr cb = new ConnectCallback(_instance, this, endpoints, hasMore, callback, selType);
+    ConnectCallbackPtr cb = new ConnectCallback(_instance, this, endpoints, hasMore, callback, selType, parallel);
 #endif
     cb->getConnectors();
 }
@@ -350,6 +350,9 @@ IceInternal::OutgoingConnectionFactory::OutgoingConnectionFactory(const Communic
     _communicator(communicator),
     _instance(instance),
     _monitor(new FactoryACMMonitor(instance, instance->clientACM())),
+    _parallelConnectDelay(IceUtil::Time::milliSeconds(max(0,
+        instance->initializationData().properties->getPropertyAsIntWithDefault("Ice.ParallelConnectDelay", 250)))),
+    _endpointHealth(instance->endpointHealth()),
     _destroyed(false),
     _pendingConnectCount(0)
 {
@@ -844,13 +847,16 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::ConnectCallback(const I
                                                                          const vector<EndpointIPtr>& endpoints,
                                                                          bool hasMore,
                                                                          const CreateConnectionCallbackPtr& cb,
-                                                                         Ice::EndpointSelectionType selType) :
+                                                                         Ice::EndpointSelectionType selType,
+                                                                         bool parallel) :
     _instance(instance),
     _factory(factory),
     _endpoints(endpoints),
     _hasMore(hasMore),
     _callback(cb),
-    _selType(selType)
+    _selType(selType),
+    _parallel(parallel),
+    _finished(false)
 {
     _endpointsIter = _endpoints.begin();
 }
@@ -861,19 +867,108 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::ConnectCallback(const I
 void
 IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartCompleted(const ConnectionIPtr& connection)
 {
+    if(isParallel())
+    {
+        //
+        // The first connection attempt to complete wins, the other
+        // attempts are aborted. Their start failure is ignored since
+        // they're no longer in the attempt list.
+        //
+        vector<ConnectAttempt> attempts;
+        {
+            IceUtil::Mutex::Lock sync(_mutex);
+            attempts.swap(_attempts);
+            if(_finished)
+            {
+                attempts.clear();
+            }
+            _finished = true;
+            cancelConnectTimer();
+            _timerTask = 0;
+        }
+
+        const ConnectAttempt* winner = 0;
+        for(vector<ConnectAttempt>::const_iterator p = attempts.begin(); p != attempts.end(); ++p)
+        {
+            if(p->connection == connection)
+            {
+                winner = &*p;
+            }
+            else
+            {
+                p->connection->close(true);
+            }
+
+            if(p->observer)
+            {
+                p->observer->detach();
+            }
+        }
+
+        if(!winner)
+        {
+            //
+            // Another connection attempt already won or failed the
+            // connection establishment.
+            //
+            connection->close(true);
+            return;
+        }
+
+        _factory->_endpointHealth->success(winner->connector.endpoint);
+        connection->activate();
+        _factory->finishGetConnection(_connectors, winner->connector, connection, ICE_SHARED_FROM_THIS);
+        return;
+    }
+
     if(_observer)
     {
         _observer->detach();
     }
 
+    _factory->_endpointHealth->success(_iter->endpoint);
     connection->activate();
     _factory->finishGetConnection(_connectors, *_iter, connection, ICE_SHARED_FROM_THIS);
 }
 
 void
-IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailed(const ConnectionIPtr& /*connection*/,
+IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailed(const ConnectionIPtr& connection,
                                                                                const LocalException& ex)
 {
+    if(isParallel())
+    {
+        Ice::Instrumentation::ObserverPtr observer;
+        EndpointIPtr endpoint;
+        {
+            IceUtil::Mutex::Lock sync(_mutex);
+            vector<ConnectAttempt>::iterator p = _attempts.begin();
+            while(p != _attempts.end() && p->connection != connection)
+            {
+                ++p;
+            }
+            if(p == _attempts.end())
+            {
+                return; // Aborted connection attempt.
+            }
+            observer = p->observer;
+            endpoint = p->connector.endpoint;
+            _attempts.erase(p);
+        }
+
+        if(observer)
+        {
+            observer->failed(ex.ice_id());
+            observer->detach();
+        }
+        _factory->_endpointHealth->failure(endpoint, ex);
+
+        if(parallelConnectFailed(ex))
+        {
+            nextParallelConnector();
+        }
+        return;
+    }
+
     assert(_iter != _connectors.end());
     if(connectionStartFailedImpl(ex))
     {
@@ -904,6 +999,7 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::connectors(const vector
         // We now have all the connectors for the given endpoints. We can try to obtain the
         // connection.
         //
+        skipEjectedConnectors();
         _iter = _connectors.begin();
         getConnection();
     }
@@ -923,6 +1019,7 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::exception(const Ice::Lo
         // We now have all the connectors for the given endpoints. We can try to obtain the
         // connection.
         //
+        skipEjectedConnectors();
         _iter = _connectors.begin();
         getConnection();
     }
@@ -1004,6 +1101,12 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::getConnection()
 void
 IceInternal::OutgoingConnectionFactory::ConnectCallback::nextConnector()
 {
+    if(isParallel())
+    {
+        nextParallelConnector();
+        return;
+    }
+
     while(true)
     {
         try
@@ -1047,6 +1150,123 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::nextConnector()
     }
 }
 
+void
+IceInternal::OutgoingConnectionFactory::ConnectCallback::nextParallelConnector()
+{
+    //
+    // Start a connection attempt to the next connector and schedule the
+    // following attempt after the connection attempt delay, unless one
+    // of the attempts completes first. If the connection attempt fails
+    // right away, the next connector is tried without waiting.
+    //
+    while(true)
+    {
+        vector<ConnectorInfo>::const_iterator p;
+        {
+            IceUtil::Mutex::Lock sync(_mutex);
+            if(_finished || _iter == _connectors.end())
+            {
+                return;
+            }
+            p = _iter++;
+        }
+
+        Ice::Instrumentation::ObserverPtr observer;
+        const CommunicatorObserverPtr& obsv = _factory->_instance->initializationData().observer;
+        if(obsv)
+        {
+            observer = obsv->getConnectionEstablishmentObserver(p->endpoint, p->connector->toString());
+            if(observer)
+            {
+                observer->attach();
+            }
+        }
+
+        if(_instance->traceLevels()->network >= 2)
+        {
+            Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+            out << "trying to establish " << p->endpoint->protocol() << " connection to "
+                << p->connector->toString();
+        }
+
+        Ice::ConnectionIPtr connection;
+        try
+        {
+            connection = _factory->createConnection(p->connector->connect(), *p);
+        }
+        catch(const Ice::LocalException& ex)
+        {
+            if(_instance->traceLevels()->network >= 2)
+            {
+                Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+                out << "failed to establish " << p->endpoint->protocol() << " connection to "
+                    << p->connector->toString() << "\n" << ex;
+            }
+
+            if(observer)
+            {
+                observer->failed(ex.ice_id());
+                observer->detach();
+            }
+            _factory->_endpointHealth->failure(p->endpoint, ex);
+
+            if(parallelConnectFailed(ex))
+            {
+                continue; // More connectors to try, continue.
+            }
+            return;
+        }
+
+        bool aborted;
+        {
+            IceUtil::Mutex::Lock sync(_mutex);
+            aborted = _finished;
+            if(!aborted)
+            {
+                _attempts.push_back(ConnectAttempt(*p, connection, observer));
+            }
+        }
+
+        if(aborted)
+        {
+            //
+            // Another connection attempt completed in the meantime.
+            //
+            connection->close(true);
+            if(observer)
+            {
+                observer->detach();
+            }
+            return;
+        }
+
+        //
+        // Start the connection without holding the mutex, the callback
+        // might be called right away from start().
+        //
+        connection->start(ICE_SHARED_FROM_THIS);
+
+        IceUtil::Mutex::Lock sync(_mutex);
+        if(!_finished && _iter != _connectors.end())
+        {
+            try
+            {
+                cancelConnectTimer();
+                if(!_timerTask)
+                {
+                    _timerTask = new ConnectTimerTask(ICE_SHARED_FROM_THIS);
+                }
+                _factory->_instance->timer()->schedule(_timerTask, _factory->_parallelConnectDelay);
+            }
+            catch(const Ice::CommunicatorDestroyedException&)
+            {
+                // Ignore, the pending connection attempts will fail.
+            }
+        }
+        return;
+    }
+}
+
 void
 IceInternal::OutgoingConnectionFactory::ConnectCallback::setConnection(const Ice::ConnectionIPtr& connection,
                                                                        bool compress)
@@ -1110,6 +1330,7 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailedIm
         _observer->failed(ex.ice_id());
         _observer->detach();
     }
+    _factory->_endpointHealth->failure(_iter->endpoint, ex);
 
     _factory->handleConnectionException(ex, _hasMore || _iter != _connectors.end() - 1);
     if(dynamic_cast<const Ice::CommunicatorDestroyedException*>(&ex)) // No need to continue.
@@ -1127,6 +1348,116 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailedIm
     return false;
 }
 
+bool
+IceInternal::OutgoingConnectionFactory::ConnectCallback::parallelConnectFailed(const Ice::LocalException& ex)
+{
+    bool destroyed = dynamic_cast<const Ice::CommunicatorDestroyedException*>(&ex);
+    bool more;
+    bool finished = false;
+    vector<ConnectAttempt> attempts;
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        if(_finished)
+        {
+            return false;
+        }
+
+        more = _iter != _connectors.end() || !_attempts.empty();
+        if(!destroyed && more)
+        {
+            //
+            // Start the next connection attempt right away if there are
+            // connectors left, otherwise wait for the pending attempts.
+            //
+            more = _iter != _connectors.end();
+            if(more)
+            {
+                cancelConnectTimer();
+            }
+        }
+        else
+        {
+            _finished = finished = true;
+            attempts.swap(_attempts);
+            cancelConnectTimer();
+            _timerTask = 0;
+        }
+    }
+
+    _factory->handleConnectionException(ex, _hasMore || more);
+
+    if(!finished)
+    {
+        return more;
+    }
+
+    for(vector<ConnectAttempt>::const_iterator p = attempts.begin(); p != attempts.end(); ++p)
+    {
+        p->connection->close(true);
+        if(p->observer)
+        {
+            p->observer->detach();
+        }
+    }
+    _factory->finishGetConnection(_connectors, ex, ICE_SHARED_FROM_THIS);
+    return false;
+}
+
+void
+IceInternal::OutgoingConnectionFactory::ConnectCallback::cancelConnectTimer()
+{
+    // Must be called with the mutex locked
+    if(_timerTask)
+    {
+        try
+        {
+            _factory->_instance->timer()->cancel(_timerTask);
+        }
+        catch(const Ice::CommunicatorDestroyedException&)
+        {
+            // Ignore
+        }
+    }
+}
+
+void
+IceInternal::OutgoingConnectionFactory::ConnectCallback::skipEjectedConnectors()
+{
+    //
+    // Skip the connectors of the ejected endpoints, unless they're all
+    // ejected.
+    //
+    vector<ConnectorInfo> connectors;
+    for(vector<ConnectorInfo>::const_iterator p = _connectors.begin(); p != _connectors.end(); ++p)
+    {
+        if(!_factory->_endpointHealth->isEjected(p->endpoint))
+        {
+            connectors.push_back(*p);
+        }
+    }
+    if(!connectors.empty() && connectors.size() != _connectors.size())
+    {
+        _connectors.swap(connectors);
+    }
+}
+
+bool
+IceInternal::OutgoingConnectionFactory::ConnectCallback::isParallel() const
+{
+    return _parallel && _connectors.size() > 1;
+}
+
+IceInternal::OutgoingConnectionFactory::ConnectTimerTask::ConnectTimerTask(const ConnectCallbackPtr& callback) :
+    _callback(callback)
+{
+}
+
+void
+IceInternal::OutgoingConnectionFactory::ConnectTimerTask::runTimerTask()
+{
+    _callback->nextParallelConnector();
+}
+
 void
 IceInternal::IncomingConnectionFactory::activate()
 {
@@ -12,6 +12,7 @@
 
 #include <IceUtil/Mutex.h>
 #include <IceUtil/Monitor.h>
+#include <IceUtil/Timer.h>
 #include <Ice/CommunicatorF.h>
 #include <Ice/ConnectionFactoryF.h>
 #include <Ice/ConnectionI.h>
@@ -25,6 +26,7 @@
 #include <Ice/RouterInfoF.h>
 #include <Ice/EventHandler.h>
 #include <Ice/EndpointI.h>
+#include <Ice/EndpointHealth.h>
 #include <Ice/InstrumentationF.h>
 #include <Ice/ACMF.h>
 #include <Ice/Comparable.h>
@@ -63,7 +65,8 @@ public:
 
     void waitUntilFinished();
 
-    void create(const std::vector<EndpointIPtr>&, bool, Ice::EndpointSelectionType, const CreateConnectionCallbackPtr&);
+    void create(const std::vector<EndpointIPtr>&, bool, Ice::EndpointSelectionType, bool,
+                const CreateConnectionCallbackPtr&);
     void setRouterInfo(const RouterInfoPtr&);
     void removeAdapter(const Ice::ObjectAdapterPtr&);
     void flushAsyncBatchRequests(const CommunicatorFlushBatchAsyncPtr&);
@@ -96,7 +99,7 @@ private:
     public:
 
         ConnectCallback(const InstancePtr&, const OutgoingConnectionFactoryPtr&, const std::vector<EndpointIPtr>&, bool,
-                        const CreateConnectionCallbackPtr&, Ice::EndpointSelectionType);
+                        const CreateConnectionCallbackPtr&, Ice::EndpointSelectionType, bool);
 
         virtual void connectionStartCompleted(const Ice::ConnectionIPtr&);
         virtual void connectionStartFailed(const Ice::ConnectionIPtr&, const Ice::LocalException&);
@@ -109,6 +112,7 @@ private:
 
         void getConnection();
         void nextConnector();
+        void nextParallelConnector();
 
         void setConnection(const Ice::ConnectionIPtr&, bool);
         void setException(const Ice::LocalException&);
@@ -121,7 +125,28 @@ private:
 
     private:
 
+        //
+        // A connection attempt started by the parallel connection
+        // establishment, which is still in progress.
+        //
+        struct ConnectAttempt
+        {
+            ConnectAttempt(const ConnectorInfo& ci, const Ice::ConnectionIPtr& c,
+                           const Ice::Instrumentation::ObserverPtr& o) :
+                connector(ci), connection(c), observer(o)
+            {
+            }
+
+            ConnectorInfo connector;
+            Ice::ConnectionIPtr connection;
+            Ice::Instrumentation::ObserverPtr observer;
+        };
+
         bool connectionStartFailedImpl(const Ice::LocalException&);
+        bool parallelConnectFailed(const Ice::LocalException&);
+        void cancelConnectTimer();
+        void skipEjectedConnectors();
+        bool isParallel() const;
 
         const InstancePtr _instance;
         const OutgoingConnectionFactoryPtr _factory;
@@ -129,14 +154,37 @@ private:
         const bool _hasMore;
         const CreateConnectionCallbackPtr _callback;
         const Ice::EndpointSelectionType _selType;
+        const bool _parallel;
         Ice::Instrumentation::ObserverPtr _observer;
         std::vector<EndpointIPtr>::const_iterator _endpointsIter;
         std::vector<ConnectorInfo> _connectors;
         std::vector<ConnectorInfo>::const_iterator _iter;
+
+        IceUtil::Mutex _mutex; // Protects the parallel connection attempts.
+        std::vector<ConnectAttempt> _attempts;
+        IceUtil::TimerTaskPtr _timerTask;
+        bool _finished;
     };
     ICE_DEFINE_PTR(ConnectCallbackPtr, ConnectCallback);
     friend class ConnectCallback;
 
+    //
+    // Starts the next parallel connection attempt once the connection
+    // attempt delay expires.
+    //
+    class ConnectTimerTask : public IceUtil::TimerTask
+    {
+    public:
+
+        ConnectTimerTask(const ConnectCallbackPtr&);
+
+        virtual void runTimerTask();
+
+    private:
+
+        const ConnectCallbackPtr _callback;
+    };
+
     std::vector<EndpointIPtr> applyOverrides(const std::vector<EndpointIPtr>&);
     Ice::ConnectionIPtr findConnection(const std::vector<EndpointIPtr>&, bool&);
     void incPendingConnectCount();
@@ -158,6 +206,8 @@ private:
     Ice::CommunicatorPtr _communicator;
     const InstancePtr _instance;
     const FactoryACMMonitorPtr _monitor;
+    const IceUtil::Time _parallelConnectDelay;
+    const EndpointHealthPtr _endpointHealth;
     bool _destroyed;
 
     std::multimap<ConnectorPtr, Ice::ConnectionIPtr> _connections;
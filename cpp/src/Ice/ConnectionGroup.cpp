@@ -0,0 +1,122 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/ConnectionGroup.h>
+#include <Ice/ConnectionI.h>
+#include <Ice/Instance.h>
+#include <Ice/DefaultsAndOverrides.h>
+#include <Ice/Initialize.h>
+#include <Ice/Protocol.h>
+#include <Ice/LocalException.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+Ice::ConnectionGroup::ConnectionGroup(const CommunicatorPtr& communicator) :
+    _instance(getInstance(communicator))
+{
+}
+
+Ice::ConnectionGroup::~ConnectionGroup()
+{
+}
+
+void
+Ice::ConnectionGroup::add(const ConnectionPtr& connection)
+{
+    ConnectionIPtr con = ICE_DYNAMIC_CAST(ConnectionI, connection);
+    if(!con)
+    {
+        throw IceUtil::IllegalArgumentException(__FILE__, __LINE__, "invalid connection");
+    }
+
+    Lock sync(*this);
+    _connections.insert(make_pair(con.get(), con));
+}
+
+void
+Ice::ConnectionGroup::remove(const ConnectionPtr& connection)
+{
+    Lock sync(*this);
+    _connections.erase(dynamic_cast<ConnectionI*>(connection.get()));
+}
+
+size_t
+Ice::ConnectionGroup::size()
+{
+    Lock sync(*this);
+    return _connections.size();
+}
+
+int
+Ice::ConnectionGroup::broadcast(const Identity& id, const string& facet, const string& operation, OperationMode mode,
+                                const pair<const Byte*, const Byte*>& inEncaps, const Context& context)
+{
+    //
+    // Marshal the request once, with the message size filled in.
+    //
+    BroadcastMessagePtr message = new BroadcastMessage(_instance.get());
+    OutputStream& os = message->stream;
+    os.writeBlob(requestHdr, sizeof(requestHdr));
+    os.write(id);
+    if(facet.empty())
+    {
+        os.write(static_cast<string*>(0), static_cast<string*>(0));
+    }
+    else
+    {
+        os.write(&facet, &facet + 1);
+    }
+    os.write(operation, false);
+    os.write(static_cast<Byte>(mode));
+    os.write(context);
+    if(inEncaps.first == inEncaps.second)
+    {
+        os.writeEmptyEncapsulation(_instance->defaultsAndOverrides()->defaultEncoding);
+    }
+    else
+    {
+        os.writeEncapsulation(inEncaps.first, static_cast<Int>(inEncaps.second - inEncaps.first));
+    }
+
+    Int sz = static_cast<Int>(os.b.size());
+    const Byte* p = reinterpret_cast<const Byte*>(&sz);
+#ifdef ICE_BIG_ENDIAN
+    reverse_copy(p, p + sizeof(Int), os.b.begin() + 10);
+#else
+    copy(p, p + sizeof(Int), os.b.begin() + 10);
+#endif
+
+    Lock sync(*this);
+    int count = 0;
+    map<ConnectionI*, ConnectionIPtr>::iterator q = _connections.begin();
+    while(q != _connections.end())
+    {
+        try
+        {
+            bool closed;
+            if(q->second->sendBroadcast(message, closed))
+            {
+                ++count;
+            }
+            else if(closed)
+            {
+                _connections.erase(q++); // The connection is closed or closing.
+                continue;
+            }
+        }
+        catch(const LocalException&)
+        {
+            // The message is too large for the connection's transport.
+        }
+        ++q;
+    }
+    return count;
+}
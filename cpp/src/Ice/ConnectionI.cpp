@@ -448,6 +448,34 @@ Ice::ConnectionI::isActiveOrHolding() const
     return _state > StateNotValidated && _state < StateClosing;
 }
 
+void
+Ice::ConnectionI::getLoad(size_t& bytes, size_t& requests) const
+{
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+
+    bytes = 0;
+    for(deque<OutgoingMessage>::const_iterator p = _sendStreams.begin(); p != _sendStreams.end(); ++p)
+    {
+        if(p->stream)
+        {
+            bytes += p->stream->b.size();
+        }
+    }
+    requests = _asyncRequests.size();
+}
+
+void
+Ice::ConnectionI::latency(const IceUtil::Time& latency)
+{
+    //
+    // No lock needed, the endpoint health is immutable.
+    //
+    if(_endpointHealth)
+    {
+        _endpointHealth->latency(_healthEndpoint, latency);
+    }
+}
+
 bool
 Ice::ConnectionI::isFinished() const
 {
@@ -688,6 +716,47 @@ Ice::ConnectionI::sendAsyncRequest(const OutgoingAsyncBasePtr& out, bool compres
     return status;
 }
 
+bool
+Ice::ConnectionI::sendBroadcast(const BroadcastMessagePtr& broadcast, bool& closed)
+{
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+    closed = false;
+    if(_exception || _state >= StateClosing)
+    {
+        closed = true;
+        return false;
+    }
+    else if(_state <= StateNotValidated)
+    {
+        return false; // Skip the message until the connection is validated.
+    }
+
+    _transceiver->checkSendSize(broadcast->stream);
+
+    //
+    // The stream doesn't copy the broadcast message, it only refers to
+    // its memory. The outgoing message keeps the broadcast message until
+    // it's sent.
+    //
+    OutputStream stream(_instance.get(), Ice::currentProtocolEncoding);
+    IceInternal::Buffer::Container buffer(broadcast->stream.b.begin(), broadcast->stream.b.end());
+    stream.b.swap(buffer);
+
+    try
+    {
+        OutgoingMessage message(&stream, false);
+        message.broadcast = broadcast;
+        sendMessage(message);
+    }
+    catch(const LocalException& ex)
+    {
+        setState(StateClosed, ex);
+        closed = true;
+        return false;
+    }
+    return true;
+}
+
 BatchRequestQueuePtr
 Ice::ConnectionI::getBatchRequestQueue() const
 {
@@ -933,6 +1002,11 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, con
         return; // The request has already been or will be shortly notified of the failure.
     }
 
+    if(_endpointHealth && dynamic_cast<const Ice::InvocationTimeoutException*>(&ex))
+    {
+        _endpointHealth->failure(_healthEndpoint, ex);
+    }
+
     for(deque<OutgoingMessage>::iterator o = _sendStreams.begin(); o != _sendStreams.end(); ++o)
     {
         if(o->outAsync.get() == outAsync.get())
@@ -1310,6 +1384,7 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
     OutgoingAsyncBasePtr outAsync;
     ICE_HEARTBEAT_CALLBACK heartbeatCallback;
     int dispatchCount = 0;
+    bool uncompress = false;
 
     ThreadPoolMessage<ConnectionI> msg(current, *this);
     {
@@ -1482,15 +1557,48 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
                 //
                 if(readyOp & SocketOperationRead)
                 {
-                    newOp = static_cast<SocketOperation>(newOp | parseMessage(current.stream,
-                                                                              invokeNum,
-                                                                              requestId,
-                                                                              compress,
-                                                                              servantManager,
-                                                                              adapter,
-                                                                              outAsync,
-                                                                              heartbeatCallback,
-                                                                              dispatchCount));
+                    //
+                    // Wait for the message being uncompressed by another
+                    // thread to be parsed, messages are parsed in order.
+                    //
+                    while(_uncompressing)
+                    {
+                        wait();
+                    }
+                    if(_state >= StateClosed)
+                    {
+                        return;
+                    }
+
+                    if(parallelUncompress())
+                    {
+                        //
+                        // Large compressed messages are uncompressed and parsed
+                        // once the IO is completed, another thread can read the
+                        // next message in the meantime.
+                        //
+                        _readStream.swap(current.stream);
+                        _readStream.resize(headerSize);
+                        _readStream.i = _readStream.b.begin();
+                        _readHeader = true;
+                        _uncompressing = true;
+                        uncompress = true;
+                        newOp = static_cast<SocketOperation>(newOp |
+                                                             (_state == StateHolding ? SocketOperationNone :
+                                                                                       SocketOperationRead));
+                    }
+                    else
+                    {
+                        newOp = static_cast<SocketOperation>(newOp | parseMessage(current.stream,
+                                                                                  invokeNum,
+                                                                                  requestId,
+                                                                                  compress,
+                                                                                  servantManager,
+                                                                                  adapter,
+                                                                                  outAsync,
+                                                                                  heartbeatCallback,
+                                                                                  dispatchCount));
+                    }
                 }
 
                 if(readyOp & SocketOperationWrite)
@@ -1514,7 +1622,7 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
                 _acmLastActivity = IceUtil::Time::now(IceUtil::Time::Monotonic);
             }
 
-            if(dispatchCount == 0)
+            if(dispatchCount == 0 && !uncompress)
             {
                 return; // Nothing to dispatch we're done!
             }
@@ -1560,6 +1668,49 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
         }
     }
 
+    if(uncompress)
+    {
+        IceUtil::UniquePtr<LocalException> exception;
+#ifdef ICE_HAS_BZIP2
+        try
+        {
+            InputStream ustream(_instance.get(), Ice::currentProtocolEncoding);
+            doUncompress(current.stream, ustream);
+            current.stream.b.swap(ustream.b);
+        }
+        catch(const LocalException& ex)
+        {
+            ICE_SET_EXCEPTION_FROM_CLONE(exception, ex.ice_clone());
+        }
+#endif
+
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+        _uncompressing = false;
+        notifyAll();
+
+        //
+        // The connection might have been closed while the message was
+        // uncompressed, its outstanding requests are already notified.
+        //
+        if(exception.get())
+        {
+            setState(StateClosed, *exception);
+        }
+        else if(_state < StateClosed)
+        {
+            int count = 0;
+            parseMessage(current.stream, invokeNum, requestId, compress, servantManager, adapter, outAsync,
+                         heartbeatCallback, count, true);
+            _dispatchCount += count;
+            dispatchCount += count;
+        }
+
+        if(dispatchCount == 0)
+        {
+            return;
+        }
+    }
+
     if(!_dispatcher) // Optimization, call dispatch() directly if there's no dispatcher.
     {
         dispatch(startCB, sentCBs, compress, requestId, invokeNum, servantManager, adapter, outAsync, heartbeatCallback,
@@ -1975,12 +2126,14 @@ Ice::ConnectionI::ConnectionI(const CommunicatorPtr& communicator,
     _warn(_instance->initializationData().properties->getPropertyAsInt("Ice.Warn.Connections") > 0),
     _warnUdp(_instance->initializationData().properties->getPropertyAsInt("Ice.Warn.Datagrams") > 0),
     _compressionLevel(1),
+    _parallelUncompressSize(0),
     _nextRequestId(1),
     _asyncRequestsHint(_asyncRequests.end()),
     _messageSizeMax(adapter ? adapter->messageSizeMax() : _instance->messageSizeMax()),
     _batchRequestQueue(new BatchRequestQueue(instance, endpoint->datagram())),
     _readStream(_instance.get(), Ice::currentProtocolEncoding),
     _readHeader(false),
+    _uncompressing(false),
     _writeStream(_instance.get(), Ice::currentProtocolEncoding),
     _dispatchCount(0),
     _state(StateNotInitialized),
@@ -2001,11 +2154,28 @@ Ice::ConnectionI::ConnectionI(const CommunicatorPtr& communicator,
         compressionLevel = 9;
     }
 
+    int parallelUncompressSize = properties->getPropertyAsIntWithDefault("Ice.Compression.ParallelUncompressSize",
+                                                                         100 * 1024);
+    if(parallelUncompressSize > 0)
+    {
+        const_cast<size_t&>(_parallelUncompressSize) = static_cast<size_t>(parallelUncompressSize);
+    }
+
     if(adapter)
     {
         _servantManager = adapter->getServantManager();
     }
 
+    if(_connector)
+    {
+        EndpointHealthPtr endpointHealth = _instance->endpointHealth();
+        if(endpointHealth->isEnabled())
+        {
+            const_cast<EndpointHealthPtr&>(_endpointHealth) = endpointHealth;
+            const_cast<EndpointIPtr&>(_healthEndpoint) = EndpointHealth::normalize(_endpoint);
+        }
+    }
+
     if(_monitor && _monitor->getACM().timeout > 0)
     {
         _acmLastActivity = IceUtil::Time::now(IceUtil::Time::Monotonic);
@@ -2067,6 +2237,15 @@ Ice::ConnectionI::setState(State state, const LocalException& ex)
         //
         assert(_state != StateClosed);
         ICE_SET_EXCEPTION_FROM_CLONE(_exception, ex.ice_clone());
+
+        //
+        // Connection establishment failures are reported to the endpoint
+        // health by the outgoing connection factory.
+        //
+        if(_endpointHealth && _validated && dynamic_cast<const TimeoutException*>(&ex))
+        {
+            _endpointHealth->failure(_healthEndpoint, ex);
+        }
         //
         // We don't warn if we are not validated.
         //
@@ -2605,15 +2784,19 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
                 }
 
                 //
-                // No compression, just fill in the message size.
+                // No compression, just fill in the message size. The size of
+                // a broadcast message is already filled in.
                 //
-                Int sz = static_cast<Int>(message->stream->b.size());
-                const Byte* p = reinterpret_cast<const Byte*>(&sz);
+                if(!message->broadcast)
+                {
+                    Int sz = static_cast<Int>(message->stream->b.size());
+                    const Byte* p = reinterpret_cast<const Byte*>(&sz);
 #ifdef ICE_BIG_ENDIAN
-                reverse_copy(p, p + sizeof(Int), message->stream->b.begin() + 10);
+                    reverse_copy(p, p + sizeof(Int), message->stream->b.begin() + 10);
 #else
-                copy(p, p + sizeof(Int), message->stream->b.begin() + 10);
+                    copy(p, p + sizeof(Int), message->stream->b.begin() + 10);
 #endif
+                }
                 message->stream->i = message->stream->b.begin();
                 traceSend(*message->stream, _logger, _traceLevels);
 
@@ -2745,15 +2928,19 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
         }
 
         //
-        // No compression, just fill in the message size.
+        // No compression, just fill in the message size. The size of a
+        // broadcast message is already filled in.
         //
-        Int sz = static_cast<Int>(message.stream->b.size());
-        const Byte* p = reinterpret_cast<const Byte*>(&sz);
+        if(!message.broadcast)
+        {
+            Int sz = static_cast<Int>(message.stream->b.size());
+            const Byte* p = reinterpret_cast<const Byte*>(&sz);
 #ifdef ICE_BIG_ENDIAN
-        reverse_copy(p, p + sizeof(Int), message.stream->b.begin() + 10);
+            reverse_copy(p, p + sizeof(Int), message.stream->b.begin() + 10);
 #else
-        copy(p, p + sizeof(Int), message.stream->b.begin() + 10);
+            copy(p, p + sizeof(Int), message.stream->b.begin() + 10);
 #endif
+        }
         message.stream->i = message.stream->b.begin();
 
         traceSend(*message.stream, _logger, _traceLevels);
@@ -2948,20 +3135,48 @@ Ice::ConnectionI::doUncompress(InputStream& compressed, InputStream& uncompresse
 }
 #endif
 
+bool
+Ice::ConnectionI::parallelUncompress() const
+{
+#ifdef ICE_HAS_BZIP2
+    //
+    // Only large compressed requests and replies are uncompressed outside
+    // the synchronization. The header is never compressed.
+    //
+    if(_parallelUncompressSize == 0 || _readStream.b.size() < _parallelUncompressSize || _endpoint->datagram())
+    {
+        return false;
+    }
+    const Byte messageType = _readStream.b[8];
+    const Byte compress = _readStream.b[9];
+    return compress == 2 &&
+        (messageType == requestMsg || messageType == requestBatchMsg || messageType == replyMsg);
+#else
+    return false;
+#endif
+}
+
 SocketOperation
 Ice::ConnectionI::parseMessage(InputStream& stream, Int& invokeNum, Int& requestId, Byte& compress,
                                ServantManagerPtr& servantManager, ObjectAdapterPtr& adapter,
                                OutgoingAsyncBasePtr& outAsync, ICE_HEARTBEAT_CALLBACK& heartbeatCallback,
-                               int& dispatchCount)
+                               int& dispatchCount, bool uncompressed)
 {
     assert(_state > StateNotValidated && _state < StateClosed);
 
-    _readStream.swap(stream);
-    _readStream.resize(headerSize);
-    _readStream.i = _readStream.b.begin();
-    _readHeader = true;
+    //
+    // The message is already taken from the read stream and uncompressed
+    // if it was uncompressed outside the synchronization by message().
+    //
+    if(!uncompressed)
+    {
+        _readStream.swap(stream);
+        _readStream.resize(headerSize);
+        _readStream.i = _readStream.b.begin();
+        _readHeader = true;
 
-    assert(stream.i == stream.b.end());
+        assert(stream.i == stream.b.end());
+    }
 
     //
     // Connection is validated on first message. This is only used by
@@ -2978,13 +3193,12 @@ Ice::ConnectionI::parseMessage(InputStream& stream, Int& invokeNum, Int& request
         // already been done by the ThreadPool, which provides us
         // with the stream.
         //
-        assert(stream.i == stream.b.end());
         stream.i = stream.b.begin() + 8;
         Byte messageType;
         stream.read(messageType);
         stream.read(compress);
 
-        if(compress == 2)
+        if(compress == 2 && !uncompressed)
         {
 #ifdef ICE_HAS_BZIP2
             InputStream ustream(_instance.get(), Ice::currentProtocolEncoding);
@@ -16,6 +16,7 @@
 #include <IceUtil/StopWatch.h>
 #include <IceUtil/Timer.h>
 #include <IceUtil/UniquePtr.h>
+#include <IceUtil/Shared.h>
 
 #include <Ice/CommunicatorF.h>
 #include <Ice/Connection.h>
@@ -38,6 +39,7 @@
 #include <Ice/ConnectionAsync.h>
 #include <Ice/BatchRequestQueueF.h>
 #include <Ice/ACM.h>
+#include <Ice/EndpointHealth.h>
 #include <Ice/OutputStream.h>
 #include <Ice/InputStream.h>
 
@@ -49,6 +51,28 @@
 #    endif
 #endif
 
+namespace IceInternal
+{
+
+//
+// A request marshaled once and queued on several connections by
+// Ice::ConnectionGroup. The message size is already filled in and the
+// message is never compressed, the connections only read the message.
+//
+class BroadcastMessage : public IceUtil::Shared
+{
+public:
+
+    BroadcastMessage(Instance* instance) : stream(instance, Ice::currentProtocolEncoding)
+    {
+    }
+
+    Ice::OutputStream stream;
+};
+typedef IceUtil::Handle<BroadcastMessage> BroadcastMessagePtr;
+
+}
+
 namespace Ice
 {
 
@@ -116,6 +140,7 @@ public:
 
         Ice::OutputStream* stream;
         IceInternal::OutgoingAsyncBasePtr outAsync;
+        IceInternal::BroadcastMessagePtr broadcast; // Keeps the broadcast message memory used by stream.
         bool compress;
         int requestId;
         bool adopted;
@@ -162,6 +187,22 @@ public:
     bool isActiveOrHolding() const;
     bool isFinished() const;
 
+    //
+    // Get the number of bytes queued for sending and the number of
+    // outstanding requests, used to balance the connection pool load.
+    //
+    void getLoad(size_t&, size_t&) const;
+
+    //
+    // Report the reply latency of a request to the endpoint health, if
+    // it tracks the latency of the connection endpoint.
+    //
+    bool tracksLatency() const
+    {
+        return _endpointHealth && _endpointHealth->tracksLatency();
+    }
+    void latency(const IceUtil::Time&);
+
     void throwException() const; // Throws the connection exception if destroyed.
 
     void waitUntilHolding() const;
@@ -173,6 +214,13 @@ public:
 
     IceInternal::AsyncStatus sendAsyncRequest(const IceInternal::OutgoingAsyncBasePtr&, bool, bool, int);
 
+    //
+    // Returns false if the broadcast message isn't sent, either because
+    // the connection isn't validated yet or because it's closed. The
+    // second parameter is set to true in the latter case.
+    //
+    bool sendBroadcast(const IceInternal::BroadcastMessagePtr&, bool&);
+
     IceInternal::BatchRequestQueuePtr getBatchRequestQueue() const;
 
     virtual void flushBatchRequests();
@@ -288,9 +336,11 @@ private:
     void doUncompress(Ice::InputStream&, Ice::InputStream&);
 #endif
 
+    bool parallelUncompress() const;
     IceInternal::SocketOperation parseMessage(Ice::InputStream&, Int&, Int&, Byte&,
                                               IceInternal::ServantManagerPtr&, ObjectAdapterPtr&,
-                                              IceInternal::OutgoingAsyncBasePtr&, ICE_HEARTBEAT_CALLBACK&, int&);
+                                              IceInternal::OutgoingAsyncBasePtr&, ICE_HEARTBEAT_CALLBACK&, int&,
+                                              bool = false);
 
     void invokeAll(Ice::InputStream&, Int, Int, Byte,
                    const IceInternal::ServantManagerPtr&, const ObjectAdapterPtr&);
@@ -319,6 +369,9 @@ private:
     const IceInternal::ConnectorPtr _connector;
     const IceInternal::EndpointIPtr _endpoint;
 
+    const IceInternal::EndpointHealthPtr _endpointHealth; // Only set for outgoing connections if enabled.
+    const IceInternal::EndpointIPtr _healthEndpoint; // The normalized endpoint, see EndpointHealth::normalize.
+
     mutable Ice::ConnectionInfoPtr _info;
 
     ObjectAdapterPtr _adapter;
@@ -343,6 +396,7 @@ private:
     IceUtil::Time _acmLastActivity;
 
     const int _compressionLevel;
+    const size_t _parallelUncompressSize;
 
     Int _nextRequestId;
 
@@ -358,6 +412,7 @@ private:
 
     Ice::InputStream _readStream;
     bool _readHeader;
+    bool _uncompressing; // A message is being uncompressed outside the synchronization.
     Ice::OutputStream _writeStream;
 
     Observer _observer;
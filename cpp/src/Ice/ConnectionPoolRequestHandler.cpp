@@ -0,0 +1,331 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/ConnectionPoolRequestHandler.h>
+#include <Ice/Proxy.h>
+#include <Ice/Reference.h>
+#include <Ice/ConnectionI.h>
+#include <Ice/OutgoingAsync.h>
+
+#include <sstream>
+
+using namespace std;
+using namespace IceInternal;
+
+namespace
+{
+
+class PoolConnectionCallback : public Reference::GetConnectionCallback
+{
+public:
+
+    PoolConnectionCallback(const ConnectionPoolRequestHandlerPtr& handler, int id) : _handler(handler), _id(id)
+    {
+    }
+
+    virtual void
+    setConnection(const Ice::ConnectionIPtr& connection, bool compress)
+    {
+        _handler->connected(_id, connection, compress);
+    }
+
+    virtual void
+    setException(const Ice::LocalException&)
+    {
+        _handler->connectFailed(_id);
+    }
+
+private:
+
+    const ConnectionPoolRequestHandlerPtr _handler;
+    const int _id;
+};
+
+}
+
+ConnectionPoolRequestHandler::ConnectionPoolRequestHandler(const ReferencePtr& reference,
+                                                           const RequestHandlerPtr& handler,
+                                                           bool leastLoaded,
+                                                           size_t growThreshold,
+                                                           const IceUtil::Time& idleTimeout) :
+    RequestHandler(reference),
+    _handler(handler),
+    _leastLoaded(leastLoaded),
+    _growThreshold(growThreshold),
+    _idleTimeout(idleTimeout),
+    _size(reference->getConnectionPoolSize()),
+    _next(0)
+{
+}
+
+RequestHandlerPtr
+ConnectionPoolRequestHandler::update(const RequestHandlerPtr& previousHandler, const RequestHandlerPtr& newHandler)
+{
+    assert(previousHandler);
+    if(previousHandler.get() == this)
+    {
+        return newHandler;
+    }
+
+    //
+    // The handler of the first connection is updated once the connect
+    // request handler is done with the connection establishment. It's
+    // called without the lock, update() might call back getConnection().
+    //
+    RequestHandlerPtr handler;
+    {
+        Lock sync(*this);
+        handler = _handler;
+    }
+    RequestHandlerPtr updated = handler->update(previousHandler, newHandler);
+    if(!updated)
+    {
+        return updated; // Clear the pool as well.
+    }
+
+    Lock sync(*this);
+    if(_handler.get() == handler.get())
+    {
+        _handler = updated;
+    }
+    return ICE_SHARED_FROM_THIS;
+}
+
+AsyncStatus
+ConnectionPoolRequestHandler::sendAsyncRequest(const ProxyOutgoingAsyncBasePtr& out)
+{
+    RequestHandlerPtr handler;
+    {
+        Lock sync(*this);
+        handler = _handler;
+    }
+
+    //
+    // Only requests are striped over the pool, batch flushes and
+    // ice_getConnection always use the first connection. Requests also
+    // use it until it's established.
+    //
+    Ice::ConnectionIPtr first;
+    if(dynamic_cast<OutgoingAsync*>(out.get()))
+    {
+        try
+        {
+            first = handler->getConnection();
+        }
+        catch(const Ice::LocalException&)
+        {
+            // The handler reports the connection establishment failure.
+        }
+    }
+    if(!first)
+    {
+        return handler->sendAsyncRequest(out);
+    }
+
+    Ice::ConnectionIPtr connection;
+    bool compress = false;
+    int grow = 0;
+    {
+        Lock sync(*this);
+
+        //
+        // Remove the connections which were closed since the last request,
+        // by the peer or by ACM.
+        //
+        vector<PooledConnection>::iterator p = _connections.begin();
+        while(p != _connections.end())
+        {
+            if(p->connection->isActiveOrHolding())
+            {
+                ++p;
+            }
+            else
+            {
+                p = _connections.erase(p);
+            }
+        }
+
+        //
+        // Get the load of each connection, the first connection has the
+        // index 0. The least loaded connection is the one with the fewest
+        // bytes queued for sending and then the fewest outstanding
+        // requests. Ties go to the lowest index, so that the connections
+        // at the end of the pool become idle when the load decreases.
+        //
+        const size_t count = _connections.size() + 1;
+        vector<size_t> queued(count);
+        size_t leastLoaded = 0;
+        size_t leastRequests = 0;
+        bool idle = true;
+        for(size_t i = 0; i < count; ++i)
+        {
+            size_t requests;
+            (i == 0 ? first : _connections[i - 1].connection)->getLoad(queued[i], requests);
+            if(queued[i] > 0 || requests > 0)
+            {
+                idle = false;
+            }
+            if(i == 0 || queued[i] < queued[leastLoaded] ||
+               (queued[i] == queued[leastLoaded] && requests < leastRequests))
+            {
+                leastLoaded = i;
+                leastRequests = requests;
+            }
+        }
+
+        size_t selected = 0;
+        if(idle)
+        {
+            //
+            // Release the connections once the pool has been idle for the
+            // idle timeout, the first connection is then enough to handle
+            // the load. They're closed by ACM once they are idle, unless
+            // another proxy's pool still uses them.
+            //
+            IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+            if(_idleSince == IceUtil::Time())
+            {
+                _idleSince = now;
+            }
+            else if(now - _idleSince >= _idleTimeout)
+            {
+                _connections.clear();
+                _idleSince = IceUtil::Time();
+            }
+        }
+        else
+        {
+            _idleSince = IceUtil::Time();
+            selected = _leastLoaded ? leastLoaded : _next++ % count;
+        }
+
+        //
+        // Establish a new connection if the selected connection can't keep
+        // up with the requests and the pool isn't full. The ids of the
+        // released connections are re-used, the outgoing connection factory
+        // returns the connection if it's still open.
+        //
+        if(queued[selected] >= _growThreshold &&
+           static_cast<int>(_connections.size() + _connecting.size()) + 1 < _size)
+        {
+            set<int> ids = _connecting;
+            for(vector<PooledConnection>::const_iterator q = _connections.begin(); q != _connections.end(); ++q)
+            {
+                ids.insert(q->id);
+            }
+            grow = 1;
+            while(ids.find(grow) != ids.end())
+            {
+                ++grow;
+            }
+            _connecting.insert(grow);
+        }
+
+        if(selected > 0)
+        {
+            connection = _connections[selected - 1].connection;
+            compress = _connections[selected - 1].compress;
+        }
+    }
+
+    if(grow > 0)
+    {
+        addConnection(grow);
+    }
+
+    if(!connection)
+    {
+        return handler->sendAsyncRequest(out);
+    }
+    return out->invokeRemote(connection, compress, _response);
+}
+
+void
+ConnectionPoolRequestHandler::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync,
+                                                   const Ice::LocalException& ex)
+{
+    //
+    // Requests sent over a connection are canceled by the connection,
+    // only the requests queued by the connect request handler end up here.
+    //
+    RequestHandlerPtr handler;
+    {
+        Lock sync(*this);
+        handler = _handler;
+    }
+    handler->asyncRequestCanceled(outAsync, ex);
+}
+
+Ice::ConnectionIPtr
+ConnectionPoolRequestHandler::getConnection()
+{
+    RequestHandlerPtr handler;
+    {
+        Lock sync(*this);
+        handler = _handler;
+    }
+    return handler->getConnection();
+}
+
+Ice::ConnectionIPtr
+ConnectionPoolRequestHandler::waitForConnection()
+{
+    RequestHandlerPtr handler;
+    {
+        Lock sync(*this);
+        handler = _handler;
+    }
+    return handler->waitForConnection();
+}
+
+void
+ConnectionPoolRequestHandler::connected(int id, const Ice::ConnectionIPtr& connection, bool compress)
+{
+    Lock sync(*this);
+    _connecting.erase(id);
+
+    PooledConnection pooled;
+    pooled.id = id;
+    pooled.connection = connection;
+    pooled.compress = compress;
+    _connections.push_back(pooled);
+}
+
+void
+ConnectionPoolRequestHandler::connectFailed(int id)
+{
+    //
+    // Requests keep using the connections of the pool, a new connection
+    // is established if the pool is still saturated.
+    //
+    Lock sync(*this);
+    _connecting.erase(id);
+}
+
+void
+ConnectionPoolRequestHandler::addConnection(int id)
+{
+    //
+    // Each connection of the pool is established with its own connection
+    // id, to prevent the outgoing connection factory from returning the
+    // connections already in the pool.
+    //
+    ostringstream os;
+    os << _reference->getConnectionId() << "#pool" << id;
+    try
+    {
+        RoutableReferencePtr ref = RoutableReferencePtr::dynamicCast(_reference->changeConnectionId(os.str()));
+        assert(ref);
+        ref->getConnection(ICE_MAKE_SHARED(PoolConnectionCallback, ICE_SHARED_FROM_THIS, id));
+    }
+    catch(const Ice::LocalException&)
+    {
+        connectFailed(id);
+    }
+}
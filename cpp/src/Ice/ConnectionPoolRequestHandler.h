@@ -0,0 +1,79 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_CONNECTION_POOL_REQUEST_HANDLER_H
+#define ICE_CONNECTION_POOL_REQUEST_HANDLER_H
+
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Time.h>
+
+#include <Ice/RequestHandler.h>
+#include <Ice/ReferenceF.h>
+#include <Ice/ProxyF.h>
+
+#include <set>
+#include <vector>
+
+namespace IceInternal
+{
+
+//
+// A request handler which stripes the requests of a proxy over a pool
+// of connections. The first connection is the one established by the
+// connect request handler, additional connections are established
+// when the connections of the pool are saturated and released once
+// the pool has been idle for the idle timeout.
+//
+class ConnectionPoolRequestHandler : public RequestHandler, private IceUtil::Mutex
+#ifdef ICE_CPP11_MAPPING
+                                   , public std::enable_shared_from_this<ConnectionPoolRequestHandler>
+#endif
+{
+public:
+
+    ConnectionPoolRequestHandler(const ReferencePtr&, const RequestHandlerPtr&, bool, size_t, const IceUtil::Time&);
+
+    virtual RequestHandlerPtr update(const RequestHandlerPtr&, const RequestHandlerPtr&);
+
+    virtual AsyncStatus sendAsyncRequest(const ProxyOutgoingAsyncBasePtr&);
+
+    virtual void asyncRequestCanceled(const OutgoingAsyncBasePtr&, const Ice::LocalException&);
+
+    virtual Ice::ConnectionIPtr getConnection();
+    virtual Ice::ConnectionIPtr waitForConnection();
+
+    void connected(int, const Ice::ConnectionIPtr&, bool);
+    void connectFailed(int);
+
+private:
+
+    void addConnection(int);
+
+    struct PooledConnection
+    {
+        int id;
+        Ice::ConnectionIPtr connection;
+        bool compress;
+    };
+
+    RequestHandlerPtr _handler; // The handler of the first connection.
+    std::vector<PooledConnection> _connections;
+    std::set<int> _connecting;
+    const bool _leastLoaded;
+    const size_t _growThreshold;
+    const IceUtil::Time _idleTimeout;
+    const int _size;
+    size_t _next;
+    IceUtil::Time _idleSince; // Zero if the pool isn't idle.
+};
+ICE_DEFINE_PTR(ConnectionPoolRequestHandlerPtr, ConnectionPoolRequestHandler);
+
+}
+
+#endif
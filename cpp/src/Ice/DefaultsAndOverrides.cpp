@@ -158,6 +158,21 @@ IceInternal::DefaultsAndOverrides::DefaultsAndOverrides(const PropertiesPtr& pro
     const_cast<bool&>(defaultPreferSecure) =
         properties->getPropertyAsIntWithDefault("Ice.Default.PreferSecure", 0) > 0;
 
+    const_cast<bool&>(defaultParallelConnect) =
+        properties->getPropertyAsIntWithDefault("Ice.Default.ParallelConnect", 0) > 0;
+
+    const_cast<int&>(defaultConnectionPoolSize) =
+        properties->getPropertyAsIntWithDefault("Ice.Default.ConnectionPoolSize", 1);
+    if(defaultConnectionPoolSize < 1)
+    {
+        const_cast<int&>(defaultConnectionPoolSize) = 1;
+        Warning out(logger);
+        out << "invalid value for Ice.Default.ConnectionPoolSize `"
+            << properties->getProperty("Ice.Default.ConnectionPoolSize") << "': defaulting to 1";
+    }
+
+    const_cast<bool&>(defaultHedging) = properties->getPropertyAsIntWithDefault("Ice.Default.Hedging", 0) > 0;
+
     value = properties->getPropertyWithDefault("Ice.Default.EncodingVersion", encodingVersionToString(currentEncoding));
     defaultEncoding = stringToEncodingVersion(value);
     checkSupportedEncoding(defaultEncoding);
@@ -37,6 +37,9 @@ public:
     int defaultInvocationTimeout;
     int defaultLocatorCacheTimeout;
     bool defaultPreferSecure;
+    bool defaultParallelConnect;
+    int defaultConnectionPoolSize;
+    bool defaultHedging;
     Ice::EncodingVersion defaultEncoding;
     Ice::FormatType defaultFormat;
 
@@ -0,0 +1,414 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/EndpointHealth.h>
+#include <Ice/EndpointI.h>
+#include <Ice/Instance.h>
+#include <Ice/InstrumentationI.h>
+#include <Ice/Properties.h>
+#include <Ice/TraceLevels.h>
+#include <Ice/LoggerUtil.h>
+#include <Ice/LocalException.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+
+//
+// The reply latency of an endpoint is only compared to the latency
+// threshold once the endpoint has minSamples latencies. The weight of
+// a new latency in the moving average is latencyWeight.
+//
+const int minSamples = 10;
+const double latencyWeight = 0.1;
+
+//
+// Healthy endpoints which didn't fail or reply for idleTime seconds are
+// no longer tracked. The entries are checked at most every idleTime
+// seconds, when an endpoint is added.
+//
+const IceUtil::Int64 idleTime = 300;
+
+}
+
+IceInternal::EndpointHealth::EndpointHealth(const InstancePtr& instance) :
+    _instance(instance),
+    _failureThreshold(0),
+    _latencyThreshold(0),
+    _ejectionTime(IceUtil::Time::seconds(30)),
+    _maxEjectionTime(IceUtil::Time::seconds(300))
+{
+    const PropertiesPtr properties = instance->initializationData().properties;
+
+    int failureThreshold = properties->getPropertyAsInt("Ice.EndpointHealth.FailureThreshold");
+    if(failureThreshold > 0)
+    {
+        const_cast<int&>(_failureThreshold) = failureThreshold;
+    }
+
+    int latencyThreshold = properties->getPropertyAsInt("Ice.EndpointHealth.LatencyThreshold");
+    if(latencyThreshold > 0)
+    {
+        const_cast<IceUtil::Int64&>(_latencyThreshold) = static_cast<IceUtil::Int64>(latencyThreshold) * 1000;
+    }
+
+    int ejectionTime = properties->getPropertyAsIntWithDefault("Ice.EndpointHealth.EjectionTime", 30000);
+    if(ejectionTime <= 0)
+    {
+        Warning out(instance->initializationData().logger);
+        out << "invalid value for Ice.EndpointHealth.EjectionTime `"
+            << properties->getProperty("Ice.EndpointHealth.EjectionTime") << "': defaulting to 30000";
+    }
+    else
+    {
+        const_cast<IceUtil::Time&>(_ejectionTime) = IceUtil::Time::milliSeconds(ejectionTime);
+    }
+
+    int maxEjectionTime = properties->getPropertyAsIntWithDefault("Ice.EndpointHealth.MaxEjectionTime", 300000);
+    if(maxEjectionTime < ejectionTime)
+    {
+        Warning out(instance->initializationData().logger);
+        out << "invalid value for Ice.EndpointHealth.MaxEjectionTime `"
+            << properties->getProperty("Ice.EndpointHealth.MaxEjectionTime")
+            << "': defaulting to the ejection time";
+        const_cast<IceUtil::Time&>(_maxEjectionTime) = _ejectionTime;
+    }
+    else
+    {
+        const_cast<IceUtil::Time&>(_maxEjectionTime) = IceUtil::Time::milliSeconds(maxEjectionTime);
+    }
+}
+
+void
+IceInternal::EndpointHealth::filter(vector<EndpointIPtr>& endpoints)
+{
+    if(!isEnabled())
+    {
+        return;
+    }
+
+    vector<EndpointIPtr> normalized;
+    normalized.reserve(endpoints.size());
+    for(vector<EndpointIPtr>::const_iterator p = endpoints.begin(); p != endpoints.end(); ++p)
+    {
+        normalized.push_back(normalize(*p));
+    }
+
+    Lock sync(*this);
+    if(_entries.empty())
+    {
+        return;
+    }
+
+    IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    vector<EndpointIPtr> available;
+    for(size_t i = 0; i < endpoints.size(); ++i)
+    {
+        if(isAvailable(normalized[i], now))
+        {
+            available.push_back(endpoints[i]);
+        }
+    }
+
+    //
+    // If all the endpoints are ejected, they're all tried anyway. Failing
+    // right away would leave the caller without endpoints for the whole
+    // ejection time.
+    //
+    if(!available.empty() && available.size() != endpoints.size())
+    {
+        endpoints.swap(available);
+    }
+}
+
+bool
+IceInternal::EndpointHealth::isEjected(const EndpointIPtr& endpoint)
+{
+    if(!isEnabled())
+    {
+        return false;
+    }
+
+    EndpointIPtr normalized = normalize(endpoint);
+
+    Lock sync(*this);
+    if(_entries.empty())
+    {
+        return false;
+    }
+
+    EntryMap::const_iterator p = _entries.find(normalized);
+    return p != _entries.end() && p->second.state == StateEjected &&
+        IceUtil::Time::now(IceUtil::Time::Monotonic) < p->second.expiration;
+}
+
+void
+IceInternal::EndpointHealth::success(const EndpointIPtr& endpoint)
+{
+    if(!isEnabled())
+    {
+        return;
+    }
+
+    EndpointIPtr normalized = normalize(endpoint);
+
+    Lock sync(*this);
+    EntryMap::iterator p = _entries.find(normalized);
+    if(p == _entries.end())
+    {
+        return;
+    }
+
+    Entry& entry = p->second;
+    entry.lastUsed = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    recovered(p->first, entry);
+    if(!tracksLatency())
+    {
+        _entries.erase(p);
+    }
+}
+
+void
+IceInternal::EndpointHealth::failure(const EndpointIPtr& endpoint, const LocalException& ex)
+{
+    if(!isEnabled() || dynamic_cast<const CommunicatorDestroyedException*>(&ex))
+    {
+        return;
+    }
+
+    EndpointIPtr normalized = normalize(endpoint);
+
+    Lock sync(*this);
+    IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    EntryMap::iterator p = _entries.find(normalized);
+    if(p == _entries.end())
+    {
+        if(_failureThreshold == 0)
+        {
+            return;
+        }
+        p = add(normalized, now);
+    }
+
+    Entry& entry = p->second;
+    entry.lastUsed = now;
+    switch(entry.state)
+    {
+        case StateHealthy:
+        {
+            if(_failureThreshold > 0 && ++entry.failures >= _failureThreshold)
+            {
+                eject(p->first, entry, ex.ice_id());
+            }
+            break;
+        }
+        case StateProbing:
+        {
+            eject(p->first, entry, ex.ice_id()); // The probe failed.
+            break;
+        }
+        case StateEjected:
+        {
+            break;
+        }
+    }
+}
+
+void
+IceInternal::EndpointHealth::latency(const EndpointIPtr& endpoint, const IceUtil::Time& latency)
+{
+    if(!tracksLatency())
+    {
+        return;
+    }
+
+    Lock sync(*this);
+    IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    EntryMap::iterator p = _entries.find(endpoint);
+    if(p == _entries.end())
+    {
+        p = add(endpoint, now);
+    }
+
+    Entry& entry = p->second;
+    entry.lastUsed = now;
+    IceUtil::Int64 t = latency.toMicroSeconds();
+    if(entry.state == StateEjected)
+    {
+        return; // Replies to requests sent before the ejection.
+    }
+    else if(entry.state == StateProbing)
+    {
+        //
+        // The probe can reuse a connection already established to the
+        // endpoint, in which case its connection establishment doesn't
+        // settle it. The first reply settles it instead.
+        //
+        if(t > _latencyThreshold)
+        {
+            eject(p->first, entry, "latency");
+        }
+        else
+        {
+            recovered(p->first, entry);
+        }
+        return;
+    }
+
+    //
+    // A reply also ends the consecutive failures of the endpoint.
+    //
+    entry.failures = 0;
+
+    entry.latency = entry.samples == 0 ? t : entry.latency + latencyWeight * (t - entry.latency);
+    if(++entry.samples >= minSamples && entry.latency > _latencyThreshold)
+    {
+        eject(p->first, entry, "latency");
+    }
+}
+
+EndpointIPtr
+IceInternal::EndpointHealth::normalize(const EndpointIPtr& endpoint)
+{
+    return endpoint->connectionId("")->compress(false)->timeout(-1);
+}
+
+void
+IceInternal::EndpointHealth::recovered(const EndpointIPtr& endpoint, Entry& entry)
+{
+    if(entry.state != StateHealthy)
+    {
+        if(_instance->traceLevels()->network >= 1)
+        {
+            Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+            out << "endpoint is healthy again\n" << endpoint->toString();
+        }
+        if(entry.observer)
+        {
+            entry.observer->detach();
+        }
+    }
+
+    //
+    // The latencies of the endpoint are kept, they're reset when it's
+    // ejected.
+    //
+    entry.state = StateHealthy;
+    entry.failures = 0;
+    entry.ejections = 0;
+    entry.observer = 0;
+}
+
+bool
+IceInternal::EndpointHealth::isAvailable(const EndpointIPtr& endpoint, const IceUtil::Time& now)
+{
+    EntryMap::iterator p = _entries.find(endpoint);
+    if(p == _entries.end())
+    {
+        return true;
+    }
+
+    Entry& entry = p->second;
+    if(entry.state == StateHealthy)
+    {
+        return true;
+    }
+    else if(now < entry.expiration)
+    {
+        return false; // Ejected or probed by another connection establishment.
+    }
+
+    //
+    // The ejection time or the previous probe expired, this connection
+    // establishment probes the endpoint. Other connection establishments
+    // skip the endpoint until the probe completes or expires.
+    //
+    if(_instance->traceLevels()->network >= 1)
+    {
+        Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+        out << "probing ejected endpoint\n" << p->first->toString();
+    }
+    entry.state = StateProbing;
+    entry.expiration = now + _ejectionTime;
+    return true;
+}
+
+void
+IceInternal::EndpointHealth::eject(const EndpointIPtr& endpoint, Entry& entry, const string& reason)
+{
+    //
+    // The ejection time grows with the number of consecutive ejections.
+    //
+    ++entry.ejections;
+    IceUtil::Time ejectionTime = _ejectionTime * entry.ejections;
+    if(ejectionTime > _maxEjectionTime)
+    {
+        ejectionTime = _maxEjectionTime;
+    }
+
+    entry.state = StateEjected;
+    entry.expiration = IceUtil::Time::now(IceUtil::Time::Monotonic) + ejectionTime;
+    entry.failures = 0;
+    entry.samples = 0;
+    entry.latency = 0;
+
+    if(_instance->traceLevels()->network >= 1)
+    {
+        Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+        out << "ejecting endpoint for " << ejectionTime.toMilliSeconds() << "ms (" << reason << ")\n"
+            << endpoint->toString();
+    }
+
+    if(!entry.observer)
+    {
+        CommunicatorObserverIPtr observer =
+            ICE_DYNAMIC_CAST(CommunicatorObserverI, _instance->initializationData().observer);
+        if(observer)
+        {
+            entry.observer = observer->getEndpointHealthObserver(endpoint);
+            if(entry.observer)
+            {
+                entry.observer->attach();
+            }
+        }
+    }
+    if(entry.observer)
+    {
+        entry.observer->failed(reason);
+    }
+}
+
+IceInternal::EndpointHealth::EntryMap::iterator
+IceInternal::EndpointHealth::add(const EndpointIPtr& endpoint, const IceUtil::Time& now)
+{
+    //
+    // Remove the healthy endpoints which are no longer used before
+    // adding a new endpoint.
+    //
+    if(now >= _nextPrune)
+    {
+        EntryMap::iterator p = _entries.begin();
+        while(p != _entries.end())
+        {
+            if(p->second.state == StateHealthy && now - p->second.lastUsed >= IceUtil::Time::seconds(idleTime))
+            {
+                _entries.erase(p++);
+            }
+            else
+            {
+                ++p;
+            }
+        }
+        _nextPrune = now + IceUtil::Time::seconds(idleTime);
+    }
+    return _entries.insert(make_pair(endpoint, Entry())).first;
+}
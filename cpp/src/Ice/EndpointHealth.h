@@ -0,0 +1,130 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_ENDPOINT_HEALTH_H
+#define ICE_ENDPOINT_HEALTH_H
+
+#include <IceUtil/Shared.h>
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Time.h>
+#include <Ice/InstanceF.h>
+#include <Ice/EndpointIF.h>
+#include <Ice/InstrumentationF.h>
+#include <Ice/Comparable.h>
+
+#include <map>
+#include <vector>
+
+namespace Ice
+{
+
+class LocalException;
+
+}
+
+namespace IceInternal
+{
+
+//
+// The health of the endpoints of a communicator. An endpoint is ejected
+// once too many consecutive connection establishments or invocations
+// time out or fail, or if its average reply latency is too high. Ejected
+// endpoints are skipped when establishing connections, unless all the
+// endpoints are ejected. Once the ejection time expires, the next
+// connection establishment probes the endpoint: the endpoint is healthy
+// again if the connection succeeds, it's ejected for longer otherwise.
+//
+class EndpointHealth : public IceUtil::Shared, private IceUtil::Mutex
+{
+public:
+
+    EndpointHealth(const InstancePtr&);
+
+    bool isEnabled() const
+    {
+        return _failureThreshold > 0 || _latencyThreshold > 0;
+    }
+
+    bool tracksLatency() const
+    {
+        return _latencyThreshold > 0;
+    }
+
+    //
+    // Remove the ejected endpoints from the given endpoints, unless all
+    // the endpoints are ejected. This grants the probe of the endpoints
+    // whose ejection time expired.
+    //
+    void filter(std::vector<EndpointIPtr>&);
+    bool isEjected(const EndpointIPtr&);
+
+    void success(const EndpointIPtr&);
+    void failure(const EndpointIPtr&, const Ice::LocalException&);
+
+    //
+    // The endpoint must be normalized, connections normalize their
+    // endpoint once rather than on every reply.
+    //
+    void latency(const EndpointIPtr&, const IceUtil::Time&);
+
+    //
+    // The endpoints are tracked without their connection id, compression
+    // and timeout.
+    //
+    static EndpointIPtr normalize(const EndpointIPtr&);
+
+private:
+
+    enum State
+    {
+        StateHealthy,
+        StateEjected,
+        StateProbing
+    };
+
+    struct Entry
+    {
+        Entry() : state(StateHealthy), failures(0), ejections(0), samples(0), latency(0)
+        {
+        }
+
+        State state;
+        int failures; // Number of consecutive failures.
+        int ejections; // Number of consecutive ejections.
+        IceUtil::Time expiration; // The end of the ejection or the deadline of the probe.
+        IceUtil::Time lastUsed;
+        int samples;
+        double latency; // Moving average of the reply latency, in microseconds.
+        Ice::Instrumentation::ObserverPtr observer; // Attached while the endpoint is ejected.
+    };
+
+#ifdef ICE_CPP11_MAPPING
+    typedef std::map<EndpointIPtr, Entry, Ice::TargetCompare<EndpointIPtr, std::less>> EntryMap;
+#else
+    typedef std::map<EndpointIPtr, Entry> EntryMap;
+#endif
+
+    bool isAvailable(const EndpointIPtr&, const IceUtil::Time&);
+    void eject(const EndpointIPtr&, Entry&, const std::string&);
+    void recovered(const EndpointIPtr&, Entry&);
+    EntryMap::iterator add(const EndpointIPtr&, const IceUtil::Time&);
+
+    const InstancePtr _instance;
+    const int _failureThreshold;
+    const IceUtil::Int64 _latencyThreshold; // In microseconds.
+    const IceUtil::Time _ejectionTime;
+    const IceUtil::Time _maxEjectionTime;
+    EntryMap _entries;
+    IceUtil::Time _nextPrune;
+};
+typedef IceUtil::Handle<EndpointHealth> EndpointHealthPtr;
+
+}
+
+#endif
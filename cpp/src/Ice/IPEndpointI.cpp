@@ -11,12 +11,15 @@
 #include <Ice/ProtocolInstance.h>
 #include <Ice/Instance.h>
 #include <Ice/LocalException.h>
+#include <Ice/TraceLevels.h>
 #include <Ice/PropertiesI.h>
 #include <Ice/LoggerUtil.h>
 #include <Ice/HashUtil.h>
 #include <Ice/NetworkProxy.h>
 #include <IceUtil/MutexPtrLock.h>
 
+#include <algorithm>
+
 using namespace std;
 using namespace Ice;
 using namespace Ice::Instrumentation;
@@ -488,27 +491,73 @@ IceInternal::IPEndpointI::IPEndpointI(const ProtocolInstancePtr& instance, Input
 
 #ifndef ICE_OS_WINRT
 
+IceInternal::EndpointHostResolver::HostResolverThread::HostResolverThread(const EndpointHostResolverPtr& resolver,
+                                                                          const string& name) :
+    IceUtil::Thread(name),
+    _resolver(resolver)
+{
+    updateObserver();
+}
+
+void
+IceInternal::EndpointHostResolver::HostResolverThread::run()
+{
+    try
+    {
+        _resolver->run(this);
+    }
+    catch(const exception& ex)
+    {
+        Error out(_resolver->_instance->initializationData().logger);
+        out << "exception in endpoint host resolver thread " << name() << ":\n" << ex;
+    }
+    catch(...)
+    {
+        Error out(_resolver->_instance->initializationData().logger);
+        out << "unknown exception in endpoint host resolver thread " << name();
+    }
+
+    _observer.detach();
+}
+
+void
+IceInternal::EndpointHostResolver::HostResolverThread::updateObserver()
+{
+    // Must be called with the resolver mutex locked
+    const CommunicatorObserverPtr& obsv = _resolver->_instance->initializationData().observer;
+    if(obsv)
+    {
+        _observer.attach(obsv->getThreadObserver("Communicator", name(), ThreadStateIdle, _observer.get()));
+    }
+}
+
+ThreadObserverPtr
+IceInternal::EndpointHostResolver::HostResolverThread::getObserver() const
+{
+    // Must be called with the resolver mutex locked
+    return _observer.get();
+}
+
 IceInternal::EndpointHostResolver::EndpointHostResolver(const InstancePtr& instance) :
-    IceUtil::Thread("Ice.HostResolver"),
     _instance(instance),
     _protocol(instance->protocolSupport()),
     _preferIPv6(instance->preferIPv6()),
-    _destroyed(false)
+    _hasPriority(instance->initializationData().properties->getProperty("Ice.ThreadPriority") != ""),
+    _priority(instance->initializationData().properties->getPropertyAsInt("Ice.ThreadPriority")),
+    _sizeMax(max(1, instance->initializationData().properties->getPropertyAsIntWithDefault(
+                        "Ice.HostResolver.SizeMax", 4))),
+    _cacheTimeout(IceUtil::Time::seconds(instance->initializationData().properties->getPropertyAsInt(
+                                             "Ice.HostResolver.CacheTimeout"))),
+    _negativeCacheTimeout(IceUtil::Time::seconds(instance->initializationData().properties->getPropertyAsInt(
+                                                     "Ice.HostResolver.NegativeCacheTimeout"))),
+    _destroyed(false),
+    _idle(0)
 {
     __setNoDelete(true);
     try
     {
-        updateObserver();
-        bool hasPriority = _instance->initializationData().properties->getProperty("Ice.ThreadPriority") != "";
-        int priority = _instance->initializationData().properties->getPropertyAsInt("Ice.ThreadPriority");
-        if(hasPriority)
-        {
-            start(0, priority);
-        }
-        else
-        {
-            start();
-        }
+        Lock sync(*this);
+        startThread();
     }
     catch(const IceUtil::Exception& ex)
     {
@@ -516,6 +565,8 @@ IceInternal::EndpointHostResolver::EndpointHostResolver(const InstancePtr& insta
             Ice::Error out(_instance->initializationData().logger);
             out << "cannot create thread for enpoint host resolver:\n" << ex;
         }
+        _threads.clear();
+        __setNoDelete(false);
         throw;
     }
     __setNoDelete(false);
@@ -527,7 +578,7 @@ IceInternal::EndpointHostResolver::resolve(const string& host, int port, Ice::En
 {
     //
     // Try to get the addresses without DNS lookup. If this doesn't work, we queue a resolve
-    // entry and the thread will take care of getting the endpoint addresses.
+    // entry and the threads will take care of getting the endpoint addresses.
     //
     NetworkProxyPtr networkProxy = _instance->networkProxy();
     if(!networkProxy)
@@ -548,12 +599,7 @@ IceInternal::EndpointHostResolver::resolve(const string& host, int port, Ice::En
         }
     }
 
-    Lock sync(*this);
-    assert(!_destroyed);
-
     ResolveEntry entry;
-    entry.host = host;
-    entry.port = port;
     entry.selType = selType;
     entry.endpoint = endpoint;
     entry.callback = callback;
@@ -568,8 +614,67 @@ IceInternal::EndpointHostResolver::resolve(const string& host, int port, Ice::En
         }
     }
 
-    _queue.push_back(entry);
-    notify();
+    HostPort key = make_pair(host, port);
+    CacheEntry cached;
+    {
+        Lock sync(*this);
+        assert(!_destroyed);
+
+        //
+        // Lookups for a host which is already queued or being resolved
+        // wait for the pending lookup rather than issuing a new one.
+        //
+        map<HostPort, vector<ResolveEntry> >::iterator p = _pending.find(key);
+        if(p != _pending.end())
+        {
+            p->second.push_back(entry);
+            return;
+        }
+
+        //
+        // The cache is only used without network proxy, the proxy can
+        // change the protocol used to resolve the host.
+        //
+        map<HostPort, CacheEntry>::iterator q = networkProxy ? _cache.end() : _cache.find(key);
+        if(q != _cache.end() && q->second.expiration <= IceUtil::Time::now(IceUtil::Time::Monotonic))
+        {
+            _cache.erase(q);
+            q = _cache.end();
+        }
+
+        if(q == _cache.end())
+        {
+            _pending[key].push_back(entry);
+            _queue.push_back(key);
+            if(_idle == 0 && static_cast<int>(_threads.size()) < _sizeMax)
+            {
+                try
+                {
+                    startThread();
+                }
+                catch(const IceUtil::Exception& ex)
+                {
+                    Error out(_instance->initializationData().logger);
+                    out << "cannot create thread for endpoint host resolver:\n" << ex;
+                }
+            }
+            notify();
+            return;
+        }
+        cached = q->second;
+    }
+
+    if(cached.addresses.empty())
+    {
+        DNSException ex(__FILE__, __LINE__);
+        ex.error = cached.error;
+        ex.host = host;
+        exception(entry, ex);
+    }
+    else
+    {
+        connectors(entry, cached.addresses, _protocol, 0);
+    }
 }
 
 void
@@ -578,31 +683,79 @@ IceInternal::EndpointHostResolver::destroy()
     Lock sync(*this);
     assert(!_destroyed);
     _destroyed = true;
-    notify();
+    notifyAll();
+}
+
+void
+IceInternal::EndpointHostResolver::joinWithAllThreads()
+{
+    //
+    // We join with all threads outside the synchronization, the
+    // threads don't add or remove threads once destroyed.
+    //
+    for(vector<HostResolverThreadPtr>::iterator p = _threads.begin(); p != _threads.end(); ++p)
+    {
+        (*p)->getThreadControl().join();
+    }
+
+    //
+    // Fail the lookups which were still queued, this also breaks the
+    // cyclic reference count between the resolver and its threads.
+    //
+    map<HostPort, vector<ResolveEntry> > pending;
+    {
+        Lock sync(*this);
+        assert(_destroyed);
+        _pending.swap(pending);
+        _queue.clear();
+        _cache.clear();
+        _threads.clear();
+    }
+
+    Ice::CommunicatorDestroyedException ex(__FILE__, __LINE__);
+    for(map<HostPort, vector<ResolveEntry> >::const_iterator p = pending.begin(); p != pending.end(); ++p)
+    {
+        for(vector<ResolveEntry>::const_iterator q = p->second.begin(); q != p->second.end(); ++q)
+        {
+            exception(*q, ex);
+        }
+    }
 }
 
 void
-IceInternal::EndpointHostResolver::run()
+IceInternal::EndpointHostResolver::updateObserver()
+{
+    Lock sync(*this);
+    for(vector<HostResolverThreadPtr>::iterator p = _threads.begin(); p != _threads.end(); ++p)
+    {
+        (*p)->updateObserver();
+    }
+}
+
+void
+IceInternal::EndpointHostResolver::run(const HostResolverThreadPtr& thread)
 {
     while(true)
     {
-        ResolveEntry r;
+        HostPort key;
         ThreadObserverPtr threadObserver;
         {
             Lock sync(*this);
+            ++_idle;
             while(!_destroyed && _queue.empty())
             {
                 wait();
             }
+            --_idle;
 
             if(_destroyed)
             {
                 break;
             }
 
-            r = _queue.front();
+            key = _queue.front();
             _queue.pop_front();
-            threadObserver = _observer.get();
+            threadObserver = thread->getObserver();
         }
 
         if(threadObserver)
@@ -610,10 +763,12 @@ IceInternal::EndpointHostResolver::run()
             threadObserver->stateChanged(ThreadStateIdle, ThreadStateInUseForOther);
         }
 
+        NetworkProxyPtr networkProxy = _instance->networkProxy();
+        ProtocolSupport protocol = _protocol;
+        vector<Address> addrs;
+        vector<ResolveEntry> entries;
         try
         {
-            NetworkProxyPtr networkProxy = _instance->networkProxy();
-            ProtocolSupport protocol = _protocol;
             if(networkProxy)
             {
                 networkProxy = networkProxy->resolveHost(_protocol);
@@ -623,66 +778,156 @@ IceInternal::EndpointHostResolver::run()
                 }
             }
 
-            r.callback->connectors(r.endpoint->connectors(getAddresses(r.host,
-                                                                       r.port,
-                                                                       protocol,
-                                                                       r.selType,
-                                                                       _preferIPv6,
-                                                                       true),
-                                                          networkProxy));
+            //
+            // The addresses are resolved with the ordered endpoint
+            // selection, they are shuffled for each random lookup
+            // waiting for this host.
+            //
+            addrs = getAddresses(key.first, key.second, protocol, Ice::Ordered, _preferIPv6, true);
+        }
+        catch(const Ice::LocalException& ex)
+        {
+            {
+                Lock sync(*this);
+                _pending[key].swap(entries);
+                _pending.erase(key);
 
-            if(threadObserver)
+                const DNSException* dnsEx = dynamic_cast<const DNSException*>(&ex);
+                if(dnsEx && !networkProxy && _negativeCacheTimeout > IceUtil::Time())
+                {
+                    IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+                    CacheEntry& cached = _cache[key];
+                    cached.expiration = now + _negativeCacheTimeout;
+                    cached.addresses.clear();
+                    cached.error = dnsEx->error;
+                }
+            }
+
+            for(vector<ResolveEntry>::const_iterator p = entries.begin(); p != entries.end(); ++p)
             {
-                threadObserver->stateChanged(ThreadStateInUseForOther, ThreadStateIdle);
+                exception(*p, ex);
             }
 
-            if(r.observer)
+            if(threadObserver)
             {
-                r.observer->detach();
+                threadObserver->stateChanged(ThreadStateInUseForOther, ThreadStateIdle);
             }
+            continue;
         }
-        catch(const Ice::LocalException& ex)
+
+        if(_instance->traceLevels()->network >= 2)
         {
-            if(threadObserver)
+            Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+            out << "resolved host `" << key.first << "' to ";
+            for(vector<Address>::const_iterator p = addrs.begin(); p != addrs.end(); ++p)
             {
-                threadObserver->stateChanged(ThreadStateInUseForOther, ThreadStateIdle);
+                out << (p == addrs.begin() ? "" : ", ") << inetAddrToString(*p);
             }
-            if(r.observer)
+        }
+
+        {
+            Lock sync(*this);
+            _pending[key].swap(entries);
+            _pending.erase(key);
+
+            if(!networkProxy && _cacheTimeout > IceUtil::Time() && !addrs.empty())
             {
-                r.observer->failed(ex.ice_id());
-                r.observer->detach();
+                //
+                // Purge the expired entries before caching the new one.
+                //
+                IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+                map<HostPort, CacheEntry>::iterator p = _cache.begin();
+                while(p != _cache.end())
+                {
+                    if(p->second.expiration <= now)
+                    {
+                        _cache.erase(p++);
+                    }
+                    else
+                    {
+                        ++p;
+                    }
+                }
+
+                CacheEntry& cached = _cache[key];
+                cached.expiration = now + _cacheTimeout;
+                cached.addresses = addrs;
+                cached.error = 0;
             }
-            r.callback->exception(ex);
         }
+
+        for(vector<ResolveEntry>::const_iterator p = entries.begin(); p != entries.end(); ++p)
+        {
+            connectors(*p, addrs, protocol, networkProxy);
+        }
+
+        if(threadObserver)
+        {
+            threadObserver->stateChanged(ThreadStateInUseForOther, ThreadStateIdle);
+        }
+    }
+}
+
+void
+IceInternal::EndpointHostResolver::startThread()
+{
+    // Must be called with the resolver mutex locked
+    ostringstream os;
+    os << "Ice.HostResolver";
+    if(!_threads.empty())
+    {
+        os << "-" << _threads.size();
+    }
+
+    HostResolverThreadPtr thread = new HostResolverThread(this, os.str());
+    if(_hasPriority)
+    {
+        thread->start(0, _priority);
+    }
+    else
+    {
+        thread->start();
     }
+    _threads.push_back(thread);
+}
 
-    for(deque<ResolveEntry>::const_iterator p = _queue.begin(); p != _queue.end(); ++p)
+void
+IceInternal::EndpointHostResolver::connectors(const ResolveEntry& entry, const vector<Address>& addresses,
+                                              ProtocolSupport protocol, const NetworkProxyPtr& networkProxy)
+{
+    try
     {
-        Ice::CommunicatorDestroyedException ex(__FILE__, __LINE__);
-        if(p->observer)
+        if(entry.selType == Ice::Random)
         {
-            p->observer->failed(ex.ice_id());
-            p->observer->detach();
+            vector<Address> addrs = addresses;
+            sortAddresses(addrs, protocol, Ice::Random, _preferIPv6);
+            entry.callback->connectors(entry.endpoint->connectors(addrs, networkProxy));
+        }
+        else
+        {
+            entry.callback->connectors(entry.endpoint->connectors(addresses, networkProxy));
         }
-        p->callback->exception(ex);
-    }
-    _queue.clear();
 
-    if(_observer)
+        if(entry.observer)
+        {
+            entry.observer->detach();
+        }
+    }
+    catch(const Ice::LocalException& ex)
     {
-        _observer.detach();
+        exception(entry, ex);
     }
 }
 
 void
-IceInternal::EndpointHostResolver::updateObserver()
+IceInternal::EndpointHostResolver::exception(const ResolveEntry& entry, const Ice::LocalException& ex)
 {
-    Lock sync(*this);
-    const CommunicatorObserverPtr& obsv = _instance->initializationData().observer;
-    if(obsv)
+    if(entry.observer)
     {
-        _observer.attach(obsv->getThreadObserver("Communicator", name(), ThreadStateIdle, _observer.get()));
+        entry.observer->failed(ex.ice_id());
+        entry.observer->detach();
     }
+    entry.callback->exception(ex);
 }
 
 #else
@@ -717,7 +962,7 @@ IceInternal::EndpointHostResolver::destroy()
 }
 
 void
-IceInternal::EndpointHostResolver::run()
+IceInternal::EndpointHostResolver::joinWithAllThreads()
 {
 }
 
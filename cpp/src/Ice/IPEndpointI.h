@@ -21,7 +21,9 @@
 #include <Ice/ObserverHelper.h>
 
 #ifndef ICE_OS_WINRT
+#   include <IceUtil/Time.h>
 #   include <deque>
+#   include <map>
 #endif
 
 namespace IceInternal
@@ -109,11 +111,30 @@ private:
 };
 
 #ifndef ICE_OS_WINRT
-class ICE_API EndpointHostResolver : public IceUtil::Thread, public IceUtil::Monitor<IceUtil::Mutex>
+class ICE_API EndpointHostResolver : public IceUtil::Shared, public IceUtil::Monitor<IceUtil::Mutex>
 #else
 class ICE_API EndpointHostResolver : public IceUtil::Shared
 #endif
 {
+#ifndef ICE_OS_WINRT
+    class HostResolverThread : public IceUtil::Thread
+    {
+    public:
+
+        HostResolverThread(const EndpointHostResolverPtr&, const std::string&);
+        virtual void run();
+
+        void updateObserver();
+        Ice::Instrumentation::ThreadObserverPtr getObserver() const;
+
+    private:
+
+        const EndpointHostResolverPtr _resolver;
+        ObserverHelperT<Ice::Instrumentation::ThreadObserver> _observer;
+    };
+    typedef IceUtil::Handle<HostResolverThread> HostResolverThreadPtr;
+#endif
+
 public:
 
     EndpointHostResolver(const InstancePtr&);
@@ -121,29 +142,57 @@ public:
     void resolve(const std::string&, int, Ice::EndpointSelectionType, const IPEndpointIPtr&,
                  const EndpointI_connectorsPtr&);
     void destroy();
+    void joinWithAllThreads();
 
-    virtual void run();
     void updateObserver();
 
 private:
 
 #ifndef ICE_OS_WINRT
+    friend class HostResolverThread;
+
     struct ResolveEntry
     {
-        std::string host;
-        int port;
         Ice::EndpointSelectionType selType;
         IPEndpointIPtr endpoint;
         EndpointI_connectorsPtr callback;
         Ice::Instrumentation::ObserverPtr observer;
     };
 
+    //
+    // A cached lookup result. The addresses are sorted with the
+    // ordered endpoint selection, they are shuffled again for random
+    // endpoint selection. If the lookup failed, the addresses are
+    // empty and error is the DNS error.
+    //
+    struct CacheEntry
+    {
+        IceUtil::Time expiration;
+        std::vector<Address> addresses;
+        int error;
+    };
+
+    typedef std::pair<std::string, int> HostPort;
+
+    void run(const HostResolverThreadPtr&);
+    void startThread();
+    void connectors(const ResolveEntry&, const std::vector<Address>&, ProtocolSupport, const NetworkProxyPtr&);
+    void exception(const ResolveEntry&, const Ice::LocalException&);
+
     const InstancePtr _instance;
     const IceInternal::ProtocolSupport _protocol;
     const bool _preferIPv6;
+    const bool _hasPriority;
+    const int _priority;
+    const int _sizeMax; // Maximum number of concurrent lookups.
+    const IceUtil::Time _cacheTimeout;
+    const IceUtil::Time _negativeCacheTimeout;
     bool _destroyed;
-    std::deque<ResolveEntry> _queue;
-    ObserverHelperT<Ice::Instrumentation::ThreadObserver> _observer;
+    int _idle; // Number of threads waiting for a lookup.
+    std::vector<HostResolverThreadPtr> _threads;
+    std::deque<HostPort> _queue;
+    std::map<HostPort, std::vector<ResolveEntry> > _pending; // Queued or in progress lookups.
+    std::map<HostPort, CacheEntry> _cache;
 #else
     const InstancePtr _instance;
 #endif
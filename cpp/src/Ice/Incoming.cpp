@@ -145,6 +145,30 @@ IncomingBase::writeParamEncaps(const Byte* v, Ice::Int sz, bool ok)
     }
 }
 
+void
+IncomingBase::adoptReplyMessage(InputStream& reply, bool ok)
+{
+    if(!ok)
+    {
+        _observer.userException();
+    }
+
+    if(_response)
+    {
+        //
+        // The reply message received for a forwarded invocation has the
+        // same layout as the reply we send, we adopt its buffer and only
+        // patch the request ID and the compression status of the header.
+        //
+        assert(_current.encoding >= Ice::Encoding_1_0); // Encoding for reply is known.
+        assert(reply.b.size() >= headerSize + 5);
+        _os.b.swap(reply.b);
+        reply.i = reply.b.begin();
+        _os.b[9] = 0;
+        _os.rewrite(_current.requestId, headerSize);
+    }
+}
+
 #ifdef ICE_CPP11_MAPPING
 void
 IceInternal::IncomingBase::setMarshaledResult(const Ice::MarshaledResult& result)
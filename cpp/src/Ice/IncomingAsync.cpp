@@ -11,6 +11,7 @@
 #include <Ice/ServantLocator.h>
 #include <Ice/Object.h>
 #include <Ice/ConnectionI.h>
+#include <Ice/OutgoingAsync.h>
 #include <Ice/LocalException.h>
 #include <Ice/Protocol.h>
 #include <Ice/Instance.h>
@@ -36,6 +37,14 @@ Ice::AMD_Object_ice_invoke::~AMD_Object_ice_invoke()
 {
     // Out of line to avoid weak vtable
 }
+
+void
+Ice::AMD_Object_ice_invoke::ice_response(const AsyncResultPtr& result)
+{
+    pair<const Byte*, const Byte*> outEncaps;
+    bool ok = result->getProxy()->___end_ice_invoke(outEncaps, result);
+    ice_response(ok, outEncaps);
+}
 #endif
 
 namespace
@@ -232,4 +241,14 @@ IceAsync::Ice::AMD_Object_ice_invoke::ice_response(bool ok, const pair<const Byt
     writeParamEncaps(outEncaps.first, static_cast<Int>(outEncaps.second - outEncaps.first), ok);
     completed();
 }
+
+void
+IceAsync::Ice::AMD_Object_ice_invoke::ice_response(const AsyncResultPtr& result)
+{
+    OutgoingAsyncBase* outAsync = dynamic_cast<OutgoingAsyncBase*>(result.get());
+    assert(outAsync);
+    bool ok = outAsync->__wait(); // Raises the local exception if the invocation failed.
+    adoptReplyMessage(*outAsync->getIs(), ok);
+    completed();
+}
 #endif
@@ -30,6 +30,8 @@
 #include <Ice/IPEndpointI.h> // For EndpointHostResolver
 #include <Ice/WSEndpoint.h>
 #include <Ice/RequestHandlerFactory.h>
+#include <Ice/RequestHedging.h>
+#include <Ice/EndpointHealth.h>
 #include <Ice/RetryQueue.h>
 #include <Ice/DynamicLibrary.h>
 #include <Ice/PluginManagerI.h>
@@ -371,6 +373,34 @@ IceInternal::Instance::requestHandlerFactory() const
     return _requestHandlerFactory;
 }
 
+RequestHedgingPtr
+IceInternal::Instance::requestHedging() const
+{
+    Lock sync(*this);
+
+    if(_state == StateDestroyed)
+    {
+        throw CommunicatorDestroyedException(__FILE__, __LINE__);
+    }
+
+    assert(_requestHedging);
+    return _requestHedging;
+}
+
+EndpointHealthPtr
+IceInternal::Instance::endpointHealth() const
+{
+    Lock sync(*this);
+
+    if(_state == StateDestroyed)
+    {
+        throw CommunicatorDestroyedException(__FILE__, __LINE__);
+    }
+
+    assert(_endpointHealth);
+    return _endpointHealth;
+}
+
 ProxyFactoryPtr
 IceInternal::Instance::proxyFactory() const
 {
@@ -1220,6 +1250,10 @@ IceInternal::Instance::Instance(const CommunicatorPtr& communicator, const Initi
 
         _requestHandlerFactory = new RequestHandlerFactory(this);
 
+        _requestHedging = new RequestHedging(this);
+
+        _endpointHealth = new EndpointHealth(this);
+
         _proxyFactory = new ProxyFactory(this);
 
         const bool isIPv6Supported = IceInternal::isIPv6Supported();
@@ -1663,7 +1697,7 @@ IceInternal::Instance::destroy()
 #ifndef ICE_OS_WINRT
     if(_endpointHostResolver)
     {
-        _endpointHostResolver->getThreadControl().join();
+        _endpointHostResolver->joinWithAllThreads();
     }
 #endif
 
@@ -1722,6 +1756,8 @@ IceInternal::Instance::destroy()
 
         _referenceFactory = 0;
         _requestHandlerFactory = 0;
+        _requestHedging = 0;
+        _endpointHealth = 0;
         _proxyFactory = 0;
         _routerManager = 0;
         _locatorManager = 0;
@@ -63,6 +63,12 @@ ICE_DEFINE_PTR(MetricsAdminIPtr, MetricsAdminI);
 class RequestHandlerFactory;
 typedef IceUtil::Handle<RequestHandlerFactory> RequestHandlerFactoryPtr;
 
+class RequestHedging;
+typedef IceUtil::Handle<RequestHedging> RequestHedgingPtr;
+
+class EndpointHealth;
+typedef IceUtil::Handle<EndpointHealth> EndpointHealthPtr;
+
 //
 // Structure to track warnings for attempts to set socket buffer sizes
 //
@@ -93,6 +99,8 @@ public:
     LocatorManagerPtr locatorManager() const;
     ReferenceFactoryPtr referenceFactory() const;
     RequestHandlerFactoryPtr requestHandlerFactory() const;
+    RequestHedgingPtr requestHedging() const;
+    EndpointHealthPtr endpointHealth() const;
     ProxyFactoryPtr proxyFactory() const;
     OutgoingConnectionFactoryPtr outgoingConnectionFactory() const;
     ObjectAdapterFactoryPtr objectAdapterFactory() const;
@@ -185,6 +193,8 @@ private:
     LocatorManagerPtr _locatorManager;
     ReferenceFactoryPtr _referenceFactory;
     RequestHandlerFactoryPtr _requestHandlerFactory;
+    RequestHedgingPtr _requestHedging;
+    EndpointHealthPtr _endpointHealth;
     ProxyFactoryPtr _proxyFactory;
     OutgoingConnectionFactoryPtr _outgoingConnectionFactory;
     ObjectAdapterFactoryPtr _objectAdapterFactory;
@@ -15,6 +15,8 @@
 #include <Ice/LocalException.h>
 #include <Ice/Communicator.h>
 #include <Ice/LoggerUtil.h>
+#include <Ice/Reference.h>
+#include <Ice/Instance.h>
 
 using namespace std;
 using namespace Ice;
@@ -772,6 +774,71 @@ private:
 
 EndpointHelper::Attributes EndpointHelper::attributes;
 
+class LocatorCacheHelper : public MetricsHelperT<Metrics>
+{
+public:
+
+    class Attributes : public AttributeResolverT<LocatorCacheHelper>
+    {
+    public:
+
+        Attributes()
+        {
+            add("parent", &LocatorCacheHelper::getParent);
+            add("id", &LocatorCacheHelper::getResult);
+            add("result", &LocatorCacheHelper::getResult);
+            add("target", &LocatorCacheHelper::getTarget);
+        }
+    };
+    static Attributes attributes;
+
+    LocatorCacheHelper(const ReferencePtr& ref, const string& result) : _reference(ref), _result(result)
+    {
+    }
+
+    virtual string operator()(const string& attribute) const
+    {
+        return attributes(this, attribute);
+    }
+
+    string
+    getParent() const
+    {
+        return "Communicator";
+    }
+
+    const string&
+    getResult() const
+    {
+        return _result;
+    }
+
+    const string&
+    getTarget() const
+    {
+        if(_target.empty())
+        {
+            if(_reference->isWellKnown())
+            {
+                _target = identityToString(_reference->getIdentity(), _reference->getInstance()->toStringMode());
+            }
+            else
+            {
+                _target = _reference->getAdapterId();
+            }
+        }
+        return _target;
+    }
+
+private:
+
+    const ReferencePtr& _reference;
+    const string& _result;
+    mutable string _target;
+};
+
+LocatorCacheHelper::Attributes LocatorCacheHelper::attributes;
+
 }
 
 void
@@ -916,7 +983,9 @@ CommunicatorObserverI::CommunicatorObserverI(const InitializationData& initData)
     _invocations(_metrics, "Invocation"),
     _threads(_metrics, "Thread"),
     _connects(_metrics, "ConnectionEstablishment"),
-    _endpointLookups(_metrics, "EndpointLookup")
+    _endpointLookups(_metrics, "EndpointLookup"),
+    _locatorCache(_metrics, "LocatorCache"),
+    _endpointHealth(_metrics, "EndpointHealth")
 {
     _invocations.registerSubMap<RemoteMetrics>("Remote", &InvocationMetrics::remotes);
     _invocations.registerSubMap<CollocatedMetrics>("Collocated", &InvocationMetrics::collocated);
@@ -979,6 +1048,42 @@ CommunicatorObserverI::getEndpointLookupObserver(const EndpointPtr& endpt)
     return ICE_NULLPTR;
 }
 
+ObserverPtr
+CommunicatorObserverI::getLocatorCacheObserver(const ReferencePtr& ref, const string& result)
+{
+    if(_locatorCache.isEnabled())
+    {
+        try
+        {
+            return _locatorCache.getObserverWithDelegate(LocatorCacheHelper(ref, result), ObserverPtr());
+        }
+        catch(const exception& ex)
+        {
+            Error error(_metrics->getLogger());
+            error << "unexpected exception trying to obtain observer:\n" << ex;
+        }
+    }
+    return ICE_NULLPTR;
+}
+
+ObserverPtr
+CommunicatorObserverI::getEndpointHealthObserver(const EndpointPtr& endpt)
+{
+    if(_endpointHealth.isEnabled())
+    {
+        try
+        {
+            return _endpointHealth.getObserverWithDelegate(EndpointHelper(endpt), ObserverPtr());
+        }
+        catch(const exception& ex)
+        {
+            Error error(_metrics->getLogger());
+            error << "unexpected exception trying to obtain observer:\n" << ex;
+        }
+    }
+    return ICE_NULLPTR;
+}
+
 ConnectionObserverPtr
 CommunicatorObserverI::getConnectionObserver(const ConnectionInfoPtr& con,
                                              const EndpointPtr& endpt,
@@ -1095,6 +1200,8 @@ CommunicatorObserverI::destroy()
     _threads.destroy();
     _connects.destroy();
     _endpointLookups.destroy();
+    _locatorCache.destroy();
+    _endpointHealth.destroy();
 
     _metrics->destroy();
 }
@@ -12,6 +12,7 @@
 
 #include <Ice/MetricsObserverI.h>
 #include <Ice/Connection.h>
+#include <Ice/ReferenceF.h>
 
 namespace IceInternal
 {
@@ -238,6 +239,18 @@ public:
 
     virtual Ice::Instrumentation::DispatchObserverPtr getDispatchObserver(const Ice::Current&, Ice::Int);
 
+    //
+    // Returns an observer for a lookup of the locator cache, the
+    // result is "hit", "miss", "stale" or "refresh".
+    //
+    Ice::Instrumentation::ObserverPtr getLocatorCacheObserver(const IceInternal::ReferencePtr&, const std::string&);
+
+    //
+    // Returns an observer for the ejection of an endpoint, the observer
+    // is attached while the endpoint is ejected.
+    //
+    Ice::Instrumentation::ObserverPtr getEndpointHealthObserver(const Ice::EndpointPtr&);
+
     const IceInternal::MetricsAdminIPtr& getFacet() const;
 
     void destroy();
@@ -253,6 +266,8 @@ private:
     ObserverFactoryWithDelegateT<ThreadObserverI> _threads;
     ObserverFactoryWithDelegateT<ObserverI> _connects;
     ObserverFactoryWithDelegateT<ObserverI> _endpointLookups;
+    ObserverFactoryWithDelegateT<ObserverI> _locatorCache;
+    ObserverFactoryWithDelegateT<ObserverI> _endpointHealth;
 };
 ICE_DEFINE_PTR(CommunicatorObserverIPtr, CommunicatorObserverI);
 
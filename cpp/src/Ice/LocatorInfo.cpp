@@ -19,6 +19,8 @@
 #include <Ice/Functional.h>
 #include <Ice/Properties.h>
 #include <Ice/Comparable.h>
+#include <Ice/InstrumentationI.h>
+#include <IceUtil/Random.h>
 #include <iterator>
 
 using namespace std;
@@ -129,6 +131,8 @@ public:
 
 IceInternal::LocatorManager::LocatorManager(const Ice::PropertiesPtr& properties) :
     _background(properties->getPropertyAsInt("Ice.BackgroundLocatorCacheUpdates") > 0),
+    _refreshAhead(properties->getPropertyAsInt("Ice.LocatorCacheRefreshAhead")),
+    _jitter(properties->getPropertyAsInt("Ice.LocatorCacheJitter")),
     _tableHint(_table.end())
 {
 }
@@ -193,7 +197,7 @@ IceInternal::LocatorManager::get(const LocatorPrxPtr& loc)
         {
             t = _locatorTables.insert(_locatorTables.begin(),
                                       pair<const pair<Identity, EncodingVersion>, LocatorTablePtr>(
-                                          locatorKey, new LocatorTable()));
+                                          locatorKey, new LocatorTable(_refreshAhead, _jitter)));
         }
 
         _tableHint = _table.insert(_tableHint,
@@ -209,7 +213,10 @@ IceInternal::LocatorManager::get(const LocatorPrxPtr& loc)
     return _tableHint->second;
 }
 
-IceInternal::LocatorTable::LocatorTable()
+IceInternal::LocatorTable::LocatorTable(int refreshAhead, int jitter) :
+    _refreshAhead(refreshAhead > 0 && refreshAhead < 100 ? refreshAhead : 0),
+    _jitter(jitter > 0 ? min(jitter, 100) : 0),
+    _random(_jitter > 0 ? IceUtilInternal::random() | 1 : 1)
 {
 }
 
@@ -223,7 +230,8 @@ IceInternal::LocatorTable::clear()
 }
 
 bool
-IceInternal::LocatorTable::getAdapterEndpoints(const string& adapter, int ttl, vector<EndpointIPtr>& endpoints)
+IceInternal::LocatorTable::getAdapterEndpoints(const string& adapter, int ttl, vector<EndpointIPtr>& endpoints,
+                                               bool& refresh)
 {
     if(ttl == 0) // No locator cache.
     {
@@ -232,12 +240,12 @@ IceInternal::LocatorTable::getAdapterEndpoints(const string& adapter, int ttl, v
 
     IceUtil::Mutex::Lock sync(*this);
 
-    map<string, pair<IceUtil::Time, vector<EndpointIPtr> > >::iterator p = _adapterEndpointsMap.find(adapter);
+    map<string, pair<CacheTime, vector<EndpointIPtr> > >::iterator p = _adapterEndpointsMap.find(adapter);
 
     if(p != _adapterEndpointsMap.end())
     {
         endpoints = p->second.second;
-        return checkTTL(p->second.first, ttl);
+        return checkTTL(p->second.first, ttl, refresh);
     }
     return false;
 }
@@ -247,16 +255,15 @@ IceInternal::LocatorTable::addAdapterEndpoints(const string& adapter, const vect
 {
     IceUtil::Mutex::Lock sync(*this);
 
-    map<string, pair<IceUtil::Time, vector<EndpointIPtr> > >::iterator p = _adapterEndpointsMap.find(adapter);
+    map<string, pair<CacheTime, vector<EndpointIPtr> > >::iterator p = _adapterEndpointsMap.find(adapter);
 
     if(p != _adapterEndpointsMap.end())
     {
-        p->second = make_pair(IceUtil::Time::now(IceUtil::Time::Monotonic), endpoints);
+        p->second = make_pair(now(), endpoints);
     }
     else
     {
-        _adapterEndpointsMap.insert(
-            make_pair(adapter, make_pair(IceUtil::Time::now(IceUtil::Time::Monotonic), endpoints)));
+        _adapterEndpointsMap.insert(make_pair(adapter, make_pair(now(), endpoints)));
     }
 }
 
@@ -265,7 +272,7 @@ IceInternal::LocatorTable::removeAdapterEndpoints(const string& adapter)
 {
     IceUtil::Mutex::Lock sync(*this);
 
-    map<string, pair<IceUtil::Time, vector<EndpointIPtr> > >::iterator p = _adapterEndpointsMap.find(adapter);
+    map<string, pair<CacheTime, vector<EndpointIPtr> > >::iterator p = _adapterEndpointsMap.find(adapter);
     if(p == _adapterEndpointsMap.end())
     {
         return vector<EndpointIPtr>();
@@ -279,7 +286,21 @@ IceInternal::LocatorTable::removeAdapterEndpoints(const string& adapter)
 }
 
 bool
-IceInternal::LocatorTable::getObjectReference(const Identity& id, int ttl, ReferencePtr& ref)
+IceInternal::LocatorTable::peekAdapterEndpoints(const string& adapter, vector<EndpointIPtr>& endpoints) const
+{
+    IceUtil::Mutex::Lock sync(*this);
+
+    map<string, pair<CacheTime, vector<EndpointIPtr> > >::const_iterator p = _adapterEndpointsMap.find(adapter);
+    if(p == _adapterEndpointsMap.end())
+    {
+        return false;
+    }
+    endpoints = p->second.second;
+    return true;
+}
+
+bool
+IceInternal::LocatorTable::getObjectReference(const Identity& id, int ttl, ReferencePtr& ref, bool& refresh)
 {
     if(ttl == 0) // No locator cache
     {
@@ -288,12 +309,12 @@ IceInternal::LocatorTable::getObjectReference(const Identity& id, int ttl, Refer
 
     IceUtil::Mutex::Lock sync(*this);
 
-    map<Identity, pair<IceUtil::Time, ReferencePtr> >::iterator p = _objectMap.find(id);
+    map<Identity, pair<CacheTime, ReferencePtr> >::iterator p = _objectMap.find(id);
 
     if(p != _objectMap.end())
     {
         ref = p->second.second;
-        return checkTTL(p->second.first, ttl);
+        return checkTTL(p->second.first, ttl, refresh);
     }
     return false;
 }
@@ -303,15 +324,15 @@ IceInternal::LocatorTable::addObjectReference(const Identity& id, const Referenc
 {
     IceUtil::Mutex::Lock sync(*this);
 
-    map<Identity, pair<IceUtil::Time, ReferencePtr> >::iterator p = _objectMap.find(id);
+    map<Identity, pair<CacheTime, ReferencePtr> >::iterator p = _objectMap.find(id);
 
     if(p != _objectMap.end())
     {
-        p->second = make_pair(IceUtil::Time::now(IceUtil::Time::Monotonic), ref);
+        p->second = make_pair(now(), ref);
     }
     else
     {
-        _objectMap.insert(make_pair(id, make_pair(IceUtil::Time::now(IceUtil::Time::Monotonic), ref)));
+        _objectMap.insert(make_pair(id, make_pair(now(), ref)));
     }
 }
 
@@ -320,7 +341,7 @@ IceInternal::LocatorTable::removeObjectReference(const Identity& id)
 {
     IceUtil::Mutex::Lock sync(*this);
 
-    map<Identity, pair<IceUtil::Time, ReferencePtr> >::iterator p = _objectMap.find(id);
+    map<Identity, pair<CacheTime, ReferencePtr> >::iterator p = _objectMap.find(id);
     if(p == _objectMap.end())
     {
         return 0;
@@ -332,17 +353,91 @@ IceInternal::LocatorTable::removeObjectReference(const Identity& id)
 }
 
 bool
-IceInternal::LocatorTable::checkTTL(const IceUtil::Time& time, int ttl) const
+IceInternal::LocatorTable::peekObjectReference(const Identity& id, ReferencePtr& ref) const
+{
+    IceUtil::Mutex::Lock sync(*this);
+
+    map<Identity, pair<CacheTime, ReferencePtr> >::const_iterator p = _objectMap.find(id);
+    if(p == _objectMap.end())
+    {
+        return false;
+    }
+    ref = p->second.second;
+    return true;
+}
+
+void
+IceInternal::LocatorTable::refreshAdapterEndpointsFailed(const string& adapter)
+{
+    IceUtil::Mutex::Lock sync(*this);
+
+    map<string, pair<CacheTime, vector<EndpointIPtr> > >::iterator p = _adapterEndpointsMap.find(adapter);
+    if(p != _adapterEndpointsMap.end())
+    {
+        p->second.first.refreshing = false;
+    }
+}
+
+void
+IceInternal::LocatorTable::refreshObjectReferenceFailed(const Identity& id)
+{
+    IceUtil::Mutex::Lock sync(*this);
+
+    map<Identity, pair<CacheTime, ReferencePtr> >::iterator p = _objectMap.find(id);
+    if(p != _objectMap.end())
+    {
+        p->second.first.refreshing = false;
+    }
+}
+
+IceInternal::LocatorTable::CacheTime
+IceInternal::LocatorTable::now() const
+{
+    //
+    // Must be called with the lock held. The jitter uses a xorshift
+    // generator seeded once, IceUtilInternal::random() reads
+    // /dev/urandom under a global mutex.
+    //
+    CacheTime t;
+    t.time = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    t.ttlFactor = 1000;
+    if(_jitter > 0)
+    {
+        _random ^= _random << 13;
+        _random ^= _random >> 17;
+        _random ^= _random << 5;
+        t.ttlFactor -= static_cast<int>(_random % static_cast<unsigned int>(_jitter * 10 + 1));
+    }
+    t.refreshing = false;
+    return t;
+}
+
+bool
+IceInternal::LocatorTable::checkTTL(CacheTime& time, int ttl, bool& refresh) const
 {
     assert(ttl != 0);
     if (ttl < 0) // TTL = infinite
     {
         return true;
     }
-    else
+
+    IceUtil::Time age = IceUtil::Time::now(IceUtil::Time::Monotonic) - time.time;
+    IceUtil::Time timeout = IceUtil::Time::milliSeconds(static_cast<IceUtil::Int64>(ttl) * time.ttlFactor);
+    if(age > timeout)
+    {
+        return false;
+    }
+
+    //
+    // Refresh the entry ahead of its expiration if it's older than the
+    // refresh ahead percentage of its TTL.
+    //
+    if(_refreshAhead > 0 && !time.refreshing && age * 100 > timeout * _refreshAhead)
     {
-        return IceUtil::Time::now(IceUtil::Time::Monotonic) - time <= IceUtil::Time::seconds(ttl);
+        time.refreshing = true;
+        refresh = true;
     }
+    return true;
 }
 
 void
@@ -611,34 +706,57 @@ IceInternal::LocatorInfo::getEndpoints(const ReferencePtr& ref, const ReferenceP
 {
     assert(ref->isIndirect());
     vector<EndpointIPtr> endpoints;
+    bool refresh = false;
     if(!ref->isWellKnown())
     {
-        if(!_table->getAdapterEndpoints(ref->getAdapterId(), ttl, endpoints))
+        if(!_table->getAdapterEndpoints(ref->getAdapterId(), ttl, endpoints, refresh))
         {
             if(_background && !endpoints.empty())
             {
+                observeLookup(ref, "stale");
                 getAdapterRequest(ref)->addCallback(ref, wellKnownRef, ttl, 0);
             }
             else
             {
+                observeLookup(ref, "miss");
                 return getAdapterRequest(ref)->getEndpoints(ref, wellKnownRef, ttl, cached);
             }
         }
+        else if(refresh)
+        {
+            observeLookup(ref, "refresh");
+            getAdapterRequest(ref)->addCallback(ref, wellKnownRef, ttl, 0);
+        }
+        else
+        {
+            observeLookup(ref, "hit");
+        }
     }
     else
     {
         ReferencePtr r;
-        if(!_table->getObjectReference(ref->getIdentity(), ttl, r))
+        if(!_table->getObjectReference(ref->getIdentity(), ttl, r, refresh))
         {
             if(_background && r)
             {
+                observeLookup(ref, "stale");
                 getObjectRequest(ref)->addCallback(ref, 0, ttl, 0);
             }
             else
             {
+                observeLookup(ref, "miss");
                 return getObjectRequest(ref)->getEndpoints(ref, 0, ttl, cached);
             }
         }
+        else if(refresh)
+        {
+            observeLookup(ref, "refresh");
+            getObjectRequest(ref)->addCallback(ref, 0, ttl, 0);
+        }
+        else
+        {
+            observeLookup(ref, "hit");
+        }
 
         if(!r->isIndirect())
         {
@@ -667,36 +785,59 @@ IceInternal::LocatorInfo::getEndpointsWithCallback(const ReferencePtr& ref,
 {
     assert(ref->isIndirect());
     vector<EndpointIPtr> endpoints;
+    bool refresh = false;
     if(!ref->isWellKnown())
     {
-        if(!_table->getAdapterEndpoints(ref->getAdapterId(), ttl, endpoints))
+        if(!_table->getAdapterEndpoints(ref->getAdapterId(), ttl, endpoints, refresh))
         {
             if(_background && !endpoints.empty())
             {
+                observeLookup(ref, "stale");
                 getAdapterRequest(ref)->addCallback(ref, wellKnownRef, ttl, 0);
             }
             else
             {
+                observeLookup(ref, "miss");
                 getAdapterRequest(ref)->addCallback(ref, wellKnownRef, ttl, callback);
                 return;
             }
         }
+        else if(refresh)
+        {
+            observeLookup(ref, "refresh");
+            getAdapterRequest(ref)->addCallback(ref, wellKnownRef, ttl, 0);
+        }
+        else
+        {
+            observeLookup(ref, "hit");
+        }
     }
     else
     {
         ReferencePtr r;
-        if(!_table->getObjectReference(ref->getIdentity(), ttl, r))
+        if(!_table->getObjectReference(ref->getIdentity(), ttl, r, refresh))
         {
             if(_background && r)
             {
+                observeLookup(ref, "stale");
                 getObjectRequest(ref)->addCallback(ref, 0, ttl, 0);
             }
             else
             {
+                observeLookup(ref, "miss");
                 getObjectRequest(ref)->addCallback(ref, 0, ttl, callback);
                 return;
             }
         }
+        else if(refresh)
+        {
+            observeLookup(ref, "refresh");
+            getObjectRequest(ref)->addCallback(ref, 0, ttl, 0);
+        }
+        else
+        {
+            observeLookup(ref, "hit");
+        }
 
         if(!r->isIndirect())
         {
@@ -720,6 +861,40 @@ IceInternal::LocatorInfo::getEndpointsWithCallback(const ReferencePtr& ref,
     }
 }
 
+vector<EndpointIPtr>
+IceInternal::LocatorInfo::getCachedEndpoints(const ReferencePtr& ref, int ttl)
+{
+    //
+    // Return the endpoints from the locator cache, even if they are
+    // stale, without locating the reference or refreshing the cache.
+    //
+    assert(ref->isIndirect());
+    vector<EndpointIPtr> endpoints;
+    if(ttl == 0) // No locator cache.
+    {
+        return endpoints;
+    }
+
+    if(!ref->isWellKnown())
+    {
+        _table->peekAdapterEndpoints(ref->getAdapterId(), endpoints);
+    }
+    else
+    {
+        ReferencePtr r;
+        _table->peekObjectReference(ref->getIdentity(), r);
+        if(r && !r->isIndirect())
+        {
+            endpoints = r->getEndpoints();
+        }
+        else if(r && !r->isWellKnown())
+        {
+            _table->peekAdapterEndpoints(r->getAdapterId(), endpoints);
+        }
+    }
+    return endpoints;
+}
+
 void
 IceInternal::LocatorInfo::clearCache(const ReferencePtr& ref)
 {
@@ -819,6 +994,27 @@ IceInternal::LocatorInfo::getEndpointsException(const ReferencePtr& ref, const I
     }
 }
 
+void
+IceInternal::LocatorInfo::observeLookup(const ReferencePtr& ref, const string& result)
+{
+    const Ice::Instrumentation::CommunicatorObserverPtr& obsv = ref->getInstance()->initializationData().observer;
+    if(!obsv)
+    {
+        return;
+    }
+
+    CommunicatorObserverIPtr observer = ICE_DYNAMIC_CAST(CommunicatorObserverI, obsv);
+    if(observer)
+    {
+        Ice::Instrumentation::ObserverPtr o = observer->getLocatorCacheObserver(ref, result);
+        if(o)
+        {
+            o->attach();
+            o->detach();
+        }
+    }
+}
+
 void
 IceInternal::LocatorInfo::getEndpointsTrace(const ReferencePtr& ref,
                                             const vector<EndpointIPtr>& endpoints,
@@ -946,6 +1142,10 @@ IceInternal::LocatorInfo::finishRequest(const ReferencePtr& ref,
         {
             _table->removeAdapterEndpoints(ref->getAdapterId());
         }
+        else
+        {
+            _table->refreshAdapterEndpointsFailed(ref->getAdapterId());
+        }
 
         IceUtil::Mutex::Lock sync(*this);
         assert(_adapterRequests.find(ref->getAdapterId()) != _adapterRequests.end());
@@ -961,6 +1161,10 @@ IceInternal::LocatorInfo::finishRequest(const ReferencePtr& ref,
         {
             _table->removeObjectReference(ref->getIdentity());
         }
+        else
+        {
+            _table->refreshObjectReferenceFailed(ref->getIdentity());
+        }
 
         IceUtil::Mutex::Lock sync(*this);
         assert(_objectRequests.find(ref->getIdentity()) != _objectRequests.end());
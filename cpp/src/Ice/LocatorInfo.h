@@ -44,6 +44,8 @@ public:
 private:
 
     const bool _background;
+    const int _refreshAhead;
+    const int _jitter;
 
 #ifdef ICE_CPP11_MAPPING
     using LocatorInfoTable = std::map<std::shared_ptr<Ice::LocatorPrx>,
@@ -62,24 +64,61 @@ class LocatorTable : public IceUtil::Shared, public IceUtil::Mutex
 {
 public:
 
-    LocatorTable();
+    LocatorTable(int, int);
 
     void clear();
 
-    bool getAdapterEndpoints(const std::string&, int, ::std::vector<EndpointIPtr>&);
+    //
+    // The get methods return false if the entry isn't cached or if it
+    // expired. If the entry is valid but should be refreshed ahead of
+    // its expiration, the refresh parameter is set to true. It's only
+    // set once for a given entry.
+    //
+    bool getAdapterEndpoints(const std::string&, int, ::std::vector<EndpointIPtr>&, bool&);
     void addAdapterEndpoints(const std::string&, const ::std::vector<EndpointIPtr>&);
     ::std::vector<EndpointIPtr> removeAdapterEndpoints(const std::string&);
 
-    bool getObjectReference(const Ice::Identity&, int, ReferencePtr&);
+    bool getObjectReference(const Ice::Identity&, int, ReferencePtr&, bool&);
     void addObjectReference(const Ice::Identity&, const ReferencePtr&);
     ReferencePtr removeObjectReference(const Ice::Identity&);
 
+    //
+    // Get the cached entry even if it expired, without triggering a
+    // refresh.
+    //
+    bool peekAdapterEndpoints(const std::string&, ::std::vector<EndpointIPtr>&) const;
+    bool peekObjectReference(const Ice::Identity&, ReferencePtr&) const;
+
+    //
+    // Called when a locator request didn't update the entry, the next
+    // lookup can trigger a refresh again.
+    //
+    void refreshAdapterEndpointsFailed(const std::string&);
+    void refreshObjectReferenceFailed(const Ice::Identity&);
+
 private:
 
-    bool checkTTL(const IceUtil::Time&, int) const;
+    //
+    // The time an entry was added to the table. The TTL of an entry is
+    // reduced by a random jitter to spread the expiration of entries
+    // added at the same time.
+    //
+    struct CacheTime
+    {
+        IceUtil::Time time;
+        int ttlFactor; // In per mille of the TTL.
+        bool refreshing;
+    };
 
-    std::map<std::string, std::pair<IceUtil::Time, std::vector<EndpointIPtr> > > _adapterEndpointsMap;
-    std::map<Ice::Identity, std::pair<IceUtil::Time, ReferencePtr> > _objectMap;
+    CacheTime now() const;
+    bool checkTTL(CacheTime&, int, bool&) const;
+
+    const int _refreshAhead;
+    const int _jitter;
+    mutable unsigned int _random; // State of the xorshift generator used for the jitter.
+
+    std::map<std::string, std::pair<CacheTime, std::vector<EndpointIPtr> > > _adapterEndpointsMap;
+    std::map<Ice::Identity, std::pair<CacheTime, ReferencePtr> > _objectMap;
 };
 
 class LocatorInfo : public IceUtil::Shared, public IceUtil::Mutex
@@ -171,11 +210,14 @@ public:
     }
     void getEndpointsWithCallback(const ReferencePtr&, const ReferencePtr&, int, const GetEndpointsCallbackPtr&);
 
+    std::vector<EndpointIPtr> getCachedEndpoints(const ReferencePtr&, int);
+
     void clearCache(const ReferencePtr&);
 
 private:
 
     void getEndpointsException(const ReferencePtr&, const Ice::Exception&);
+    void observeLookup(const ReferencePtr&, const std::string&);
     void getEndpointsTrace(const ReferencePtr&, const std::vector<EndpointIPtr>&, bool);
     void trace(const std::string&, const ReferencePtr&, const std::vector<EndpointIPtr>&);
 
@@ -125,28 +125,6 @@ struct RandomNumberGenerator : public std::unary_function<ptrdiff_t, ptrdiff_t>
     }
 };
 
-void
-sortAddresses(vector<Address>& addrs, ProtocolSupport protocol, Ice::EndpointSelectionType selType, bool preferIPv6)
-{
-    if(selType == Ice::Random)
-    {
-        RandomNumberGenerator rng;
-        random_shuffle(addrs.begin(), addrs.end(), rng);
-    }
-
-    if(protocol == EnableBoth)
-    {
-        if(preferIPv6)
-        {
-            stable_partition(addrs.begin(), addrs.end(), AddressIsIPv6());
-        }
-        else
-        {
-            stable_partition(addrs.begin(), addrs.end(), not1(AddressIsIPv6()));
-        }
-    }
-}
-
 void
 setTcpNoDelay(SOCKET fd)
 {
@@ -1023,6 +1001,29 @@ IceInternal::getAddresses(const string& host, int port, ProtocolSupport, Ice::En
 
 }
 #else
+void
+IceInternal::sortAddresses(vector<Address>& addrs, ProtocolSupport protocol, Ice::EndpointSelectionType selType,
+                           bool preferIPv6)
+{
+    if(selType == Ice::Random)
+    {
+        RandomNumberGenerator rng;
+        random_shuffle(addrs.begin(), addrs.end(), rng);
+    }
+
+    if(protocol == EnableBoth)
+    {
+        if(preferIPv6)
+        {
+            stable_partition(addrs.begin(), addrs.end(), AddressIsIPv6());
+        }
+        else
+        {
+            stable_partition(addrs.begin(), addrs.end(), not1(AddressIsIPv6()));
+        }
+    }
+}
+
 vector<Address>
 IceInternal::getAddresses(const string& host, int port, ProtocolSupport protocol, Ice::EndpointSelectionType selType,
                           bool preferIPv6, bool blocking)
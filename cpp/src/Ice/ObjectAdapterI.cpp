@@ -511,22 +511,34 @@ Ice::ObjectAdapterI::find(const Identity& ident) const
 ObjectPtr
 Ice::ObjectAdapterI::findFacet(const Identity& ident, const string& facet) const
 {
-    IceUtil::Monitor<IceUtil::RecMutex>::Lock sync(*this);
+    {
+        IceUtil::Monitor<IceUtil::RecMutex>::Lock sync(*this);
+        checkForDeactivation();
+    }
 
-    checkForDeactivation();
     checkIdentity(ident);
 
+    //
+    // No mutex lock necessary for the lookup, _servantManager is
+    // immutable and has its own synchronization.
+    //
     return _servantManager->findServant(ident, facet);
 }
 
 FacetMap
 Ice::ObjectAdapterI::findAllFacets(const Identity& ident) const
 {
-    IceUtil::Monitor<IceUtil::RecMutex>::Lock sync(*this);
+    {
+        IceUtil::Monitor<IceUtil::RecMutex>::Lock sync(*this);
+        checkForDeactivation();
+    }
 
-    checkForDeactivation();
     checkIdentity(ident);
 
+    //
+    // No mutex lock necessary for the lookup, _servantManager is
+    // immutable and has its own synchronization.
+    //
     return _servantManager->findAllFacets(ident);
 }
 
@@ -1417,6 +1429,9 @@ Ice::ObjectAdapterI::filterProperties(StringSeq& unknownProps)
         "Locator.EndpointSelection",
         "Locator.ConnectionCached",
         "Locator.PreferSecure",
+        "Locator.ParallelConnect",
+        "Locator.ConnectionPoolSize",
+        "Locator.Hedging",
         "Locator.CollocationOptimized",
         "Locator.Router",
         "MessageSizeMax",
@@ -1427,11 +1442,17 @@ Ice::ObjectAdapterI::filterProperties(StringSeq& unknownProps)
         "Router.EndpointSelection",
         "Router.ConnectionCached",
         "Router.PreferSecure",
+        "Router.ParallelConnect",
+        "Router.ConnectionPoolSize",
+        "Router.Hedging",
         "Router.CollocationOptimized",
         "Router.Locator",
         "Router.Locator.EndpointSelection",
         "Router.Locator.ConnectionCached",
         "Router.Locator.PreferSecure",
+        "Router.Locator.ParallelConnect",
+        "Router.Locator.ConnectionPoolSize",
+        "Router.Locator.Hedging",
         "Router.Locator.CollocationOptimized",
         "Router.Locator.LocatorCacheTimeout",
         "Router.Locator.InvocationTimeout",
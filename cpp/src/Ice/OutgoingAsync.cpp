@@ -17,6 +17,7 @@
 #include <Ice/ImplicitContextI.h>
 #include <Ice/ThreadPool.h>
 #include <Ice/RetryQueue.h>
+#include <Ice/RequestHedging.h>
 #include <Ice/ConnectionFactory.h>
 #include <Ice/ObjectAdapterFactory.h>
 #include <Ice/LoggerUtil.h>
@@ -923,6 +924,12 @@ OutgoingAsync::response()
         _childObserver.detach();
     }
 
+    if(_sentTime != IceUtil::Time() && _cachedConnection)
+    {
+        ConnectionIPtr connection = ICE_DYNAMIC_CAST(ConnectionI, _cachedConnection);
+        connection->latency(IceUtil::Time::now(IceUtil::Time::Monotonic) - _sentTime);
+    }
+
     Byte replyStatus;
     try
     {
@@ -1044,6 +1051,10 @@ OutgoingAsync::response()
             }
         }
 
+        if(_hedge)
+        {
+            _hedge->completed(true);
+        }
         return responseImpl(replyStatus == replyOK);
     }
     catch(const Exception& ex)
@@ -1052,9 +1063,34 @@ OutgoingAsync::response()
     }
 }
 
+bool
+OutgoingAsync::exception(const Exception& ex)
+{
+    if(_hedge)
+    {
+        //
+        // The request is either retried or fails. Don't hedge it until
+        // it's sent again, the duplicate would otherwise be sent while
+        // the request waits in the retry queue.
+        //
+        _hedge->setConnection(0);
+    }
+    return ProxyOutgoingAsyncBase::exception(ex);
+}
+
 AsyncStatus
 OutgoingAsync::invokeRemote(const ConnectionIPtr& connection, bool compress, bool response)
 {
+    if(_hedge)
+    {
+        _hedge->setConnection(connection);
+    }
+
+    //
+    // Measure the reply latency if the endpoint health tracks it.
+    //
+    _sentTime = connection->tracksLatency() ? IceUtil::Time::now(IceUtil::Time::Monotonic) : IceUtil::Time();
+
     _cachedConnection = connection;
     return connection->sendAsyncRequest(ICE_SHARED_FROM_THIS, compress, response, 0);
 }
@@ -1094,6 +1130,20 @@ OutgoingAsync::invoke(const string& operation)
         return; // Don't call sent/completed callback for batch AMI requests
     }
 
+    //
+    // If hedging is enabled, the hedge task sends a duplicate of the
+    // request if it doesn't complete before the hedging delay.
+    //
+    const ReferencePtr& ref = _proxy->__reference();
+    if(ref->getHedging())
+    {
+        _hedge = _instance->requestHedging()->newTask(ICE_DYNAMIC_CAST(OutgoingAsync, ICE_SHARED_FROM_THIS), ref, _mode);
+        if(_hedge)
+        {
+            _hedge->start(_os);
+        }
+    }
+
     //
     // NOTE: invokeImpl doesn't throw so this can be called from the
     // try block with the catch block calling abort() in case of an
@@ -1102,6 +1152,62 @@ OutgoingAsync::invoke(const string& operation)
     invokeImpl(true); // userThread = true
 }
 
+void
+OutgoingAsync::hedgeResponse(InputStream& is)
+{
+    {
+        Lock sync(_m);
+        if(_hedgeReply.get())
+        {
+            return;
+        }
+        _hedgeReply.reset(new InputStream(_instance.get(), currentProtocolEncoding));
+        _hedgeReply->swap(is);
+    }
+
+    //
+    // Cancel the request, the request is completed with the reply of
+    // the duplicate by exceptionImpl(). This is a no-op if the request
+    // already completed.
+    //
+    cancel(InvocationCanceledException(__FILE__, __LINE__));
+}
+
+bool
+OutgoingAsync::exceptionImpl(const Exception& ex)
+{
+    if(_hedge)
+    {
+        IceUtil::UniquePtr<InputStream> reply;
+        {
+            Lock sync(_m);
+            reply.reset(_hedgeReply.release());
+        }
+        if(reply.get())
+        {
+            //
+            // The duplicate got a reply, use it instead of the exception.
+            // This can be called with the connection locked, the response
+            // callback is called asynchronously.
+            //
+            _is.swap(*reply);
+            if(response())
+            {
+                invokeResponseAsync();
+            }
+            return false;
+        }
+
+        //
+        // The exception is final, retried exceptions don't end up here.
+        //
+        bool invoke = ProxyOutgoingAsyncBase::exceptionImpl(ex);
+        _hedge->completed(false);
+        return invoke;
+    }
+    return ProxyOutgoingAsyncBase::exceptionImpl(ex);
+}
+
 #ifdef ICE_CPP11_MAPPING
 void
 OutgoingAsync::invoke(const string& operation,
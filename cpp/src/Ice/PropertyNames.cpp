@@ -37,6 +37,9 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.Locator.EndpointSelection", false, 0),
     IceInternal::Property("Ice.Admin.Locator.ConnectionCached", false, 0),
     IceInternal::Property("Ice.Admin.Locator.PreferSecure", false, 0),
+    IceInternal::Property("Ice.Admin.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("Ice.Admin.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("Ice.Admin.Locator.Hedging", false, 0),
     IceInternal::Property("Ice.Admin.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Ice.Admin.Locator.InvocationTimeout", false, 0),
     IceInternal::Property("Ice.Admin.Locator.Locator", false, 0),
@@ -49,6 +52,9 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.Router.EndpointSelection", false, 0),
     IceInternal::Property("Ice.Admin.Router.ConnectionCached", false, 0),
     IceInternal::Property("Ice.Admin.Router.PreferSecure", false, 0),
+    IceInternal::Property("Ice.Admin.Router.ParallelConnect", false, 0),
+    IceInternal::Property("Ice.Admin.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("Ice.Admin.Router.Hedging", false, 0),
     IceInternal::Property("Ice.Admin.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Ice.Admin.Router.InvocationTimeout", false, 0),
     IceInternal::Property("Ice.Admin.Router.Locator", false, 0),
@@ -79,9 +85,13 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.ChangeUser", false, 0),
     IceInternal::Property("Ice.ClientAccessPolicyProtocol", false, 0),
     IceInternal::Property("Ice.Compression.Level", false, 0),
+    IceInternal::Property("Ice.Compression.ParallelUncompressSize", false, 0),
     IceInternal::Property("Ice.CollectObjects", false, 0),
     IceInternal::Property("Ice.Config", false, 0),
     IceInternal::Property("Ice.ConsoleListener", false, 0),
+    IceInternal::Property("Ice.ConnectionPool.GrowThreshold", false, 0),
+    IceInternal::Property("Ice.ConnectionPool.IdleTimeout", false, 0),
+    IceInternal::Property("Ice.ConnectionPool.Striping", false, 0),
     IceInternal::Property("Ice.Default.CollocationOptimized", false, 0),
     IceInternal::Property("Ice.Default.EncodingVersion", false, 0),
     IceInternal::Property("Ice.Default.EndpointSelection", false, 0),
@@ -89,6 +99,9 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Default.Locator.EndpointSelection", false, 0),
     IceInternal::Property("Ice.Default.Locator.ConnectionCached", false, 0),
     IceInternal::Property("Ice.Default.Locator.PreferSecure", false, 0),
+    IceInternal::Property("Ice.Default.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("Ice.Default.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("Ice.Default.Locator.Hedging", false, 0),
     IceInternal::Property("Ice.Default.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Ice.Default.Locator.InvocationTimeout", false, 0),
     IceInternal::Property("Ice.Default.Locator.Locator", false, 0),
@@ -100,10 +113,16 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Default.InvocationTimeout", false, 0),
     IceInternal::Property("Ice.Default.Package", false, 0),
     IceInternal::Property("Ice.Default.PreferSecure", false, 0),
+    IceInternal::Property("Ice.Default.ParallelConnect", false, 0),
+    IceInternal::Property("Ice.Default.ConnectionPoolSize", false, 0),
+    IceInternal::Property("Ice.Default.Hedging", false, 0),
     IceInternal::Property("Ice.Default.Protocol", false, 0),
     IceInternal::Property("Ice.Default.Router.EndpointSelection", false, 0),
     IceInternal::Property("Ice.Default.Router.ConnectionCached", false, 0),
     IceInternal::Property("Ice.Default.Router.PreferSecure", false, 0),
+    IceInternal::Property("Ice.Default.Router.ParallelConnect", false, 0),
+    IceInternal::Property("Ice.Default.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("Ice.Default.Router.Hedging", false, 0),
     IceInternal::Property("Ice.Default.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Ice.Default.Router.InvocationTimeout", false, 0),
     IceInternal::Property("Ice.Default.Router.Locator", false, 0),
@@ -114,14 +133,26 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Default.SlicedFormat", false, 0),
     IceInternal::Property("Ice.Default.SourceAddress", false, 0),
     IceInternal::Property("Ice.Default.Timeout", false, 0),
+    IceInternal::Property("Ice.EndpointHealth.EjectionTime", false, 0),
+    IceInternal::Property("Ice.EndpointHealth.FailureThreshold", false, 0),
+    IceInternal::Property("Ice.EndpointHealth.LatencyThreshold", false, 0),
+    IceInternal::Property("Ice.EndpointHealth.MaxEjectionTime", false, 0),
     IceInternal::Property("Ice.EventLog.Source", false, 0),
     IceInternal::Property("Ice.FactoryAssemblies", false, 0),
     IceInternal::Property("Ice.HTTPProxyHost", false, 0),
     IceInternal::Property("Ice.HTTPProxyPort", false, 0),
+    IceInternal::Property("Ice.Hedging.Budget", false, 0),
+    IceInternal::Property("Ice.Hedging.MinDelay", false, 0),
+    IceInternal::Property("Ice.Hedging.Percentile", false, 0),
+    IceInternal::Property("Ice.HostResolver.CacheTimeout", false, 0),
+    IceInternal::Property("Ice.HostResolver.NegativeCacheTimeout", false, 0),
+    IceInternal::Property("Ice.HostResolver.SizeMax", false, 0),
     IceInternal::Property("Ice.ImplicitContext", false, 0),
     IceInternal::Property("Ice.InitPlugins", false, 0),
     IceInternal::Property("Ice.IPv4", false, 0),
     IceInternal::Property("Ice.IPv6", false, 0),
+    IceInternal::Property("Ice.LocatorCacheJitter", false, 0),
+    IceInternal::Property("Ice.LocatorCacheRefreshAhead", false, 0),
     IceInternal::Property("Ice.LogFile", false, 0),
     IceInternal::Property("Ice.LogFile.SizeMax", false, 0),
     IceInternal::Property("Ice.LogStdErr.Convert", false, 0),
@@ -134,6 +165,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Override.Timeout", false, 0),
     IceInternal::Property("Ice.Override.Secure", false, 0),
     IceInternal::Property("Ice.Package.*", false, 0),
+    IceInternal::Property("Ice.ParallelConnectDelay", false, 0),
     IceInternal::Property("Ice.Plugin.*", false, 0),
     IceInternal::Property("Ice.PluginLoadOrder", false, 0),
     IceInternal::Property("Ice.PreferIPv6Address", false, 0),
@@ -220,6 +252,9 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Multicast.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.PreferSecure", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Locator.Hedging", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.InvocationTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.Locator", false, 0),
@@ -232,6 +267,9 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Multicast.Router.EndpointSelection", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router.ConnectionCached", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router.PreferSecure", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Router.ParallelConnect", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Router.Hedging", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router.InvocationTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router.Locator", false, 0),
@@ -257,6 +295,9 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Reply.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.PreferSecure", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Locator.Hedging", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.InvocationTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.Locator", false, 0),
@@ -269,6 +310,9 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Reply.Router.EndpointSelection", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router.ConnectionCached", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router.PreferSecure", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Router.ParallelConnect", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Router.Hedging", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router.InvocationTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router.Locator", false, 0),
@@ -294,6 +338,9 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Locator.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.PreferSecure", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Locator.Hedging", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.InvocationTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.Locator", false, 0),
@@ -306,6 +353,9 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Locator.Router.EndpointSelection", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router.ConnectionCached", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router.PreferSecure", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Router.ParallelConnect", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Router.Hedging", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router.InvocationTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router.Locator", false, 0),
@@ -330,6 +380,10 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Port", false, 0),
     IceInternal::Property("IceDiscovery.Interface", false, 0),
     IceInternal::Property("IceDiscovery.DomainId", false, 0),
+    IceInternal::Property("IceDiscovery.BatchDelay", false, 0),
+    IceInternal::Property("IceDiscovery.CacheTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.NegativeCacheTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.Announce", false, 0),
 };
 
 const IceInternal::PropertyArray
@@ -347,6 +401,9 @@ const IceInternal::Property IceGridDiscoveryPropsData[] =
     IceInternal::Property("IceGridDiscovery.Reply.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.Locator.PreferSecure", false, 0),
+    IceInternal::Property("IceGridDiscovery.Reply.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("IceGridDiscovery.Reply.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGridDiscovery.Reply.Locator.Hedging", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.Locator.InvocationTimeout", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.Locator.Locator", false, 0),
@@ -359,6 +416,9 @@ const IceInternal::Property IceGridDiscoveryPropsData[] =
     IceInternal::Property("IceGridDiscovery.Reply.Router.EndpointSelection", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.Router.ConnectionCached", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.Router.PreferSecure", false, 0),
+    IceInternal::Property("IceGridDiscovery.Reply.Router.ParallelConnect", false, 0),
+    IceInternal::Property("IceGridDiscovery.Reply.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGridDiscovery.Reply.Router.Hedging", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.Router.InvocationTimeout", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.Router.Locator", false, 0),
@@ -384,6 +444,9 @@ const IceInternal::Property IceGridDiscoveryPropsData[] =
     IceInternal::Property("IceGridDiscovery.Locator.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.Locator.PreferSecure", false, 0),
+    IceInternal::Property("IceGridDiscovery.Locator.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("IceGridDiscovery.Locator.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGridDiscovery.Locator.Locator.Hedging", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.Locator.InvocationTimeout", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.Locator.Locator", false, 0),
@@ -396,6 +459,9 @@ const IceInternal::Property IceGridDiscoveryPropsData[] =
     IceInternal::Property("IceGridDiscovery.Locator.Router.EndpointSelection", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.Router.ConnectionCached", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.Router.PreferSecure", false, 0),
+    IceInternal::Property("IceGridDiscovery.Locator.Router.ParallelConnect", false, 0),
+    IceInternal::Property("IceGridDiscovery.Locator.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGridDiscovery.Locator.Router.Hedging", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.Router.InvocationTimeout", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.Router.Locator", false, 0),
@@ -456,6 +522,9 @@ const IceInternal::Property IceBoxAdminPropsData[] =
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.EndpointSelection", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.ConnectionCached", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.PreferSecure", false, 0),
+    IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.ParallelConnect", false, 0),
+    IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.Hedging", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.InvocationTimeout", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.Locator", false, 0),
@@ -491,6 +560,9 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.PreferSecure", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.Hedging", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.InvocationTimeout", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.Locator", false, 0),
@@ -503,6 +575,9 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.EndpointSelection", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.ConnectionCached", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.PreferSecure", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.ParallelConnect", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.Hedging", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.InvocationTimeout", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.Locator", false, 0),
@@ -538,6 +613,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.AdminRouter.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.PreferSecure", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Locator.Hedging", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.InvocationTimeout", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.Locator", false, 0),
@@ -550,6 +628,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.AdminRouter.Router.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.PreferSecure", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Router.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Router.Hedging", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.InvocationTimeout", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.Locator", false, 0),
@@ -576,6 +657,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.PreferSecure", false, 0),
+    IceInternal::Property("IceGrid.Node.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Node.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Node.Locator.Hedging", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.InvocationTimeout", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.Locator", false, 0),
@@ -588,6 +672,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.Router.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Node.Router.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Node.Router.PreferSecure", false, 0),
+    IceInternal::Property("IceGrid.Node.Router.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Node.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Node.Router.Hedging", false, 0),
     IceInternal::Property("IceGrid.Node.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Node.Router.InvocationTimeout", false, 0),
     IceInternal::Property("IceGrid.Node.Router.Locator", false, 0),
@@ -609,6 +696,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.CollocateRegistry", false, 0),
     IceInternal::Property("IceGrid.Node.Data", false, 0),
     IceInternal::Property("IceGrid.Node.DisableOnFailure", false, 0),
+    IceInternal::Property("IceGrid.Node.MaxConcurrentActivations", false, 0),
     IceInternal::Property("IceGrid.Node.Name", false, 0),
     IceInternal::Property("IceGrid.Node.Output", false, 0),
     IceInternal::Property("IceGrid.Node.ProcessorSocketCount", false, 0),
@@ -624,6 +712,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.UserAccountMapper.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.PreferSecure", false, 0),
+    IceInternal::Property("IceGrid.Node.UserAccountMapper.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Node.UserAccountMapper.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Node.UserAccountMapper.Hedging", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.InvocationTimeout", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.Locator", false, 0),
@@ -636,6 +727,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.PreferSecure", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.Hedging", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.InvocationTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.Locator", false, 0),
@@ -653,6 +747,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.PreferSecure", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.Hedging", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.InvocationTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.Locator", false, 0),
@@ -665,6 +762,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.PreferSecure", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.Hedging", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.InvocationTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.Locator", false, 0),
@@ -684,6 +784,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.PreferSecure", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.Hedging", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.InvocationTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.Locator", false, 0),
@@ -700,6 +803,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Client.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.PreferSecure", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Locator.Hedging", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.InvocationTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.Locator", false, 0),
@@ -712,6 +818,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Client.Router.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.PreferSecure", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Router.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Router.Hedging", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.InvocationTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.Locator", false, 0),
@@ -739,6 +848,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.PreferSecure", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Locator.Hedging", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.InvocationTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.Locator", false, 0),
@@ -751,6 +863,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Discovery.Router.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router.PreferSecure", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Router.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Router.Hedging", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router.InvocationTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router.Locator", false, 0),
@@ -781,6 +896,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Internal.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.PreferSecure", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Locator.Hedging", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.InvocationTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.Locator", false, 0),
@@ -793,6 +911,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Internal.Router.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.PreferSecure", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Router.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Router.Hedging", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.InvocationTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.Locator", false, 0),
@@ -815,6 +936,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.PreferSecure", false, 0),
+    IceInternal::Property("IceGrid.Registry.PermissionsVerifier.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.PermissionsVerifier.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.PermissionsVerifier.Hedging", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.InvocationTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.Locator", false, 0),
@@ -835,6 +959,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Server.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.PreferSecure", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Locator.Hedging", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.InvocationTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.Locator", false, 0),
@@ -847,6 +974,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Server.Router.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.PreferSecure", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Router.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Router.Hedging", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.InvocationTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.Locator", false, 0),
@@ -873,6 +1003,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.PreferSecure", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Locator.Hedging", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.InvocationTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.Locator", false, 0),
@@ -885,6 +1018,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.PreferSecure", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Router.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Router.Hedging", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.InvocationTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.Locator", false, 0),
@@ -905,6 +1041,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.PreferSecure", false, 0),
+    IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.Hedging", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.InvocationTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.Locator", false, 0),
@@ -924,6 +1063,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Trace.Subscriber", false, 0),
     IceInternal::Property("IceGrid.Registry.Trace.Topic", false, 0),
     IceInternal::Property("IceGrid.Registry.Trace.TopicManager", false, 0),
+    IceInternal::Property("IceGrid.Registry.UpdateLogSize", false, 0),
     IceInternal::Property("IceGrid.Registry.UserAccounts", false, 0),
 };
 
@@ -942,6 +1082,9 @@ const IceInternal::Property IcePatch2PropsData[] =
     IceInternal::Property("IcePatch2.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IcePatch2.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IcePatch2.Locator.PreferSecure", false, 0),
+    IceInternal::Property("IcePatch2.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("IcePatch2.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IcePatch2.Locator.Hedging", false, 0),
     IceInternal::Property("IcePatch2.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IcePatch2.Locator.InvocationTimeout", false, 0),
     IceInternal::Property("IcePatch2.Locator.Locator", false, 0),
@@ -954,6 +1097,9 @@ const IceInternal::Property IcePatch2PropsData[] =
     IceInternal::Property("IcePatch2.Router.EndpointSelection", false, 0),
     IceInternal::Property("IcePatch2.Router.ConnectionCached", false, 0),
     IceInternal::Property("IcePatch2.Router.PreferSecure", false, 0),
+    IceInternal::Property("IcePatch2.Router.ParallelConnect", false, 0),
+    IceInternal::Property("IcePatch2.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IcePatch2.Router.Hedging", false, 0),
     IceInternal::Property("IcePatch2.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IcePatch2.Router.InvocationTimeout", false, 0),
     IceInternal::Property("IcePatch2.Router.Locator", false, 0),
@@ -972,6 +1118,7 @@ const IceInternal::Property IcePatch2PropsData[] =
     IceInternal::Property("IcePatch2.MessageSizeMax", false, 0),
     IceInternal::Property("IcePatch2.Directory", false, 0),
     IceInternal::Property("IcePatch2.InstanceName", false, 0),
+    IceInternal::Property("IcePatch2.MaxOpenFiles", false, 0),
 };
 
 const IceInternal::PropertyArray
@@ -981,6 +1128,9 @@ const IceInternal::PropertyArray
 const IceInternal::Property IcePatch2ClientPropsData[] = 
 {
     IceInternal::Property("IcePatch2Client.ChunkSize", false, 0),
+    IceInternal::Property("IcePatch2Client.ChunkWindow", false, 0),
+    IceInternal::Property("IcePatch2Client.DecompressThreads", false, 0),
+    IceInternal::Property("IcePatch2Client.DeltaMinSize", false, 0),
     IceInternal::Property("IcePatch2Client.Directory", false, 0),
     IceInternal::Property("IcePatch2Client.Proxy", false, 0),
     IceInternal::Property("IcePatch2Client.Remove", false, 0),
@@ -1074,6 +1224,9 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Client.Locator.EndpointSelection", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.ConnectionCached", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.PreferSecure", false, 0),
+    IceInternal::Property("Glacier2.Client.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("Glacier2.Client.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("Glacier2.Client.Locator.Hedging", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.InvocationTimeout", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.Locator", false, 0),
@@ -1086,6 +1239,9 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Client.Router.EndpointSelection", false, 0),
     IceInternal::Property("Glacier2.Client.Router.ConnectionCached", false, 0),
     IceInternal::Property("Glacier2.Client.Router.PreferSecure", false, 0),
+    IceInternal::Property("Glacier2.Client.Router.ParallelConnect", false, 0),
+    IceInternal::Property("Glacier2.Client.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("Glacier2.Client.Router.Hedging", false, 0),
     IceInternal::Property("Glacier2.Client.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.Client.Router.InvocationTimeout", false, 0),
     IceInternal::Property("Glacier2.Client.Router.Locator", false, 0),
@@ -1121,6 +1277,9 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.PermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.ConnectionCached", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.PreferSecure", false, 0),
+    IceInternal::Property("Glacier2.PermissionsVerifier.ParallelConnect", false, 0),
+    IceInternal::Property("Glacier2.PermissionsVerifier.ConnectionPoolSize", false, 0),
+    IceInternal::Property("Glacier2.PermissionsVerifier.Hedging", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.InvocationTimeout", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.Locator", false, 0),
@@ -1132,6 +1291,9 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.ConnectionCached", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.PreferSecure", false, 0),
+    IceInternal::Property("Glacier2.SSLPermissionsVerifier.ParallelConnect", false, 0),
+    IceInternal::Property("Glacier2.SSLPermissionsVerifier.ConnectionPoolSize", false, 0),
+    IceInternal::Property("Glacier2.SSLPermissionsVerifier.Hedging", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.InvocationTimeout", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.Locator", false, 0),
@@ -1149,6 +1311,9 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Server.Locator.EndpointSelection", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.ConnectionCached", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.PreferSecure", false, 0),
+    IceInternal::Property("Glacier2.Server.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("Glacier2.Server.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("Glacier2.Server.Locator.Hedging", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.InvocationTimeout", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.Locator", false, 0),
@@ -1161,6 +1326,9 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Server.Router.EndpointSelection", false, 0),
     IceInternal::Property("Glacier2.Server.Router.ConnectionCached", false, 0),
     IceInternal::Property("Glacier2.Server.Router.PreferSecure", false, 0),
+    IceInternal::Property("Glacier2.Server.Router.ParallelConnect", false, 0),
+    IceInternal::Property("Glacier2.Server.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("Glacier2.Server.Router.Hedging", false, 0),
     IceInternal::Property("Glacier2.Server.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.Server.Router.InvocationTimeout", false, 0),
     IceInternal::Property("Glacier2.Server.Router.Locator", false, 0),
@@ -1186,6 +1354,9 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.SessionManager.EndpointSelection", false, 0),
     IceInternal::Property("Glacier2.SessionManager.ConnectionCached", false, 0),
     IceInternal::Property("Glacier2.SessionManager.PreferSecure", false, 0),
+    IceInternal::Property("Glacier2.SessionManager.ParallelConnect", false, 0),
+    IceInternal::Property("Glacier2.SessionManager.ConnectionPoolSize", false, 0),
+    IceInternal::Property("Glacier2.SessionManager.Hedging", false, 0),
     IceInternal::Property("Glacier2.SessionManager.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.SessionManager.InvocationTimeout", false, 0),
     IceInternal::Property("Glacier2.SessionManager.Locator", false, 0),
@@ -1196,6 +1367,9 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.SSLSessionManager.EndpointSelection", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.ConnectionCached", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.PreferSecure", false, 0),
+    IceInternal::Property("Glacier2.SSLSessionManager.ParallelConnect", false, 0),
+    IceInternal::Property("Glacier2.SSLSessionManager.ConnectionPoolSize", false, 0),
+    IceInternal::Property("Glacier2.SSLSessionManager.Hedging", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.InvocationTimeout", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.Locator", false, 0),
@@ -865,6 +865,75 @@ ICE_OBJECT_PRX::ice_preferSecure(bool b) const
     }
 }
 
+bool
+ICE_OBJECT_PRX::ice_isParallelConnect() const
+{
+    return _reference->getParallelConnect();
+}
+
+ObjectPrxPtr
+ICE_OBJECT_PRX::ice_parallelConnect(bool b) const
+{
+    if(b == _reference->getParallelConnect())
+    {
+        return CONST_POINTER_CAST_OBJECT_PRX;
+    }
+    else
+    {
+        ObjectPrxPtr proxy = __newInstance();
+        proxy->setup(_reference->changeParallelConnect(b));
+        return proxy;
+    }
+}
+
+Int
+ICE_OBJECT_PRX::ice_getConnectionPoolSize() const
+{
+    return _reference->getConnectionPoolSize();
+}
+
+ObjectPrxPtr
+ICE_OBJECT_PRX::ice_connectionPoolSize(Int newSize) const
+{
+    if(newSize < 1)
+    {
+        ostringstream s;
+        s << "invalid value passed to ice_connectionPoolSize: " << newSize;
+        throw IceUtil::IllegalArgumentException(__FILE__, __LINE__, s.str());
+    }
+    if(newSize == _reference->getConnectionPoolSize())
+    {
+        return CONST_POINTER_CAST_OBJECT_PRX;
+    }
+    else
+    {
+        ObjectPrxPtr proxy = __newInstance();
+        proxy->setup(_reference->changeConnectionPoolSize(newSize));
+        return proxy;
+    }
+}
+
+bool
+ICE_OBJECT_PRX::ice_isHedging() const
+{
+    return _reference->getHedging();
+}
+
+ObjectPrxPtr
+ICE_OBJECT_PRX::ice_hedging(bool b) const
+{
+    if(b == _reference->getHedging())
+    {
+        return CONST_POINTER_CAST_OBJECT_PRX;
+    }
+    else
+    {
+        ObjectPrxPtr proxy = __newInstance();
+        proxy->setup(_reference->changeHedging(b));
+        return proxy;
+    }
+}
+
 RouterPrxPtr
 ICE_OBJECT_PRX::ice_getRouter() const
 {
@@ -27,6 +27,7 @@
 #include <Ice/RequestHandlerFactory.h>
 #include <Ice/ConnectionRequestHandler.h>
 #include <Ice/DefaultsAndOverrides.h>
+#include <Ice/EndpointHealth.h>
 #include <Ice/Comparable.h>
 #include <Ice/StringUtil.h>
 
@@ -621,6 +622,24 @@ IceInternal::FixedReference::getPreferSecure() const
     return false;
 }
 
+bool
+IceInternal::FixedReference::getParallelConnect() const
+{
+    return false;
+}
+
+int
+IceInternal::FixedReference::getConnectionPoolSize() const
+{
+    return 1;
+}
+
+bool
+IceInternal::FixedReference::getHedging() const
+{
+    return false;
+}
+
 Ice::EndpointSelectionType
 IceInternal::FixedReference::getEndpointSelection() const
 {
@@ -688,6 +707,27 @@ IceInternal::FixedReference::changePreferSecure(bool) const
     return 0; // Keep the compiler happy.
 }
 
+ReferencePtr
+IceInternal::FixedReference::changeParallelConnect(bool) const
+{
+    throw FixedProxyException(__FILE__, __LINE__);
+    return 0; // Keep the compiler happy.
+}
+
+ReferencePtr
+IceInternal::FixedReference::changeConnectionPoolSize(int) const
+{
+    throw FixedProxyException(__FILE__, __LINE__);
+    return 0; // Keep the compiler happy.
+}
+
+ReferencePtr
+IceInternal::FixedReference::changeHedging(bool) const
+{
+    throw FixedProxyException(__FILE__, __LINE__);
+    return 0; // Keep the compiler happy.
+}
+
 ReferencePtr
 IceInternal::FixedReference::changeEndpointSelection(EndpointSelectionType) const
 {
@@ -893,6 +933,9 @@ IceInternal::RoutableReference::RoutableReference(const InstancePtr& instance,
                                                   bool collocationOptimized,
                                                   bool cacheConnection,
                                                   bool preferSecure,
+                                                  bool parallelConnect,
+                                                  int connectionPoolSize,
+                                                  bool hedging,
                                                   EndpointSelectionType endpointSelection,
                                                   int locatorCacheTimeout,
                                                   int invocationTimeout,
@@ -905,6 +948,9 @@ IceInternal::RoutableReference::RoutableReference(const InstancePtr& instance,
     _collocationOptimized(collocationOptimized),
     _cacheConnection(cacheConnection),
     _preferSecure(preferSecure),
+    _parallelConnect(parallelConnect),
+    _connectionPoolSize(connectionPoolSize),
+    _hedging(hedging),
     _endpointSelection(endpointSelection),
     _locatorCacheTimeout(locatorCacheTimeout),
     _overrideTimeout(false),
@@ -955,6 +1001,24 @@ IceInternal::RoutableReference::getPreferSecure() const
     return _preferSecure;
 }
 
+bool
+IceInternal::RoutableReference::getParallelConnect() const
+{
+    return _parallelConnect;
+}
+
+int
+IceInternal::RoutableReference::getConnectionPoolSize() const
+{
+    return _connectionPoolSize;
+}
+
+bool
+IceInternal::RoutableReference::getHedging() const
+{
+    return _hedging;
+}
+
 Ice::EndpointSelectionType
 IceInternal::RoutableReference::getEndpointSelection() const
 {
@@ -1094,6 +1158,42 @@ IceInternal::RoutableReference::changePreferSecure(bool newPreferSecure) const
     return r;
 }
 
+ReferencePtr
+IceInternal::RoutableReference::changeParallelConnect(bool newParallelConnect) const
+{
+    if(newParallelConnect == _parallelConnect)
+    {
+        return RoutableReferencePtr(const_cast<RoutableReference*>(this));
+    }
+    RoutableReferencePtr r = RoutableReferencePtr::dynamicCast(getInstance()->referenceFactory()->copy(this));
+    r->_parallelConnect = newParallelConnect;
+    return r;
+}
+
+ReferencePtr
+IceInternal::RoutableReference::changeConnectionPoolSize(int newSize) const
+{
+    if(newSize == _connectionPoolSize)
+    {
+        return RoutableReferencePtr(const_cast<RoutableReference*>(this));
+    }
+    RoutableReferencePtr r = RoutableReferencePtr::dynamicCast(getInstance()->referenceFactory()->copy(this));
+    r->_connectionPoolSize = newSize;
+    return r;
+}
+
+ReferencePtr
+IceInternal::RoutableReference::changeHedging(bool newHedging) const
+{
+    if(newHedging == _hedging)
+    {
+        return RoutableReferencePtr(const_cast<RoutableReference*>(this));
+    }
+    RoutableReferencePtr r = RoutableReferencePtr::dynamicCast(getInstance()->referenceFactory()->copy(this));
+    r->_hedging = newHedging;
+    return r;
+}
+
 ReferencePtr
 IceInternal::RoutableReference::changeEndpointSelection(EndpointSelectionType newType) const
 {
@@ -1256,6 +1356,13 @@ IceInternal::RoutableReference::toProperty(const string& prefix) const
     properties[prefix + ".CollocationOptimized"] = _collocationOptimized ? "1" : "0";
     properties[prefix + ".ConnectionCached"] = _cacheConnection ? "1" : "0";
     properties[prefix + ".PreferSecure"] = _preferSecure ? "1" : "0";
+    properties[prefix + ".ParallelConnect"] = _parallelConnect ? "1" : "0";
+    {
+        ostringstream s;
+        s << _connectionPoolSize;
+        properties[prefix + ".ConnectionPoolSize"] = s.str();
+    }
+    properties[prefix + ".Hedging"] = _hedging ? "1" : "0";
     properties[prefix + ".EndpointSelection"] = _endpointSelection == Random ? "Random" : "Ordered";
     {
         ostringstream s;
@@ -1316,6 +1423,18 @@ IceInternal::RoutableReference::operator==(const Reference& r) const
     {
         return false;
     }
+    if(_parallelConnect != rhs->_parallelConnect)
+    {
+        return false;
+    }
+    if(_connectionPoolSize != rhs->_connectionPoolSize)
+    {
+        return false;
+    }
+    if(_hedging != rhs->_hedging)
+    {
+        return false;
+    }
     if(_collocationOptimized != rhs->_collocationOptimized)
     {
         return false;
@@ -1400,6 +1519,30 @@ IceInternal::RoutableReference::operator<(const Reference& r) const
     {
         return false;
     }
+    if(!_parallelConnect && rhs->_parallelConnect)
+    {
+        return true;
+    }
+    else if(rhs->_parallelConnect < _parallelConnect)
+    {
+        return false;
+    }
+    if(_connectionPoolSize < rhs->_connectionPoolSize)
+    {
+        return true;
+    }
+    else if(rhs->_connectionPoolSize < _connectionPoolSize)
+    {
+        return false;
+    }
+    if(!_hedging && rhs->_hedging)
+    {
+        return true;
+    }
+    else if(rhs->_hedging < _hedging)
+    {
+        return false;
+    }
     if(!_collocationOptimized && rhs->_collocationOptimized)
     {
         return true;
@@ -1735,7 +1878,7 @@ IceInternal::RoutableReference::createConnection(const vector<EndpointIPtr>& all
         // Get an existing connection or create one if there's no
         // existing connection to one of the given endpoints.
         //
-        factory->create(endpoints, false, getEndpointSelection(), new CB1(_routerInfo, callback));
+        factory->create(endpoints, false, getEndpointSelection(), getParallelConnect(), new CB1(_routerInfo, callback));
         return;
     }
     else
@@ -1778,7 +1921,8 @@ IceInternal::RoutableReference::createConnection(const vector<EndpointIPtr>& all
                 endpoint.push_back(_endpoints[_i]);
 
                 OutgoingConnectionFactoryPtr factory = _reference->getInstance()->outgoingConnectionFactory();
-                factory->create(endpoint, more, _reference->getEndpointSelection(), this);
+                factory->create(endpoint, more, _reference->getEndpointSelection(), _reference->getParallelConnect(),
+                                this);
             }
 
             CB2(const RoutableReferencePtr& reference, const vector<EndpointIPtr>& endpoints,
@@ -1810,7 +1954,8 @@ IceInternal::RoutableReference::createConnection(const vector<EndpointIPtr>& all
         vector<EndpointIPtr> endpt;
         endpt.push_back(endpoints[0]);
         RoutableReference* self = const_cast<RoutableReference*>(this);
-        factory->create(endpt, true, getEndpointSelection(), new CB2(self, endpoints, callback));
+        factory->create(endpt, true, getEndpointSelection(), getParallelConnect(),
+                        new CB2(self, endpoints, callback));
         return;
     }
 }
@@ -1841,6 +1986,9 @@ IceInternal::RoutableReference::RoutableReference(const RoutableReference& r) :
     _collocationOptimized(r._collocationOptimized),
     _cacheConnection(r._cacheConnection),
     _preferSecure(r._preferSecure),
+    _parallelConnect(r._parallelConnect),
+    _connectionPoolSize(r._connectionPoolSize),
+    _hedging(r._hedging),
     _endpointSelection(r._endpointSelection),
     _locatorCacheTimeout(r._locatorCacheTimeout),
     _overrideTimeout(r._overrideTimeout),
@@ -1959,5 +2107,11 @@ IceInternal::RoutableReference::filterEndpoints(const vector<EndpointIPtr>& allE
         stable_partition(endpoints.begin(), endpoints.end(), not1(Ice::constMemFun(&EndpointI::secure)));
     }
 
+    //
+    // Skip the endpoints ejected by the endpoint health, unless they're
+    // all ejected.
+    //
+    getInstance()->endpointHealth()->filter(endpoints);
+
     return endpoints;
 }
@@ -83,6 +83,9 @@ public:
     virtual bool getCollocationOptimized() const = 0;
     virtual bool getCacheConnection() const = 0;
     virtual bool getPreferSecure() const = 0;
+    virtual bool getParallelConnect() const = 0;
+    virtual int getConnectionPoolSize() const = 0;
+    virtual bool getHedging() const = 0;
     virtual Ice::EndpointSelectionType getEndpointSelection() const = 0;
     virtual int getLocatorCacheTimeout() const = 0;
     virtual std::string getConnectionId() const = 0;
@@ -109,6 +112,9 @@ public:
     virtual ReferencePtr changeLocatorCacheTimeout(int) const = 0;
     virtual ReferencePtr changeCacheConnection(bool) const = 0;
     virtual ReferencePtr changePreferSecure(bool) const = 0;
+    virtual ReferencePtr changeParallelConnect(bool) const = 0;
+    virtual ReferencePtr changeConnectionPoolSize(int) const = 0;
+    virtual ReferencePtr changeHedging(bool) const = 0;
     virtual ReferencePtr changeEndpointSelection(Ice::EndpointSelectionType) const = 0;
 
     virtual ReferencePtr changeTimeout(int) const = 0;
@@ -191,6 +197,9 @@ public:
     virtual bool getCollocationOptimized() const;
     virtual bool getCacheConnection() const;
     virtual bool getPreferSecure() const;
+    virtual bool getParallelConnect() const;
+    virtual int getConnectionPoolSize() const;
+    virtual bool getHedging() const;
     virtual Ice::EndpointSelectionType getEndpointSelection() const;
     virtual int getLocatorCacheTimeout() const;
     virtual std::string getConnectionId() const;
@@ -202,6 +211,9 @@ public:
     virtual ReferencePtr changeCollocationOptimized(bool) const;
     virtual ReferencePtr changeCacheConnection(bool) const;
     virtual ReferencePtr changePreferSecure(bool) const;
+    virtual ReferencePtr changeParallelConnect(bool) const;
+    virtual ReferencePtr changeConnectionPoolSize(int) const;
+    virtual ReferencePtr changeHedging(bool) const;
     virtual ReferencePtr changeEndpointSelection(Ice::EndpointSelectionType) const;
     virtual ReferencePtr changeLocatorCacheTimeout(int) const;
 
@@ -236,8 +248,8 @@ public:
 
     RoutableReference(const InstancePtr&, const Ice::CommunicatorPtr&, const Ice::Identity&, const std::string&, Mode,
                       bool, const Ice::ProtocolVersion&, const Ice::EncodingVersion&, const std::vector<EndpointIPtr>&,
-                      const std::string&, const LocatorInfoPtr&, const RouterInfoPtr&, bool, bool, bool,
-                      Ice::EndpointSelectionType, int, int, const Ice::Context&);
+                      const std::string&, const LocatorInfoPtr&, const RouterInfoPtr&, bool, bool, bool, bool,
+                      int, bool, Ice::EndpointSelectionType, int, int, const Ice::Context&);
 
     virtual std::vector<EndpointIPtr> getEndpoints() const;
     virtual std::string getAdapterId() const;
@@ -246,6 +258,9 @@ public:
     virtual bool getCollocationOptimized() const;
     virtual bool getCacheConnection() const;
     virtual bool getPreferSecure() const;
+    virtual bool getParallelConnect() const;
+    virtual int getConnectionPoolSize() const;
+    virtual bool getHedging() const;
     virtual Ice::EndpointSelectionType getEndpointSelection() const;
     virtual int getLocatorCacheTimeout() const;
     virtual std::string getConnectionId() const;
@@ -259,6 +274,9 @@ public:
     virtual ReferencePtr changeCollocationOptimized(bool) const;
     virtual ReferencePtr changeCacheConnection(bool) const;
     virtual ReferencePtr changePreferSecure(bool) const;
+    virtual ReferencePtr changeParallelConnect(bool) const;
+    virtual ReferencePtr changeConnectionPoolSize(int) const;
+    virtual ReferencePtr changeHedging(bool) const;
     virtual ReferencePtr changeEndpointSelection(Ice::EndpointSelectionType) const;
     virtual ReferencePtr changeLocatorCacheTimeout(int) const;
 
@@ -304,6 +322,9 @@ private:
     bool _collocationOptimized;
     bool _cacheConnection;
     bool _preferSecure;
+    bool _parallelConnect; // Connect to the endpoints in parallel.
+    int _connectionPoolSize; // Maximum number of connections used to send requests.
+    bool _hedging; // Hedge idempotent requests.
     Ice::EndpointSelectionType _endpointSelection;
     int _locatorCacheTimeout;
 
@@ -711,6 +711,9 @@ IceInternal::ReferenceFactory::checkForUnknownProperties(const string& prefix)
         "EndpointSelection",
         "ConnectionCached",
         "PreferSecure",
+        "ParallelConnect",
+        "ConnectionPoolSize",
+        "Hedging",
         "LocatorCacheTimeout",
         "InvocationTimeout",
         "Locator",
@@ -794,6 +797,9 @@ IceInternal::ReferenceFactory::create(const Identity& ident,
     bool collocationOptimized = defaultsAndOverrides->defaultCollocationOptimization;
     bool cacheConnection = true;
     bool preferSecure = defaultsAndOverrides->defaultPreferSecure;
+    bool parallelConnect = defaultsAndOverrides->defaultParallelConnect;
+    int connectionPoolSize = defaultsAndOverrides->defaultConnectionPoolSize;
+    bool hedging = defaultsAndOverrides->defaultHedging;
     Ice::EndpointSelectionType endpointSelection = defaultsAndOverrides->defaultEndpointSelection;
     int locatorCacheTimeout = defaultsAndOverrides->defaultLocatorCacheTimeout;
     int invocationTimeout = defaultsAndOverrides->defaultInvocationTimeout;
@@ -851,6 +857,22 @@ IceInternal::ReferenceFactory::create(const Identity& ident,
         property = propertyPrefix + ".PreferSecure";
         preferSecure = properties->getPropertyAsIntWithDefault(property, preferSecure) > 0;
 
+        property = propertyPrefix + ".ParallelConnect";
+        parallelConnect = properties->getPropertyAsIntWithDefault(property, parallelConnect) > 0;
+
+        property = propertyPrefix + ".ConnectionPoolSize";
+        connectionPoolSize = properties->getPropertyAsIntWithDefault(property, connectionPoolSize);
+        if(connectionPoolSize < 1)
+        {
+            connectionPoolSize = 1;
+            Warning out(_instance->initializationData().logger);
+            out << "invalid value for " << property << " `" << properties->getProperty(property) << "'"
+                << ": defaulting to 1";
+        }
+
+        property = propertyPrefix + ".Hedging";
+        hedging = properties->getPropertyAsIntWithDefault(property, hedging) > 0;
+
         property = propertyPrefix + ".EndpointSelection";
         if(!properties->getProperty(property).empty())
         {
@@ -927,6 +949,9 @@ IceInternal::ReferenceFactory::create(const Identity& ident,
                                  collocationOptimized,
                                  cacheConnection,
                                  preferSecure,
+                                 parallelConnect,
+                                 connectionPoolSize,
+                                 hedging,
                                  endpointSelection,
                                  locatorCacheTimeout,
                                  invocationTimeout,
@@ -10,16 +10,59 @@
 #include <Ice/RequestHandlerFactory.h>
 #include <Ice/CollocatedRequestHandler.h>
 #include <Ice/ConnectRequestHandler.h>
+#include <Ice/ConnectionPoolRequestHandler.h>
 #include <Ice/CollocatedRequestHandler.h>
 #include <Ice/Reference.h>
 #include <Ice/ObjectAdapterFactory.h>
 #include <Ice/Instance.h>
+#include <Ice/Properties.h>
+#include <Ice/LoggerUtil.h>
 
 using namespace std;
 using namespace IceInternal;
 
-RequestHandlerFactory::RequestHandlerFactory(const InstancePtr& instance) : _instance(instance)
+RequestHandlerFactory::RequestHandlerFactory(const InstancePtr& instance) :
+    _instance(instance),
+    _poolLeastLoaded(true),
+    _poolGrowThreshold(64 * 1024),
+    _poolIdleTimeout(IceUtil::Time::seconds(60))
 {
+    const Ice::PropertiesPtr properties = instance->initializationData().properties;
+
+    string striping = properties->getPropertyWithDefault("Ice.ConnectionPool.Striping", "LeastLoaded");
+    if(striping == "RoundRobin")
+    {
+        const_cast<bool&>(_poolLeastLoaded) = false;
+    }
+    else if(striping != "LeastLoaded")
+    {
+        Ice::Warning out(instance->initializationData().logger);
+        out << "invalid value for Ice.ConnectionPool.Striping `" << striping << "': defaulting to LeastLoaded";
+    }
+
+    int threshold = properties->getPropertyAsIntWithDefault("Ice.ConnectionPool.GrowThreshold", 64 * 1024);
+    if(threshold < 0)
+    {
+        Ice::Warning out(instance->initializationData().logger);
+        out << "invalid value for Ice.ConnectionPool.GrowThreshold `"
+            << properties->getProperty("Ice.ConnectionPool.GrowThreshold") << "': defaulting to 65536";
+    }
+    else
+    {
+        const_cast<size_t&>(_poolGrowThreshold) = static_cast<size_t>(threshold);
+    }
+
+    int idleTimeout = properties->getPropertyAsIntWithDefault("Ice.ConnectionPool.IdleTimeout", 60);
+    if(idleTimeout < 0)
+    {
+        Ice::Warning out(instance->initializationData().logger);
+        out << "invalid value for Ice.ConnectionPool.IdleTimeout `"
+            << properties->getProperty("Ice.ConnectionPool.IdleTimeout") << "': defaulting to 60";
+    }
+    else
+    {
+        const_cast<IceUtil::Time&>(_poolIdleTimeout) = IceUtil::Time::seconds(idleTimeout);
+    }
 }
 
 RequestHandlerPtr
@@ -64,7 +107,19 @@ IceInternal::RequestHandlerFactory::getRequestHandler(const RoutableReferencePtr
         ref->getConnection(handler.get());
 #endif
     }
-    return proxy->__setRequestHandler(handler->connect(proxy));
+
+    //
+    // Proxies with a connection pool stripe their requests over several
+    // connections. The pool requires a cached connection, and routed
+    // proxies always use the router's connection.
+    //
+    RequestHandlerPtr requestHandler = handler->connect(proxy);
+    if(ref->getConnectionPoolSize() > 1 && ref->getCacheConnection() && !ref->getRouterInfo())
+    {
+        requestHandler = ICE_MAKE_SHARED(ConnectionPoolRequestHandler, ref, requestHandler, _poolLeastLoaded,
+                                         _poolGrowThreshold, _poolIdleTimeout);
+    }
+    return proxy->__setRequestHandler(requestHandler);
 }
 
 void
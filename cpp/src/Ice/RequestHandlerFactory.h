@@ -12,6 +12,7 @@
 
 #include <IceUtil/Shared.h>
 #include <IceUtil/Mutex.h>
+#include <IceUtil/Time.h>
 
 #include <Ice/RequestHandlerF.h>
 #include <Ice/ConnectRequestHandlerF.h>
@@ -34,6 +35,9 @@ public:
 private:
 
     const InstancePtr _instance;
+    const bool _poolLeastLoaded;
+    const size_t _poolGrowThreshold;
+    const IceUtil::Time _poolIdleTimeout;
     std::map<ReferencePtr, ConnectRequestHandlerPtr> _handlers;
 };
 
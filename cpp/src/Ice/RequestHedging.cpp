@@ -0,0 +1,498 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/RequestHedging.h>
+#include <Ice/OutgoingAsync.h>
+#include <Ice/ConnectionI.h>
+#include <Ice/EndpointI.h>
+#include <Ice/Reference.h>
+#include <Ice/LocatorInfo.h>
+#include <Ice/ProxyFactory.h>
+#include <Ice/Instance.h>
+#include <Ice/Properties.h>
+#include <Ice/TraceLevels.h>
+#include <Ice/LoggerUtil.h>
+#include <Ice/LocalException.h>
+
+#include <algorithm>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+#ifndef ICE_CPP11_MAPPING
+IceUtil::Shared* IceInternal::upCast(HedgeTask* p) { return p; }
+#endif
+
+namespace
+{
+
+//
+// The number of latencies kept for each proxy. The delay is computed
+// once the proxy has at least minSamples latencies and re-computed
+// every minSamples latencies.
+//
+const size_t maxSamples = 100;
+const size_t minSamples = 10;
+
+//
+// The maximum number of proxies with latencies in each stripe, the
+// least recently used proxy of the stripe is evicted once the maximum
+// is reached.
+//
+const size_t maxProxiesPerStripe = 64;
+
+//
+// Each hedged request withdraws 100 tokens from the budget and each
+// request eligible for hedging deposits Ice.Hedging.Budget tokens. The
+// budget allows a burst of at most 10 hedged requests.
+//
+const int hedgeCost = 100;
+const int maxTokens = 10 * hedgeCost;
+
+//
+// The duplicate of a hedged request. The reply is handed over to the
+// hedged request, the duplicate doesn't invoke any callbacks.
+//
+class HedgedOutgoingAsync : public OutgoingAsync
+{
+public:
+
+    HedgedOutgoingAsync(const ObjectPrxPtr& proxy, const HedgeTaskPtr& task, OperationMode mode) :
+        OutgoingAsync(proxy, false),
+        _task(task)
+    {
+        _mode = mode;
+    }
+
+    void
+    invoke(OutputStream& request)
+    {
+        _os.swap(request);
+        invokeImpl(false);
+    }
+
+    virtual bool
+    response()
+    {
+        //
+        // This is called with the connection locked, the reply is
+        // handed over from invokeResponse() instead.
+        //
+        return responseImpl(true);
+    }
+
+protected:
+
+    virtual bool
+    handleSent(bool, bool)
+    {
+        return false;
+    }
+
+    virtual bool
+    handleException(const Ice::Exception&)
+    {
+        _task->hedgedCompleted();
+        return false;
+    }
+
+    virtual bool
+    handleResponse(bool)
+    {
+        return true;
+    }
+
+    virtual void
+    handleInvokeSent(bool, OutgoingAsyncBase*) const
+    {
+        assert(false);
+    }
+
+    virtual void
+    handleInvokeException(const Ice::Exception&, OutgoingAsyncBase*) const
+    {
+        assert(false);
+    }
+
+    virtual void
+    handleInvokeResponse(bool, OutgoingAsyncBase* outAsync) const
+    {
+        _task->hedgedResponse(*outAsync->getIs());
+    }
+
+private:
+
+    const HedgeTaskPtr _task;
+};
+ICE_DEFINE_PTR(HedgedOutgoingAsyncPtr, HedgedOutgoingAsync);
+
+}
+
+IceInternal::HedgingStats::HedgingStats(int percentile) :
+    _percentile(percentile),
+    _next(0),
+    _added(0)
+{
+}
+
+void
+IceInternal::HedgingStats::add(const IceUtil::Time& latency)
+{
+    Lock sync(*this);
+    if(_samples.size() < maxSamples)
+    {
+        _samples.push_back(latency.toMicroSeconds());
+    }
+    else
+    {
+        _samples[_next] = latency.toMicroSeconds();
+        _next = (_next + 1) % maxSamples;
+    }
+
+    if(_samples.size() >= minSamples && ++_added >= minSamples)
+    {
+        _added = 0;
+        vector<IceUtil::Int64> samples(_samples);
+        vector<IceUtil::Int64>::iterator p = samples.begin() + (samples.size() - 1) * _percentile / 100;
+        nth_element(samples.begin(), p, samples.end());
+        _delay = IceUtil::Time::microSeconds(*p);
+    }
+}
+
+IceUtil::Time
+IceInternal::HedgingStats::getDelay() const
+{
+    Lock sync(*this);
+    return _delay;
+}
+
+IceInternal::RequestHedging::RequestHedging(const InstancePtr& instance) :
+    _instance(instance),
+    _percentile(95),
+    _budget(10),
+    _minDelay(IceUtil::Time::milliSeconds(1)),
+    _tokens(0)
+{
+    const PropertiesPtr properties = instance->initializationData().properties;
+
+    int percentile = properties->getPropertyAsIntWithDefault("Ice.Hedging.Percentile", 95);
+    if(percentile < 1 || percentile > 100)
+    {
+        Warning out(instance->initializationData().logger);
+        out << "invalid value for Ice.Hedging.Percentile `" << properties->getProperty("Ice.Hedging.Percentile")
+            << "': defaulting to 95";
+    }
+    else
+    {
+        const_cast<int&>(_percentile) = percentile;
+    }
+
+    int budget = properties->getPropertyAsIntWithDefault("Ice.Hedging.Budget", 10);
+    if(budget < 0)
+    {
+        Warning out(instance->initializationData().logger);
+        out << "invalid value for Ice.Hedging.Budget `" << properties->getProperty("Ice.Hedging.Budget")
+            << "': defaulting to 10";
+    }
+    else
+    {
+        const_cast<int&>(_budget) = min(budget, hedgeCost);
+    }
+
+    int minDelay = properties->getPropertyAsIntWithDefault("Ice.Hedging.MinDelay", 1);
+    if(minDelay < 0)
+    {
+        Warning out(instance->initializationData().logger);
+        out << "invalid value for Ice.Hedging.MinDelay `" << properties->getProperty("Ice.Hedging.MinDelay")
+            << "': defaulting to 1";
+    }
+    else
+    {
+        const_cast<IceUtil::Time&>(_minDelay) = IceUtil::Time::milliSeconds(minDelay);
+    }
+}
+
+HedgeTaskPtr
+IceInternal::RequestHedging::newTask(const OutgoingAsyncPtr& outAsync, const ReferencePtr& ref, OperationMode mode)
+{
+    //
+    // Only two-way requests for idempotent operations are hedged, the
+    // server might receive both the request and its duplicate.
+    //
+    if(ref->getMode() != Reference::ModeTwoway || ref->getRouterInfo() ||
+       (mode != ICE_ENUM(OperationMode, Idempotent) && mode != ICE_ENUM(OperationMode, Nonmutating)))
+    {
+        return 0;
+    }
+
+    //
+    // Deposit the budget of this request. Concurrent deposits can briefly
+    // exceed the maximum, the excess is withdrawn right away.
+    //
+    int tokens = _tokens.fetch_add(_budget) + _budget;
+    if(tokens > maxTokens)
+    {
+        _tokens.fetch_sub(min(_budget, tokens - maxTokens));
+    }
+
+    return ICE_MAKE_SHARED(HedgeTask, _instance, this, outAsync, ref, getStats(ref), mode);
+}
+
+vector<EndpointIPtr>
+IceInternal::RequestHedging::getEndpoints(const ReferencePtr& ref, const EndpointIPtr& endpoint) const
+{
+    //
+    // The endpoints of indirect proxies are only taken from the locator
+    // cache, the hedging delay is too short to locate the proxy.
+    //
+    vector<EndpointIPtr> endpoints;
+    if(ref->isIndirect())
+    {
+        LocatorInfoPtr locatorInfo = ref->getLocatorInfo();
+        if(locatorInfo)
+        {
+            endpoints = locatorInfo->getCachedEndpoints(ref, ref->getLocatorCacheTimeout());
+        }
+    }
+    else
+    {
+        endpoints = ref->getEndpoints();
+    }
+
+    vector<EndpointIPtr> others;
+    for(vector<EndpointIPtr>::const_iterator p = endpoints.begin(); p != endpoints.end(); ++p)
+    {
+        if(!(*p)->equivalent(endpoint))
+        {
+            others.push_back(*p);
+        }
+    }
+    return others;
+}
+
+bool
+IceInternal::RequestHedging::withdraw()
+{
+    if(_tokens.fetch_sub(hedgeCost) < hedgeCost)
+    {
+        _tokens.fetch_add(hedgeCost); // Not enough tokens, put them back.
+        return false;
+    }
+    return true;
+}
+
+HedgingStatsPtr
+IceInternal::RequestHedging::getStats(const ReferencePtr& ref)
+{
+    Stripe& stripe = _stripes[static_cast<unsigned int>(ref->hash()) % (sizeof(_stripes) / sizeof(_stripes[0]))];
+    IceUtil::Mutex::Lock sync(stripe);
+
+    map<ReferencePtr, Stripe::EntryList::iterator>::iterator p = stripe.index.find(ref);
+    if(p != stripe.index.end())
+    {
+        stripe.entries.splice(stripe.entries.begin(), stripe.entries, p->second);
+        return p->second->second;
+    }
+
+    if(stripe.index.size() >= maxProxiesPerStripe)
+    {
+        stripe.index.erase(stripe.entries.back().first);
+        stripe.entries.pop_back();
+    }
+
+    HedgingStatsPtr stats = new HedgingStats(_percentile);
+    stripe.entries.push_front(make_pair(ref, stats));
+    stripe.index.insert(make_pair(ref, stripe.entries.begin()));
+    return stats;
+}
+
+IceInternal::HedgeTask::HedgeTask(const InstancePtr& instance,
+                                  const RequestHedgingPtr& hedging,
+                                  const OutgoingAsyncPtr& outAsync,
+                                  const ReferencePtr& ref,
+                                  const HedgingStatsPtr& stats,
+                                  OperationMode mode) :
+    _instance(instance),
+    _hedging(hedging),
+    _reference(ref),
+    _stats(stats),
+    _mode(mode),
+    _start(IceUtil::Time::now(IceUtil::Time::Monotonic)),
+    _outAsync(outAsync),
+    _request(instance.get(), currentProtocolEncoding),
+    _completed(false)
+{
+}
+
+void
+IceInternal::HedgeTask::start(const OutputStream& os)
+{
+    IceUtil::Time delay = _stats->getDelay();
+    if(delay == IceUtil::Time())
+    {
+        return; // Not enough latencies yet to compute the delay.
+    }
+
+    //
+    // Copy the request now, the connection writes the request ID in the
+    // request stream when it's sent.
+    //
+    _request.writeBlob(os.b.begin(), os.b.size());
+    try
+    {
+        _instance->timer()->schedule(ICE_SHARED_FROM_THIS, max(delay, _hedging->getMinDelay()));
+    }
+    catch(const IceUtil::IllegalArgumentException&) // Expected if the communicator destroyed the timer.
+    {
+    }
+    catch(const CommunicatorDestroyedException&)
+    {
+    }
+}
+
+void
+IceInternal::HedgeTask::setConnection(const ConnectionIPtr& connection)
+{
+    Lock sync(*this);
+    _connection = connection;
+}
+
+void
+IceInternal::HedgeTask::completed(bool ok)
+{
+    //
+    // NOTE: this is called with the connection of the request locked,
+    // the duplicate is canceled from the timer thread.
+    //
+    Lock sync(*this);
+    if(_completed)
+    {
+        return;
+    }
+    _completed = true;
+    _outAsync = 0;
+    _connection = 0;
+
+    if(ok)
+    {
+        _stats->add(IceUtil::Time::now(IceUtil::Time::Monotonic) - _start);
+    }
+
+    try
+    {
+        if(_hedged)
+        {
+            _instance->timer()->schedule(ICE_SHARED_FROM_THIS, IceUtil::Time());
+        }
+        else
+        {
+            _instance->timer()->cancel(ICE_SHARED_FROM_THIS);
+        }
+    }
+    catch(const IceUtil::IllegalArgumentException&)
+    {
+    }
+    catch(const CommunicatorDestroyedException&)
+    {
+    }
+}
+
+void
+IceInternal::HedgeTask::hedgedResponse(InputStream& is)
+{
+    OutgoingAsyncPtr outAsync;
+    {
+        Lock sync(*this);
+        _hedged = 0;
+        outAsync = _outAsync;
+    }
+    if(outAsync)
+    {
+        outAsync->hedgeResponse(is);
+    }
+}
+
+void
+IceInternal::HedgeTask::hedgedCompleted()
+{
+    Lock sync(*this);
+    _hedged = 0;
+}
+
+void
+IceInternal::HedgeTask::runTimerTask()
+{
+    OutgoingAsyncPtr hedged;
+    ConnectionIPtr connection;
+    {
+        Lock sync(*this);
+        if(_completed)
+        {
+            hedged = _hedged;
+            _hedged = 0;
+        }
+        else
+        {
+            connection = _connection;
+        }
+    }
+
+    if(hedged)
+    {
+        //
+        // The request completed before its duplicate.
+        //
+        hedged->cancel();
+        return;
+    }
+
+    //
+    // The request isn't hedged if it isn't sent yet, if there's no other
+    // endpoint than the one of its connection or if the budget is spent.
+    //
+    if(!connection)
+    {
+        return;
+    }
+    vector<EndpointIPtr> endpoints = _hedging->getEndpoints(_reference, connection->endpoint());
+    if(endpoints.empty() || !_hedging->withdraw())
+    {
+        return;
+    }
+
+    HedgedOutgoingAsyncPtr outAsync;
+    try
+    {
+        ObjectPrxPtr proxy = _instance->proxyFactory()->referenceToProxy(_reference->changeEndpoints(endpoints));
+        outAsync = ICE_MAKE_SHARED(HedgedOutgoingAsync, proxy, ICE_SHARED_FROM_THIS, _mode);
+    }
+    catch(const CommunicatorDestroyedException&)
+    {
+        return;
+    }
+
+    {
+        Lock sync(*this);
+        if(_completed)
+        {
+            return;
+        }
+        _hedged = outAsync;
+    }
+
+    if(_instance->traceLevels()->retry >= 1)
+    {
+        Trace out(_instance->initializationData().logger, _instance->traceLevels()->retryCat);
+        out << "hedging request after " << (IceUtil::Time::now(IceUtil::Time::Monotonic) - _start).toMilliSeconds()
+            << "ms\n" << connection->toString();
+    }
+
+    outAsync->invoke(_request);
+}
@@ -0,0 +1,138 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_REQUEST_HEDGING_H
+#define ICE_REQUEST_HEDGING_H
+
+#include <IceUtil/Shared.h>
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Atomic.h>
+#include <IceUtil/Timer.h>
+#include <Ice/OutgoingAsyncF.h>
+#include <Ice/InstanceF.h>
+#include <Ice/ReferenceF.h>
+#include <Ice/EndpointIF.h>
+#include <Ice/ConnectionIF.h>
+#include <Ice/OutputStream.h>
+#include <Ice/InputStream.h>
+#include <Ice/Current.h>
+
+#include <list>
+#include <map>
+#include <vector>
+
+namespace IceInternal
+{
+
+//
+// The latencies of the last requests of a proxy. The hedging delay is
+// the configured percentile of these latencies.
+//
+class HedgingStats : public IceUtil::Shared, private IceUtil::Mutex
+{
+public:
+
+    HedgingStats(int);
+
+    void add(const IceUtil::Time&);
+    IceUtil::Time getDelay() const;
+
+private:
+
+    const int _percentile;
+    std::vector<IceUtil::Int64> _samples; // In microseconds.
+    size_t _next;
+    size_t _added; // Number of samples added since the delay was computed.
+    IceUtil::Time _delay;
+};
+typedef IceUtil::Handle<HedgingStats> HedgingStatsPtr;
+
+class RequestHedging : public IceUtil::Shared
+{
+public:
+
+    RequestHedging(const InstancePtr&);
+
+    HedgeTaskPtr newTask(const OutgoingAsyncPtr&, const ReferencePtr&, Ice::OperationMode);
+
+    std::vector<EndpointIPtr> getEndpoints(const ReferencePtr&, const EndpointIPtr&) const;
+    bool withdraw();
+
+    IceUtil::Time getMinDelay() const
+    {
+        return _minDelay;
+    }
+
+private:
+
+    //
+    // The latencies of the proxies are striped on the reference hash,
+    // each stripe keeps its proxies in least recently used order.
+    //
+    struct Stripe : public IceUtil::Mutex
+    {
+        typedef std::list<std::pair<ReferencePtr, HedgingStatsPtr> > EntryList;
+
+        EntryList entries; // Most recently used first.
+        std::map<ReferencePtr, EntryList::iterator> index;
+    };
+
+    HedgingStatsPtr getStats(const ReferencePtr&);
+
+    const InstancePtr _instance;
+    const int _percentile;
+    const int _budget;
+    const IceUtil::Time _minDelay;
+    IceUtilInternal::Atomic _tokens;
+    Stripe _stripes[16];
+};
+typedef IceUtil::Handle<RequestHedging> RequestHedgingPtr;
+
+//
+// The hedging task of a request. It sends a duplicate of the request to
+// another endpoint if the request doesn't complete before the hedging
+// delay and cancels the duplicate once the request completes.
+//
+class HedgeTask : public IceUtil::TimerTask, private IceUtil::Mutex
+#ifdef ICE_CPP11_MAPPING
+                , public std::enable_shared_from_this<HedgeTask>
+#endif
+{
+public:
+
+    HedgeTask(const InstancePtr&, const RequestHedgingPtr&, const OutgoingAsyncPtr&, const ReferencePtr&,
+              const HedgingStatsPtr&, Ice::OperationMode);
+
+    void start(const Ice::OutputStream&);
+    void setConnection(const Ice::ConnectionIPtr&);
+    void completed(bool);
+
+    void hedgedResponse(Ice::InputStream&);
+    void hedgedCompleted();
+
+    virtual void runTimerTask();
+
+private:
+
+    const InstancePtr _instance;
+    const RequestHedgingPtr _hedging;
+    const ReferencePtr _reference;
+    const HedgingStatsPtr _stats;
+    const Ice::OperationMode _mode;
+    const IceUtil::Time _start;
+    OutgoingAsyncPtr _outAsync;
+    Ice::OutputStream _request;
+    Ice::ConnectionIPtr _connection;
+    OutgoingAsyncPtr _hedged;
+    bool _completed;
+};
+
+}
+
+#endif
@@ -11,12 +11,18 @@
 
 #ifndef ICE_OS_WINRT
 #   if defined(_WIN32)
-#      include <Wincrypt.h>
+#      include <bcrypt.h>
 #      include <IceUtil/Exception.h>
+#      include <IceUtil/Mutex.h>
+#      include <IceUtil/MutexPtrLock.h>
 #   elif defined(__APPLE__)
 #      include <CommonCrypto/CommonDigest.h>
 #   else
 #      include <openssl/sha.h>
+#      include <openssl/evp.h>
+#      include <openssl/err.h>
+#      include <IceUtil/Exception.h>
+#      include <new>
 #   endif
 #endif
 
@@ -33,9 +39,9 @@ class SHA1::Hasher
 public:
     
     Hasher();
-#   ifdef _WIN32
+#   ifndef __APPLE__
     ~Hasher();
-#endif
+#   endif
     
     void update(const unsigned char*, std::size_t);
     void finalize(std::vector<unsigned char>&);
@@ -47,12 +53,11 @@ private:
     Hasher operator=(const Hasher&);
     
 #   if defined (_WIN32)
-    HCRYPTPROV _ctx;
-    HCRYPTHASH _hash;
+    BCRYPT_HASH_HANDLE _hash;
 #   elif defined(__APPLE__)
     CC_SHA1_CTX _ctx;
 #   else
-    SHA_CTX _ctx;
+    EVP_MD_CTX* _ctx;
 #   endif
 };
 
@@ -62,34 +67,73 @@ private:
 
 namespace
 {
+
 const int SHA_DIGEST_LENGTH = 20;
-}
 
-IceUtilInternal::SHA1::Hasher::Hasher() :
-    _ctx(0),
-    _hash(0)
+//
+// The CNG algorithm provider is opened once, opening it is much more
+// expensive than creating a hash object. CNG uses the SHA extensions
+// of the processor when they are available.
+//
+// The provider is opened on first use and never closed: opening or
+// closing it from a static constructor or destructor would call into
+// CNG with the loader lock held.
+//
+IceUtil::Mutex* algorithmProviderMutex = 0;
+BCRYPT_ALG_HANDLE algorithmProvider = 0;
+
+class Init
 {
-    if(!CryptAcquireContext(&_ctx, 0, MS_DEF_PROV, PROV_RSA_FULL, CRYPT_VERIFYCONTEXT))
+public:
+
+    Init()
     {
-        throw IceUtil::SyscallException(__FILE__, __LINE__, GetLastError());
+        algorithmProviderMutex = new IceUtil::Mutex;
     }
 
-    if(!CryptCreateHash(_ctx, CALG_SHA1, 0, 0, &_hash))
+    ~Init()
     {
-        throw IceUtil::SyscallException(__FILE__, __LINE__, GetLastError());
+        delete algorithmProviderMutex;
+        algorithmProviderMutex = 0;
     }
+};
+
+Init init;
+
+BCRYPT_ALG_HANDLE
+getAlgorithmProvider()
+{
+    IceUtilInternal::MutexPtrLock<IceUtil::Mutex> lock(algorithmProviderMutex);
+    if(!algorithmProvider)
+    {
+        BCRYPT_ALG_HANDLE handle = 0;
+        NTSTATUS status = BCryptOpenAlgorithmProvider(&handle, BCRYPT_SHA1_ALGORITHM, 0, 0);
+        if(status < 0)
+        {
+            throw IceUtil::SyscallException(__FILE__, __LINE__, status);
+        }
+        algorithmProvider = handle;
+    }
+    return algorithmProvider;
 }
 
-IceUtilInternal::SHA1::Hasher::~Hasher()
+}
+
+IceUtilInternal::SHA1::Hasher::Hasher() :
+    _hash(0)
 {
-    if(_hash)
+    NTSTATUS status = BCryptCreateHash(getAlgorithmProvider(), &_hash, 0, 0, 0, 0, 0);
+    if(status < 0)
     {
-        CryptDestroyHash(_hash);
+        throw IceUtil::SyscallException(__FILE__, __LINE__, status);
     }
+}
 
-    if(_ctx)
+IceUtilInternal::SHA1::Hasher::~Hasher()
+{
+    if(_hash)
     {
-        CryptReleaseContext(_ctx, 0);
+        BCryptDestroyHash(_hash);
     }
 }
 #   elif defined(__APPLE__)
@@ -98,9 +142,71 @@ IceUtilInternal::SHA1::Hasher::Hasher()
     CC_SHA1_Init(&_ctx);
 }
 #   else
-IceUtilInternal::SHA1::Hasher::Hasher()
+
+namespace
+{
+
+//
+// The error code of the exception is the OpenSSL error, like the
+// NTSTATUS of the CNG errors on Windows.
+//
+void
+throwDigestException(const char* file, int line)
+{
+    throw IceUtil::SyscallException(file, line, static_cast<int>(ERR_get_error()));
+}
+
+const EVP_MD*
+getDigest()
 {
-    SHA1_Init(&_ctx);
+#      if OPENSSL_VERSION_NUMBER >= 0x30000000L
+    //
+    // With OpenSSL 3, EVP_sha1() fetches the digest from the provider
+    // each time it's used, under a global lock. The digest is fetched
+    // once instead and never freed.
+    //
+    static EVP_MD* digest = EVP_MD_fetch(0, "SHA1", 0);
+    if(!digest)
+    {
+        throwDigestException(__FILE__, __LINE__);
+    }
+    return digest;
+#      else
+    return EVP_sha1();
+#      endif
+}
+
+}
+
+IceUtilInternal::SHA1::Hasher::Hasher() :
+#      if OPENSSL_VERSION_NUMBER < 0x10100000L
+    _ctx(EVP_MD_CTX_create())
+#      else
+    _ctx(EVP_MD_CTX_new())
+#      endif
+{
+    if(!_ctx)
+    {
+        throw std::bad_alloc();
+    }
+    if(!EVP_DigestInit_ex(_ctx, getDigest(), 0))
+    {
+#      if OPENSSL_VERSION_NUMBER < 0x10100000L
+        EVP_MD_CTX_destroy(_ctx);
+#      else
+        EVP_MD_CTX_free(_ctx);
+#      endif
+        throwDigestException(__FILE__, __LINE__);
+    }
+}
+
+IceUtilInternal::SHA1::Hasher::~Hasher()
+{
+#      if OPENSSL_VERSION_NUMBER < 0x10100000L
+    EVP_MD_CTX_destroy(_ctx);
+#      else
+    EVP_MD_CTX_free(_ctx);
+#      endif
 }
 #   endif
 
@@ -108,14 +214,18 @@ void
 IceUtilInternal::SHA1::Hasher::update(const unsigned char* data, size_t length)
 {
 #   if defined(_WIN32)
-    if(!CryptHashData(_hash, data, static_cast<DWORD>(length), 0))
+    NTSTATUS status = BCryptHashData(_hash, const_cast<PUCHAR>(data), static_cast<ULONG>(length), 0);
+    if(status < 0)
     {
-        throw IceUtil::SyscallException(__FILE__, __LINE__, GetLastError());
+        throw IceUtil::SyscallException(__FILE__, __LINE__, status);
     }
 #   elif defined(__APPLE__)
     CC_SHA1_Update(&_ctx, reinterpret_cast<const void*>(data), length);
 #   else
-    SHA1_Update(&_ctx, reinterpret_cast<const void*>(data), length);
+    if(!EVP_DigestUpdate(_ctx, reinterpret_cast<const void*>(data), length))
+    {
+        throwDigestException(__FILE__, __LINE__);
+    }
 #   endif
 }
 
@@ -124,17 +234,20 @@ IceUtilInternal::SHA1::Hasher::finalize(vector<unsigned char>& md)
 {
 #   if defined(_WIN32)
     md.resize(SHA_DIGEST_LENGTH);
-    DWORD length = SHA_DIGEST_LENGTH;
-    if(!CryptGetHashParam(_hash, HP_HASHVAL, &md[0], &length, 0))
+    NTSTATUS status = BCryptFinishHash(_hash, &md[0], SHA_DIGEST_LENGTH, 0);
+    if(status < 0)
     {
-        throw IceUtil::SyscallException(__FILE__, __LINE__, GetLastError());
+        throw IceUtil::SyscallException(__FILE__, __LINE__, status);
     }
 #   elif defined(__APPLE__)
     md.resize(CC_SHA1_DIGEST_LENGTH);
     CC_SHA1_Final(&md[0], &_ctx);
 #   else
     md.resize(SHA_DIGEST_LENGTH);
-    SHA1_Final(&md[0], &_ctx);
+    if(!EVP_DigestFinal_ex(_ctx, &md[0], 0))
+    {
+        throwDigestException(__FILE__, __LINE__);
+    }
 #   endif
 }
 
@@ -183,6 +296,9 @@ IceUtilInternal::sha1(const unsigned char* data, size_t length, vector<unsigned
     CC_SHA1(&data[0], length, &md[0]);
 #else
     md.resize(SHA_DIGEST_LENGTH);
-    ::SHA1(&data[0], length, &md[0]);
+    if(!EVP_Digest(reinterpret_cast<const void*>(data), length, &md[0], 0, getDigest(), 0))
+    {
+        throwDigestException(__FILE__, __LINE__);
+    }
 #endif
 }
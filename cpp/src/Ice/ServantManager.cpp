@@ -13,6 +13,7 @@
 #include <Ice/LoggerUtil.h>
 #include <Ice/Instance.h>
 #include <Ice/StringUtil.h>
+#include <Ice/HashUtil.h>
 
 using namespace std;
 using namespace Ice;
@@ -27,36 +28,29 @@ IceInternal::ServantManager::addServant(const ObjectPtr& object, const Identity&
 
     assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
+    unsigned int hash = hashIdentity(ident);
+    ServantStripe& stripe = servantStripe(hash);
+    IceUtil::Mutex::Lock stripeSync(stripe);
 
-    if(p == _servantMapMap.end() || p->first != ident)
+    FacetMap* facets = stripe.find(ident, hash);
+    if(!facets)
     {
-        p = _servantMapMap.find(ident);
+        facets = &stripe.insert(ident, hash);
     }
-
-    if(p == _servantMapMap.end())
+    else if(facets->find(facet) != facets->end())
     {
-        p = _servantMapMap.insert(_servantMapMapHint, pair<const Identity, FacetMap>(ident, FacetMap()));
-    }
-    else
-    {
-        if(p->second.find(facet) != p->second.end())
+        AlreadyRegisteredException ex(__FILE__, __LINE__);
+        ex.kindOfObject = "servant";
+        ToStringMode toStringMode = _instance->toStringMode();
+        ex.id = Ice::identityToString(ident, toStringMode);
+        if(!facet.empty())
         {
-            AlreadyRegisteredException ex(__FILE__, __LINE__);
-            ex.kindOfObject = "servant";
-            ToStringMode toStringMode = _instance->toStringMode();
-            ex.id = Ice::identityToString(ident, toStringMode);
-            if(!facet.empty())
-            {
-                ex.id += " -f " + escapeString(facet, "", toStringMode);
-            }
-            throw ex;
+            ex.id += " -f " + escapeString(facet, "", toStringMode);
         }
+        throw ex;
     }
 
-    _servantMapMapHint = p;
-
-    p->second.insert(pair<const string, ObjectPtr>(facet, object));
+    facets->insert(pair<const string, ObjectPtr>(facet, object));
 }
 
 void
@@ -92,15 +86,14 @@ IceInternal::ServantManager::removeServant(const Identity& ident, const string&
 
     assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-    FacetMap::iterator q;
+    unsigned int hash = hashIdentity(ident);
+    ServantStripe& stripe = servantStripe(hash);
+    IceUtil::Mutex::Lock stripeSync(stripe);
 
-    if(p == _servantMapMap.end() || p->first != ident)
-    {
-        p = _servantMapMap.find(ident);
-    }
+    FacetMap* facets = stripe.find(ident, hash);
+    FacetMap::iterator q;
 
-    if(p == _servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
+    if(!facets || (q = facets->find(facet)) == facets->end())
     {
         NotRegisteredException ex(__FILE__, __LINE__);
         ex.kindOfObject = "servant";
@@ -114,19 +107,11 @@ IceInternal::ServantManager::removeServant(const Identity& ident, const string&
     }
 
     servant = q->second;
-    p->second.erase(q);
+    facets->erase(q);
 
-    if(p->second.empty())
+    if(facets->empty())
     {
-        if(p == _servantMapMapHint)
-        {
-            _servantMapMap.erase(p++);
-            _servantMapMapHint = p;
-        }
-        else
-        {
-            _servantMapMap.erase(p);
-        }
+        stripe.erase(ident, hash);
     }
     return servant;
 }
@@ -167,14 +152,12 @@ IceInternal::ServantManager::removeAllFacets(const Identity& ident)
 
     assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-
-    if(p == _servantMapMap.end() || p->first != ident)
-    {
-        p = _servantMapMap.find(ident);
-    }
+    unsigned int hash = hashIdentity(ident);
+    ServantStripe& stripe = servantStripe(hash);
+    IceUtil::Mutex::Lock stripeSync(stripe);
 
-    if(p == _servantMapMap.end())
+    FacetMap* facets = stripe.find(ident, hash);
+    if(!facets)
     {
         NotRegisteredException ex(__FILE__, __LINE__);
         ex.kindOfObject = "servant";
@@ -182,26 +165,15 @@ IceInternal::ServantManager::removeAllFacets(const Identity& ident)
         throw ex;
     }
 
-    FacetMap result = p->second;
-
-    if(p == _servantMapMapHint)
-    {
-        _servantMapMap.erase(p++);
-        _servantMapMapHint = p;
-    }
-    else
-    {
-        _servantMapMap.erase(p);
-    }
-
+    FacetMap result;
+    result.swap(*facets);
+    stripe.erase(ident, hash);
     return result;
 }
 
 ObjectPtr
 IceInternal::ServantManager::findServant(const Identity& ident, const string& facet) const
 {
-    IceUtil::Mutex::Lock sync(*this);
-
     //
     // This assert is not valid if the adapter dispatch incoming
     // requests from bidir connections. This method might be called if
@@ -210,30 +182,31 @@ IceInternal::ServantManager::findServant(const Identity& ident, const string& fa
     //
     //assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-    FacetMap::iterator q;
-
-    ServantMapMap& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
-
-    if(p == servantMapMap.end() || p->first != ident)
+    unsigned int hash = hashIdentity(ident);
     {
-        p = servantMapMap.find(ident);
+        ServantStripe& stripe = servantStripe(hash);
+        IceUtil::Mutex::Lock stripeSync(stripe);
+
+        FacetMap* facets = stripe.find(ident, hash);
+        if(facets)
+        {
+            FacetMap::const_iterator q = facets->find(facet);
+            if(q != facets->end())
+            {
+                return q->second;
+            }
+        }
     }
 
-    if(p == servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
+    IceUtil::Mutex::Lock sync(*this);
+
+    DefaultServantMap::const_iterator p = _defaultServantMap.find(ident.category);
+    if(p == _defaultServantMap.end())
     {
-        DefaultServantMap::const_iterator p = _defaultServantMap.find(ident.category);
+        p = _defaultServantMap.find("");
         if(p == _defaultServantMap.end())
         {
-            p = _defaultServantMap.find("");
-            if(p == _defaultServantMap.end())
-            {
-                return 0;
-            }
-            else
-            {
-                return p->second;
-            }
+            return 0;
         }
         else
         {
@@ -242,8 +215,7 @@ IceInternal::ServantManager::findServant(const Identity& ident, const string& fa
     }
     else
     {
-        _servantMapMapHint = p;
-        return q->second;
+        return p->second;
     }
 }
 
@@ -266,35 +238,24 @@ IceInternal::ServantManager::findDefaultServant(const string& category) const
 FacetMap
 IceInternal::ServantManager::findAllFacets(const Identity& ident) const
 {
-    IceUtil::Mutex::Lock sync(*this);
-
-    assert(_instance); // Must not be called after destruction.
-
-    ServantMapMap::iterator p = _servantMapMapHint;
-
-    ServantMapMap& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
-
-    if(p == servantMapMap.end() || p->first != ident)
-    {
-        p = servantMapMap.find(ident);
-    }
+    unsigned int hash = hashIdentity(ident);
+    ServantStripe& stripe = servantStripe(hash);
+    IceUtil::Mutex::Lock stripeSync(stripe);
 
-    if(p == servantMapMap.end())
+    FacetMap* facets = stripe.find(ident, hash);
+    if(!facets)
     {
         return FacetMap();
     }
     else
     {
-        _servantMapMapHint = p;
-        return p->second;
+        return *facets;
     }
 }
 
 bool
 IceInternal::ServantManager::hasServant(const Identity& ident) const
 {
-    IceUtil::Mutex::Lock sync(*this);
-
     //
     // This assert is not valid if the adapter dispatch incoming
     // requests from bidir connections. This method might be called if
@@ -303,24 +264,13 @@ IceInternal::ServantManager::hasServant(const Identity& ident) const
     //
     //assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-    ServantMapMap& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
-
-    if(p == servantMapMap.end() || p->first != ident)
-    {
-        p = servantMapMap.find(ident);
-    }
+    unsigned int hash = hashIdentity(ident);
+    ServantStripe& stripe = servantStripe(hash);
+    IceUtil::Mutex::Lock stripeSync(stripe);
 
-    if(p == servantMapMap.end())
-    {
-        return false;
-    }
-    else
-    {
-        _servantMapMapHint = p;
-        assert(!p->second.empty());
-        return true;
-    }
+    FacetMap* facets = stripe.find(ident, hash);
+    assert(!facets || !facets->empty());
+    return facets != 0;
 }
 
 void
@@ -421,7 +371,6 @@ IceInternal::ServantManager::findServantLocator(const string& category) const
 IceInternal::ServantManager::ServantManager(const InstancePtr& instance, const string& adapterName)
     : _instance(instance),
       _adapterName(adapterName),
-      _servantMapMapHint(_servantMapMap.end()),
       _locatorMapHint(_locatorMap.end())
 {
 }
@@ -439,7 +388,7 @@ IceInternal::ServantManager::~ServantManager()
 void
 IceInternal::ServantManager::destroy()
 {
-    ServantMapMap servantMapMap;
+    ServantList servants;
     DefaultServantMap defaultServantMap;
     map<string, ServantLocatorPtr> locatorMap;
     Ice::LoggerPtr logger;
@@ -456,8 +405,11 @@ IceInternal::ServantManager::destroy()
 
         logger = _instance->initializationData().logger;
 
-        servantMapMap.swap(_servantMapMap);
-        _servantMapMapHint = _servantMapMap.end();
+        for(unsigned int i = 0; i < servantStripeCount; ++i)
+        {
+            IceUtil::Mutex::Lock stripeSync(_servantStripes[i]);
+            _servantStripes[i].clear(servants);
+        }
 
         defaultServantMap.swap(_defaultServantMap);
 
@@ -495,7 +447,127 @@ IceInternal::ServantManager::destroy()
     // hold any internal Ice mutex while running user code (such as servant
     // or servant locator destructors).
     //
-    servantMapMap.clear();
+    servants.clear();
     locatorMap.clear();
     defaultServantMap.clear();
 }
+
+unsigned int
+IceInternal::ServantManager::hashIdentity(const Identity& ident)
+{
+    Int h = 5381;
+    hashAdd(h, ident.name);
+    hashAdd(h, ident.category);
+
+    //
+    // The low bits of the hash select the stripe and the bucket, mix
+    // all the bits of the hash into them.
+    //
+    unsigned int hash = static_cast<unsigned int>(h);
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6b;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+IceInternal::ServantManager::ServantStripe&
+IceInternal::ServantManager::servantStripe(unsigned int hash) const
+{
+    return _servantStripes[hash & (servantStripeCount - 1)];
+}
+
+IceInternal::ServantManager::ServantStripe::ServantStripe() :
+    _size(0)
+{
+}
+
+FacetMap*
+IceInternal::ServantManager::ServantStripe::find(const Identity& ident, unsigned int hash)
+{
+    if(_size == 0)
+    {
+        return 0;
+    }
+
+    ServantList& servants = bucket(hash);
+    for(ServantList::iterator p = servants.begin(); p != servants.end(); ++p)
+    {
+        if(p->hash == hash && p->id == ident)
+        {
+            return &p->facets;
+        }
+    }
+    return 0;
+}
+
+FacetMap&
+IceInternal::ServantManager::ServantStripe::insert(const Identity& ident, unsigned int hash)
+{
+    if(_size >= _buckets.size())
+    {
+        rehash(_buckets.empty() ? 8 : _buckets.size() * 2);
+    }
+
+    ServantEntry entry;
+    entry.id = ident;
+    entry.hash = hash;
+    ServantList& servants = bucket(hash);
+    servants.push_front(entry);
+    ++_size;
+    return servants.front().facets;
+}
+
+void
+IceInternal::ServantManager::ServantStripe::erase(const Identity& ident, unsigned int hash)
+{
+    ServantList& servants = bucket(hash);
+    for(ServantList::iterator p = servants.begin(); p != servants.end(); ++p)
+    {
+        if(p->hash == hash && p->id == ident)
+        {
+            servants.erase(p);
+            --_size;
+            return;
+        }
+    }
+    assert(false);
+}
+
+void
+IceInternal::ServantManager::ServantStripe::clear(ServantList& servants)
+{
+    for(vector<ServantList>::iterator p = _buckets.begin(); p != _buckets.end(); ++p)
+    {
+        servants.splice(servants.end(), *p);
+    }
+    _buckets.clear();
+    _size = 0;
+}
+
+IceInternal::ServantManager::ServantList&
+IceInternal::ServantManager::ServantStripe::bucket(unsigned int hash)
+{
+    assert(!_buckets.empty());
+    return _buckets[(hash >> servantStripeBits) & (_buckets.size() - 1)];
+}
+
+void
+IceInternal::ServantManager::ServantStripe::rehash(size_t size)
+{
+    //
+    // The entries are moved to their new bucket with their cached hash,
+    // the identities aren't hashed again.
+    //
+    vector<ServantList> buckets(size);
+    buckets.swap(_buckets);
+    for(vector<ServantList>::iterator p = buckets.begin(); p != buckets.end(); ++p)
+    {
+        while(!p->empty())
+        {
+            ServantList& servants = bucket(p->front().hash);
+            servants.splice(servants.begin(), *p, p->begin());
+        }
+    }
+}
@@ -18,6 +18,8 @@
 #include <Ice/Identity.h>
 #include <Ice/FacetMap.h>
 
+#include <list>
+
 namespace Ice
 {
 
@@ -57,11 +59,51 @@ private:
 
     const std::string _adapterName;
 
-    typedef std::map<Ice::Identity, Ice::FacetMap> ServantMapMap;
+    //
+    // The active servant map is a hash table split in stripes, each
+    // with its own mutex, so that the dispatch threads looking up
+    // servants don't all contend for the servant manager mutex. The
+    // identity hash is kept with each entry, it's compared before the
+    // identity and the buckets are rehashed without hashing again.
+    // Updates lock the servant manager mutex before the stripe mutex.
+    //
+    struct ServantEntry
+    {
+        Ice::Identity id;
+        unsigned int hash;
+        Ice::FacetMap facets;
+    };
+    typedef std::list<ServantEntry> ServantList;
+
+    class ServantStripe : public IceUtil::Mutex
+    {
+    public:
+
+        ServantStripe();
+
+        Ice::FacetMap* find(const Ice::Identity&, unsigned int);
+        Ice::FacetMap& insert(const Ice::Identity&, unsigned int);
+        void erase(const Ice::Identity&, unsigned int);
+        void clear(ServantList&);
+
+    private:
+
+        ServantList& bucket(unsigned int);
+        void rehash(size_t);
+
+        std::vector<ServantList> _buckets;
+        size_t _size;
+    };
+
+    static const unsigned int servantStripeBits = 5;
+    static const unsigned int servantStripeCount = 1 << servantStripeBits;
+
+    static unsigned int hashIdentity(const Ice::Identity&);
+    ServantStripe& servantStripe(unsigned int) const;
+
     typedef std::map<std::string, Ice::ObjectPtr> DefaultServantMap;
 
-    ServantMapMap _servantMapMap;
-    mutable ServantMapMap::iterator _servantMapMapHint;
+    mutable ServantStripe _servantStripes[servantStripeCount];
 
     DefaultServantMap _defaultServantMap;
 
@@ -148,6 +148,58 @@ private:
 template<typename T, typename C, typename H>
 struct Codec;
 
+//
+// View gives access to a marshaled key or data without copying it
+// from the memory mapped by LMDB. The value is only unmarshaled by
+// read(), this allows to skip or filter entries without unmarshaling
+// them.
+//
+// A view is only valid until the end of the transaction which
+// returned it, or until the entry is updated or deleted.
+//
+template<typename T, typename C, typename H>
+class View
+{
+public:
+
+    View()
+    {
+        _val.mv_size = 0;
+        _val.mv_data = 0;
+    }
+
+    View(const MDB_val& val, const C& ctx) :
+        _val(val),
+        _marshalingContext(ctx)
+    {
+    }
+
+    void read(T& t) const
+    {
+        Codec<T, C, H>::read(t, _val, _marshalingContext);
+    }
+
+    const MDB_val& mval() const
+    {
+        return _val;
+    }
+
+    const unsigned char* data() const
+    {
+        return static_cast<const unsigned char*>(_val.mv_data);
+    }
+
+    size_t size() const
+    {
+        return _val.mv_size;
+    }
+
+private:
+
+    MDB_val _val;
+    C _marshalingContext;
+};
+
 class ICE_DB_API Env
 {
 public:
@@ -271,6 +323,39 @@ public:
         return false;
     }
 
+    bool get(const Txn& txn, const K& key, View<D, C, H>& data) const
+    {
+        unsigned char kbuf[maxKeySize];
+        MDB_val mkey = {maxKeySize, kbuf};
+
+        if(Codec<K, C, H>::write(key, mkey, _marshalingContext))
+        {
+            MDB_val mdata;
+            if(DbiBase::get(txn, &mkey, &mdata))
+            {
+                data = View<D, C, H>(mdata, _marshalingContext);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //
+    // Get the data with an already marshaled key, for example a view
+    // returned by another database.
+    //
+    bool get(const Txn& txn, const View<K, C, H>& key, D& data) const
+    {
+        MDB_val mkey = key.mval();
+        MDB_val mdata;
+        if(DbiBase::get(txn, &mkey, &mdata))
+        {
+            Codec<D, C, H>::read(data, mdata, _marshalingContext);
+            return true;
+        }
+        return false;
+    }
+
     void put(const ReadWriteTxn& txn, const K& key, const D& data, unsigned int flags = 0)
     {
         unsigned char kbuf[maxKeySize];
@@ -410,6 +495,18 @@ public:
         return false;
     }
 
+    bool get(View<K, C, H>& key, View<D, C, H>& data, MDB_cursor_op op)
+    {
+        MDB_val mkey, mdata;
+        if(CursorBase::get(&mkey, &mdata, op))
+        {
+            key = View<K, C, H>(mkey, _marshalingContext);
+            data = View<D, C, H>(mdata, _marshalingContext);
+            return true;
+        }
+        return false;
+    }
+
     bool find(const K& key)
     {
         unsigned char kbuf[maxKeySize];
@@ -440,6 +537,22 @@ public:
         return false;
     }
 
+    bool find(const K& key, View<D, C, H>& data)
+    {
+        unsigned char kbuf[maxKeySize];
+        MDB_val mkey = {maxKeySize, kbuf};
+        if(Codec<K, C, H>::write(key, mkey, _marshalingContext))
+        {
+            MDB_val mdata;
+            if(CursorBase::find(&mkey, &mdata))
+            {
+                data = View<D, C, H>(mdata, _marshalingContext);
+                return true;
+            }
+        }
+        return false;
+    }
+
 protected:
 
     C _marshalingContext;
@@ -21,7 +21,8 @@ using namespace Ice;
 using namespace IceDiscovery;
 
 LocatorRegistryI::LocatorRegistryI(const Ice::CommunicatorPtr& com) :
-    _wellKnownProxy(com->stringToProxy("p")->ice_locator(0)->ice_router(0)->ice_collocationOptimized(true))
+    _wellKnownProxy(com->stringToProxy("p")->ice_locator(0)->ice_router(0)->ice_collocationOptimized(true)),
+    _domainId(com->getProperties()->getProperty("IceDiscovery.DomainId"))
 {
 }
 
@@ -41,15 +42,18 @@ LocatorRegistryI::setAdapterDirectProxy_async(const AMD_LocatorRegistry_setAdapt
                                               const Current&)
 #endif
 {
-    Lock sync(*this);
-    if(proxy)
-    {
-        _adapters[adapterId] = proxy;
-    }
-    else
     {
-        _adapters.erase(adapterId);
+        Lock sync(*this);
+        if(proxy)
+        {
+            _adapters[adapterId] = proxy;
+        }
+        else
+        {
+            _adapters.erase(adapterId);
+        }
     }
+    announce(adapterId, proxy, false);
 #ifdef ICE_CPP11_MAPPING
     response();
 #else
@@ -75,30 +79,34 @@ LocatorRegistryI::setReplicatedAdapterDirectProxy_async(
     const Current&)
 #endif
 {
-    Lock sync(*this);
-    if(proxy)
     {
-        _adapters[adapterId] = proxy;
-        map<string, set<string> >::iterator p = _replicaGroups.find(replicaGroupId);
-        if(p == _replicaGroups.end())
+        Lock sync(*this);
+        if(proxy)
         {
-            p = _replicaGroups.insert(make_pair(replicaGroupId, set<string>())).first;
+            _adapters[adapterId] = proxy;
+            map<string, set<string> >::iterator p = _replicaGroups.find(replicaGroupId);
+            if(p == _replicaGroups.end())
+            {
+                p = _replicaGroups.insert(make_pair(replicaGroupId, set<string>())).first;
+            }
+            p->second.insert(adapterId);
         }
-        p->second.insert(adapterId);
-    }
-    else
-    {
-        _adapters.erase(adapterId);
-        map<string, set<string> >::iterator p = _replicaGroups.find(replicaGroupId);
-        if(p != _replicaGroups.end())
+        else
         {
-            p->second.erase(adapterId);
-            if(p->second.empty())
+            _adapters.erase(adapterId);
+            map<string, set<string> >::iterator p = _replicaGroups.find(replicaGroupId);
+            if(p != _replicaGroups.end())
             {
-                _replicaGroups.erase(p);
+                p->second.erase(adapterId);
+                if(p->second.empty())
+                {
+                    _replicaGroups.erase(p);
+                }
             }
         }
     }
+    announce(adapterId, proxy, false);
+    announce(replicaGroupId, proxy, true);
 #ifdef ICE_CPP11_MAPPING
     response();
 #else
@@ -222,6 +230,39 @@ LocatorRegistryI::findAdapter(const string& adapterId, bool& isReplicaGroup) con
     return 0;
 }
 
+void
+LocatorRegistryI::setAnnounce(const AnnouncePrxPtr& announce)
+{
+    Lock sync(*this);
+    _announce = announce;
+}
+
+void
+LocatorRegistryI::announce(const string& adapterId, const Ice::ObjectPrxPtr& proxy, bool isReplicaGroup)
+{
+    AnnouncePrxPtr announce;
+    {
+        Lock sync(*this);
+        announce = _announce;
+    }
+
+    if(announce)
+    {
+        try
+        {
+#ifdef ICE_CPP11_MAPPING
+            announce->adapterAnnouncedAsync(_domainId, adapterId, proxy, isReplicaGroup);
+#else
+            announce->begin_adapterAnnounced(_domainId, adapterId, proxy, isReplicaGroup);
+#endif
+        }
+        catch(const Ice::LocalException&)
+        {
+            // Ignore.
+        }
+    }
+}
+
 LocatorI::LocatorI(const LookupIPtr& lookup, const LocatorRegistryPrxPtr& registry) : _lookup(lookup), _registry(registry)
 {
 }
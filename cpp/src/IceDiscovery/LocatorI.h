@@ -12,6 +12,7 @@
 
 #include <Ice/Locator.h>
 #include <Ice/ProxyF.h>
+#include <IceDiscovery/IceDiscovery.h>
 
 #include <set>
 
@@ -63,9 +64,15 @@ public:
     Ice::ObjectPrxPtr findObject(const Ice::Identity&) const;
     Ice::ObjectPrxPtr findAdapter(const std::string&, bool&) const;
 
+    void setAnnounce(const AnnouncePrxPtr&);
+
 private:
 
+    void announce(const std::string&, const Ice::ObjectPrxPtr&, bool);
+
     const Ice::ObjectPrxPtr _wellKnownProxy;
+    const std::string _domainId;
+    AnnouncePrxPtr _announce;
     std::map<std::string, Ice::ObjectPrxPtr> _adapters;
     std::map<std::string, std::set<std::string> > _replicaGroups;
 };
@@ -56,47 +56,16 @@ AdapterRequest::response(const Ice::ObjectPrxPtr& proxy, bool isReplicaGroup)
     return true;
 }
 
-#ifdef ICE_CPP11_MAPPING
-void
-AdapterRequest::finished(const Ice::ObjectPrxPtr& proxy)
+Ice::ObjectPrxPtr
+AdapterRequest::getProxy() const
 {
-    if(proxy || _proxies.empty())
+    if(_proxies.empty())
     {
-        Request<string>::finished(proxy);
-        return;
+        return 0;
     }
     else if(_proxies.size() == 1)
     {
-        Request<string>::finished(_proxies[0]);
-        return;
-    }
-
-    EndpointSeq endpoints;
-    shared_ptr<ObjectPrx> prx;
-    for(vector<shared_ptr<ObjectPrx>>::const_iterator p = _proxies.begin(); p != _proxies.end(); ++p)
-    {
-        if(!prx)
-        {
-            prx = *p;
-        }
-        Ice::EndpointSeq endpts = (*p)->ice_getEndpoints();
-        copy(endpts.begin(), endpts.end(), back_inserter(endpoints));
-    }
-    Request<string>::finished(prx->ice_endpoints(endpoints));
-}
-#else
-void
-AdapterRequest::finished(const Ice::ObjectPrxPtr& proxy)
-{
-    if(proxy || _proxies.empty())
-    {
-        RequestT<std::string, Ice::AMD_Locator_findAdapterByIdPtr>::finished(proxy);
-        return;
-    }
-    else if(_proxies.size() == 1)
-    {
-        RequestT<std::string, Ice::AMD_Locator_findAdapterByIdPtr>::finished(_proxies[0]);
-        return;
+        return _proxies[0];
     }
 
     Ice::EndpointSeq endpoints;
@@ -110,9 +79,18 @@ AdapterRequest::finished(const Ice::ObjectPrxPtr& proxy)
         Ice::EndpointSeq endpts = (*p)->ice_getEndpoints();
         copy(endpts.begin(), endpts.end(), back_inserter(endpoints));
     }
-    RequestT<std::string, Ice::AMD_Locator_findAdapterByIdPtr>::finished(prx->ice_endpoints(endpoints));
+    return prx->ice_endpoints(endpoints);
 }
+
+void
+AdapterRequest::finished(const Ice::ObjectPrxPtr& proxy)
+{
+#ifdef ICE_CPP11_MAPPING
+    Request<string>::finished(proxy ? proxy : getProxy());
+#else
+    RequestT<std::string, Ice::AMD_Locator_findAdapterByIdPtr>::finished(proxy ? proxy : getProxy());
 #endif
+}
 
 void
 AdapterRequest::runTimerTask()
@@ -132,6 +110,29 @@ ObjectRequest::runTimerTask()
     _lookup->objectRequestTimedOut(ICE_SHARED_FROM_THIS);
 }
 
+namespace
+{
+
+class BatchFlushTask : public IceUtil::TimerTask
+{
+public:
+
+    BatchFlushTask(const LookupIPtr& lookup) : _lookup(lookup)
+    {
+    }
+
+    virtual void runTimerTask()
+    {
+        _lookup->flushBatchRequests();
+    }
+
+private:
+
+    const LookupIPtr _lookup;
+};
+
+}
+
 LookupI::LookupI(const LocatorRegistryIPtr& registry, const LookupPrxPtr& lookup, const Ice::PropertiesPtr& properties) :
     _registry(registry),
     _lookup(lookup),
@@ -139,7 +140,11 @@ LookupI::LookupI(const LocatorRegistryIPtr& registry, const LookupPrxPtr& lookup
     _retryCount(properties->getPropertyAsIntWithDefault("IceDiscovery.RetryCount", 3)),
     _latencyMultiplier(properties->getPropertyAsIntWithDefault("IceDiscovery.LatencyMultiplier", 1)),
     _domainId(properties->getProperty("IceDiscovery.DomainId")),
-    _timer(IceInternal::getInstanceTimer(lookup->ice_getCommunicator()))
+    _batchDelay(IceUtil::Time::milliSeconds(properties->getPropertyAsInt("IceDiscovery.BatchDelay"))),
+    _cacheTimeout(IceUtil::Time::milliSeconds(properties->getPropertyAsInt("IceDiscovery.CacheTimeout"))),
+    _negativeCacheTimeout(IceUtil::Time::milliSeconds(properties->getPropertyAsInt("IceDiscovery.NegativeCacheTimeout"))),
+    _timer(IceInternal::getInstanceTimer(lookup->ice_getCommunicator())),
+    _lookupBatch(ICE_UNCHECKED_CAST(LookupPrx, lookup->ice_batchDatagram()))
 {
 }
 
@@ -163,6 +168,13 @@ LookupI::destroy()
         _timer->cancel(p->second);
     }
     _adapterRequests.clear();
+
+    if(_batchFlush)
+    {
+        _timer->cancel(_batchFlush);
+        _batchFlush = ICE_NULLPTR;
+    }
+    _replyBatches.clear();
 }
 
 void
@@ -193,11 +205,28 @@ LookupI::findObjectById(const string& domainId, const Ice::Identity& id, const I
         //
         try
         {
+            if(_batchDelay > IceUtil::Time())
+            {
+                //
+                // The reply is queued with the lock held, the batch could
+                // otherwise be flushed before the reply is queued.
+                //
+                Lock sync(*this);
+                LookupReplyPrxPtr batch = getReplyBatch(reply);
+#ifdef ICE_CPP11_MAPPING
+                batch->foundObjectByIdAsync(id, proxy);
+#else
+                batch->begin_foundObjectById(id, proxy);
+#endif
+            }
+            else
+            {
 #ifdef ICE_CPP11_MAPPING
-            reply->foundObjectByIdAsync(id, proxy);
+                reply->foundObjectByIdAsync(id, proxy);
 #else
-            reply->begin_foundObjectById(id, proxy);
+                reply->begin_foundObjectById(id, proxy);
 #endif
+            }
         }
         catch(const Ice::LocalException&)
         {
@@ -229,11 +258,28 @@ LookupI::findAdapterById(const string& domainId, const string& adapterId, const
         //
         try
         {
+            if(_batchDelay > IceUtil::Time())
+            {
+                //
+                // The reply is queued with the lock held, the batch could
+                // otherwise be flushed before the reply is queued.
+                //
+                Lock sync(*this);
+                LookupReplyPrxPtr batch = getReplyBatch(reply);
 #ifdef ICE_CPP11_MAPPING
-            reply->foundAdapterByIdAsync(adapterId, proxy, isReplicaGroup);
+                batch->foundAdapterByIdAsync(adapterId, proxy, isReplicaGroup);
 #else
-            reply->begin_foundAdapterById(adapterId, proxy, isReplicaGroup);
+                batch->begin_foundAdapterById(adapterId, proxy, isReplicaGroup);
 #endif
+            }
+            else
+            {
+#ifdef ICE_CPP11_MAPPING
+                reply->foundAdapterByIdAsync(adapterId, proxy, isReplicaGroup);
+#else
+                reply->begin_foundAdapterById(adapterId, proxy, isReplicaGroup);
+#endif
+            }
         }
         catch(const Ice::LocalException&)
         {
@@ -247,6 +293,13 @@ void
 LookupI::findObject(function<void(const shared_ptr<Ice::ObjectPrx>&)> response, const Ice::Identity& id)
 {
     Lock sync(*this);
+    shared_ptr<Ice::ObjectPrx> proxy;
+    if(findCached(_objectCache, id, proxy))
+    {
+        response(proxy);
+        return;
+    }
+
     map<Ice::Identity, ObjectRequestPtr>::iterator p = _objectRequests.find(id);
     if(p == _objectRequests.end())
     {
@@ -257,7 +310,7 @@ LookupI::findObject(function<void(const shared_ptr<Ice::ObjectPrx>&)> response,
     {
         try
         {
-            _lookup->findObjectByIdAsync(_domainId, id, _lookupReply);
+            sendFindObject(id);
             _timer->schedule(p->second, _timeout);
         }
         catch(const Ice::LocalException&)
@@ -272,6 +325,13 @@ void
 LookupI::findAdapter(function<void(const shared_ptr<Ice::ObjectPrx>&)> response, const std::string& adapterId)
 {
     Lock sync(*this);
+    shared_ptr<Ice::ObjectPrx> proxy;
+    if(findCached(_adapterCache, adapterId, proxy))
+    {
+        response(proxy);
+        return;
+    }
+
     map<string, AdapterRequestPtr>::iterator p = _adapterRequests.find(adapterId);
     if(p == _adapterRequests.end())
     {
@@ -282,7 +342,7 @@ LookupI::findAdapter(function<void(const shared_ptr<Ice::ObjectPrx>&)> response,
     {
         try
         {
-            _lookup->findAdapterByIdAsync(_domainId, adapterId, _lookupReply);
+            sendFindAdapter(adapterId);
             _timer->schedule(p->second, _timeout);
         }
         catch(const Ice::LocalException&)
@@ -297,6 +357,13 @@ void
 LookupI::findObject(const Ice::AMD_Locator_findObjectByIdPtr& cb, const Ice::Identity& id)
 {
     Lock sync(*this);
+    Ice::ObjectPrxPtr proxy;
+    if(findCached(_objectCache, id, proxy))
+    {
+        cb->ice_response(proxy);
+        return;
+    }
+
     map<Ice::Identity, ObjectRequestPtr>::iterator p = _objectRequests.find(id);
     if(p == _objectRequests.end())
     {
@@ -307,7 +374,7 @@ LookupI::findObject(const Ice::AMD_Locator_findObjectByIdPtr& cb, const Ice::Ide
     {
         try
         {
-            _lookup->begin_findObjectById(_domainId, id, _lookupReply);
+            sendFindObject(id);
             _timer->schedule(p->second, _timeout);
         }
         catch(const Ice::LocalException&)
@@ -322,6 +389,13 @@ void
 LookupI::findAdapter(const Ice::AMD_Locator_findAdapterByIdPtr& cb, const std::string& adapterId)
 {
     Lock sync(*this);
+    Ice::ObjectPrxPtr proxy;
+    if(findCached(_adapterCache, adapterId, proxy))
+    {
+        cb->ice_response(proxy);
+        return;
+    }
+
     map<string, AdapterRequestPtr>::iterator p = _adapterRequests.find(adapterId);
     if(p == _adapterRequests.end())
     {
@@ -332,7 +406,7 @@ LookupI::findAdapter(const Ice::AMD_Locator_findAdapterByIdPtr& cb, const std::s
     {
         try
         {
-            _lookup->begin_findAdapterById(_domainId, adapterId, _lookupReply);
+            sendFindAdapter(adapterId);
             _timer->schedule(p->second, _timeout);
         }
         catch(const Ice::LocalException&)
@@ -357,6 +431,7 @@ LookupI::foundObject(const Ice::Identity& id, const Ice::ObjectPrxPtr& proxy)
     p->second->response(proxy);
     _timer->cancel(p->second);
     _objectRequests.erase(p);
+    cache(_objectCache, id, proxy);
 }
 
 void
@@ -373,6 +448,7 @@ LookupI::foundAdapter(const std::string& adapterId, const Ice::ObjectPrxPtr& pro
     {
         _timer->cancel(p->second);
         _adapterRequests.erase(p);
+        cache(_adapterCache, adapterId, proxy);
     }
 }
 
@@ -390,11 +466,7 @@ LookupI::objectRequestTimedOut(const ObjectRequestPtr& request)
     {
         try
         {
-#ifdef ICE_CPP11_MAPPING
-            _lookup->findObjectByIdAsync(_domainId, request->getId(), _lookupReply);
-#else
-            _lookup->begin_findObjectById(_domainId, request->getId(), _lookupReply);
-#endif
+            sendFindObject(request->getId());
             _timer->schedule(p->second, _timeout);
             return;
         }
@@ -402,6 +474,10 @@ LookupI::objectRequestTimedOut(const ObjectRequestPtr& request)
         {
         }
     }
+    else
+    {
+        cache(_objectCache, request->getId(), 0);
+    }
 
     request->finished(0);
     _objectRequests.erase(p);
@@ -422,11 +498,7 @@ LookupI::adapterRequestTimedOut(const AdapterRequestPtr& request)
     {
         try
         {
-#ifdef ICE_CPP11_MAPPING
-            _lookup->findAdapterByIdAsync(_domainId, request->getId(), _lookupReply);
-#else
-            _lookup->begin_findAdapterById(_domainId, request->getId(), _lookupReply);
-#endif
+            sendFindAdapter(request->getId());
             _timer->schedule(p->second, _timeout);
             return;
         }
@@ -434,12 +506,228 @@ LookupI::adapterRequestTimedOut(const AdapterRequestPtr& request)
         {
         }
     }
+    else
+    {
+        cache(_adapterCache, request->getId(), request->getProxy());
+    }
 
     request->finished(0);
     _adapterRequests.erase(p);
     _timer->cancel(request);
 }
 
+void
+LookupI::adapterAnnounced(const string& domainId, const string& adapterId, const Ice::ObjectPrxPtr& proxy,
+                          bool isReplicaGroup)
+{
+    if(domainId != _domainId)
+    {
+        return; // Ignore.
+    }
+
+    Lock sync(*this);
+
+    //
+    // The members of a replica group announce themselves separately, the
+    // cached replica group proxy is no longer accurate. Deactivated
+    // adapters are announced with a null proxy.
+    //
+    if(isReplicaGroup || !proxy || _cacheTimeout <= IceUtil::Time())
+    {
+        _adapterCache.erase(adapterId);
+    }
+    else
+    {
+        cache(_adapterCache, adapterId, proxy);
+    }
+
+    //
+    // Objects that weren't found might be hosted by the announced adapter.
+    //
+    map<Ice::Identity, CacheEntry>::iterator p = _objectCache.begin();
+    while(p != _objectCache.end())
+    {
+        if(!p->second.proxy)
+        {
+            _objectCache.erase(p++);
+        }
+        else
+        {
+            ++p;
+        }
+    }
+}
+
+void
+LookupI::flushBatchRequests()
+{
+    Lock sync(*this);
+    _batchFlush = ICE_NULLPTR;
+
+    try
+    {
+#ifdef ICE_CPP11_MAPPING
+        _lookupBatch->ice_flushBatchRequestsAsync();
+#else
+        _lookupBatch->begin_ice_flushBatchRequests();
+#endif
+    }
+    catch(const Ice::LocalException&)
+    {
+        // Ignore, the lookup requests are retried.
+    }
+
+    for(ReplyBatchSet::const_iterator p = _replyBatches.begin(); p != _replyBatches.end(); ++p)
+    {
+        try
+        {
+#ifdef ICE_CPP11_MAPPING
+            (*p)->ice_flushBatchRequestsAsync();
+#else
+            (*p)->begin_ice_flushBatchRequests();
+#endif
+        }
+        catch(const Ice::LocalException&)
+        {
+            // Ignore.
+        }
+    }
+    _replyBatches.clear();
+}
+
+void
+LookupI::sendFindObject(const Ice::Identity& id)
+{
+    if(_batchDelay > IceUtil::Time())
+    {
+#ifdef ICE_CPP11_MAPPING
+        _lookupBatch->findObjectByIdAsync(_domainId, id, _lookupReply);
+#else
+        _lookupBatch->begin_findObjectById(_domainId, id, _lookupReply);
+#endif
+        scheduleBatchFlush();
+    }
+    else
+    {
+#ifdef ICE_CPP11_MAPPING
+        _lookup->findObjectByIdAsync(_domainId, id, _lookupReply);
+#else
+        _lookup->begin_findObjectById(_domainId, id, _lookupReply);
+#endif
+    }
+}
+
+void
+LookupI::sendFindAdapter(const string& adapterId)
+{
+    if(_batchDelay > IceUtil::Time())
+    {
+#ifdef ICE_CPP11_MAPPING
+        _lookupBatch->findAdapterByIdAsync(_domainId, adapterId, _lookupReply);
+#else
+        _lookupBatch->begin_findAdapterById(_domainId, adapterId, _lookupReply);
+#endif
+        scheduleBatchFlush();
+    }
+    else
+    {
+#ifdef ICE_CPP11_MAPPING
+        _lookup->findAdapterByIdAsync(_domainId, adapterId, _lookupReply);
+#else
+        _lookup->begin_findAdapterById(_domainId, adapterId, _lookupReply);
+#endif
+    }
+}
+
+LookupReplyPrxPtr
+LookupI::getReplyBatch(const LookupReplyPrxPtr& reply)
+{
+    //
+    // The replies to the same client are queued on the same batch proxy
+    // to be sent together.
+    //
+    LookupReplyPrxPtr batch = ICE_UNCHECKED_CAST(LookupReplyPrx, reply->ice_batchDatagram());
+    ReplyBatchSet::const_iterator p = _replyBatches.find(batch);
+    if(p == _replyBatches.end())
+    {
+        p = _replyBatches.insert(batch).first;
+    }
+    scheduleBatchFlush();
+    return *p;
+}
+
+void
+LookupI::scheduleBatchFlush()
+{
+    if(!_batchFlush)
+    {
+        _batchFlush = ICE_MAKE_SHARED(BatchFlushTask, ICE_SHARED_FROM_THIS);
+        _timer->schedule(_batchFlush, _batchDelay);
+    }
+}
+
+template<class T> bool
+LookupI::findCached(map<T, CacheEntry>& cache, const T& id, Ice::ObjectPrxPtr& proxy)
+{
+    typename map<T, CacheEntry>::iterator p = cache.find(id);
+    if(p == cache.end())
+    {
+        return false;
+    }
+    else if(IceUtil::Time::now(IceUtil::Time::Monotonic) >= p->second.expiration)
+    {
+        cache.erase(p);
+        return false;
+    }
+    proxy = p->second.proxy;
+    return true;
+}
+
+template<class T> void
+LookupI::cache(map<T, CacheEntry>& cache, const T& id, const Ice::ObjectPrxPtr& proxy)
+{
+    IceUtil::Time timeout = proxy ? _cacheTimeout : _negativeCacheTimeout;
+    if(timeout <= IceUtil::Time())
+    {
+        return;
+    }
+
+    IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+
+    //
+    // Remove the expired entries before adding a new one, the entries
+    // of ids which aren't looked up again would otherwise never be
+    // removed.
+    //
+    if(now >= _nextPrune)
+    {
+        prune(_objectCache, now);
+        prune(_adapterCache, now);
+        _nextPrune = now + timeout;
+    }
+
+    CacheEntry& entry = cache[id];
+    entry.proxy = proxy;
+    entry.expiration = now + timeout;
+}
+
+template<class T> void
+LookupI::prune(map<T, CacheEntry>& cache, const IceUtil::Time& now)
+{
+    typename map<T, CacheEntry>::iterator p = cache.begin();
+    while(p != cache.end())
+    {
+        if(now >= p->second.expiration)
+        {
+            cache.erase(p++);
+        }
+        else
+        {
+            ++p;
+        }
+    }
+}
+
 LookupReplyI::LookupReplyI(const LookupIPtr& lookup) : _lookup(lookup)
 {
 }
@@ -469,3 +757,20 @@ LookupReplyI::foundAdapterById(const string& adapterId, const ObjectPrxPtr& prox
     _lookup->foundAdapter(adapterId, proxy, isReplicaGroup);
 }
 #endif
+
+AnnounceI::AnnounceI(const LookupIPtr& lookup) : _lookup(lookup)
+{
+}
+
+#ifdef ICE_CPP11_MAPPING
+void
+AnnounceI::adapterAnnounced(string domainId, string adapterId, shared_ptr<ObjectPrx> proxy, bool isReplicaGroup,
+                            const Current&)
+#else
+void
+AnnounceI::adapterAnnounced(const string& domainId, const string& adapterId, const ObjectPrxPtr& proxy,
+                            bool isReplicaGroup, const Current&)
+#endif
+{
+    _lookup->adapterAnnounced(domainId, adapterId, proxy, isReplicaGroup);
+}
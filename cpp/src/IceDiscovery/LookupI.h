@@ -15,6 +15,9 @@
 
 #include <IceUtil/Timer.h>
 #include <Ice/Properties.h>
+#include <Ice/Comparable.h>
+
+#include <set>
 
 namespace IceDiscovery
 {
@@ -95,6 +98,7 @@ public:
     }
 
     bool response(const std::shared_ptr<Ice::ObjectPrx>&, bool);
+    std::shared_ptr<Ice::ObjectPrx> getProxy() const;
 
     virtual bool retry();
     virtual void finished(const std::shared_ptr<Ice::ObjectPrx>&);
@@ -186,6 +190,7 @@ public:
     }
 
     bool response(const Ice::ObjectPrxPtr&, bool);
+    Ice::ObjectPrxPtr getProxy() const;
 
     virtual bool retry();
     virtual void finished(const Ice::ObjectPrxPtr&);
@@ -240,6 +245,10 @@ public:
     void adapterRequestTimedOut(const AdapterRequestPtr&);
     void objectRequestTimedOut(const ObjectRequestPtr&);
 
+    void adapterAnnounced(const std::string&, const std::string&, const Ice::ObjectPrxPtr&, bool);
+
+    void flushBatchRequests();
+
     const IceUtil::TimerPtr&
     timer()
     {
@@ -254,6 +263,25 @@ public:
 
 private:
 
+    //
+    // A cached lookup result, the proxy is null if the lookup didn't
+    // find anything.
+    //
+    struct CacheEntry
+    {
+        Ice::ObjectPrxPtr proxy;
+        IceUtil::Time expiration;
+    };
+
+    void sendFindObject(const Ice::Identity&);
+    void sendFindAdapter(const std::string&);
+    LookupReplyPrxPtr getReplyBatch(const LookupReplyPrxPtr&);
+    void scheduleBatchFlush();
+
+    template<class T> bool findCached(std::map<T, CacheEntry>&, const T&, Ice::ObjectPrxPtr&);
+    template<class T> void cache(std::map<T, CacheEntry>&, const T&, const Ice::ObjectPrxPtr&);
+    template<class T> void prune(std::map<T, CacheEntry>&, const IceUtil::Time&);
+
     LocatorRegistryIPtr _registry;
     const LookupPrxPtr _lookup;
     LookupReplyPrxPtr _lookupReply;
@@ -261,12 +289,32 @@ private:
     const int _retryCount;
     const int _latencyMultiplier;
     const std::string _domainId;
+    const IceUtil::Time _batchDelay;
+    const IceUtil::Time _cacheTimeout;
+    const IceUtil::Time _negativeCacheTimeout;
 
     IceUtil::TimerPtr _timer;
     Ice::ObjectPrxPtr _wellKnownProxy;
 
     std::map<Ice::Identity, ObjectRequestPtr> _objectRequests;
     std::map<std::string, AdapterRequestPtr> _adapterRequests;
+
+    std::map<Ice::Identity, CacheEntry> _objectCache;
+    std::map<std::string, CacheEntry> _adapterCache;
+    IceUtil::Time _nextPrune;
+
+    //
+    // With a batch delay, the lookup requests and the replies are queued
+    // as batch datagrams and flushed together once the delay expires.
+    //
+    const LookupPrxPtr _lookupBatch;
+#ifdef ICE_CPP11_MAPPING
+    typedef std::set<LookupReplyPrxPtr, Ice::TargetCompare<LookupReplyPrxPtr, std::less>> ReplyBatchSet;
+#else
+    typedef std::set<LookupReplyPrxPtr> ReplyBatchSet;
+#endif
+    ReplyBatchSet _replyBatches;
+    IceUtil::TimerTaskPtr _batchFlush;
 };
 
 class LookupReplyI : public LookupReply
@@ -288,6 +336,25 @@ private:
     const LookupIPtr _lookup;
 };
 
+class AnnounceI : public Announce
+{
+public:
+
+    AnnounceI(const LookupIPtr&);
+
+#ifdef ICE_CPP11_MAPPING
+    virtual void adapterAnnounced(std::string, std::string, std::shared_ptr<Ice::ObjectPrx>, bool,
+                                  const Ice::Current&);
+#else
+    virtual void adapterAnnounced(const std::string&, const std::string&, const Ice::ObjectPrx&, bool,
+                                  const Ice::Current&);
+#endif
+
+private:
+
+    const LookupIPtr _lookup;
+};
+
 };
 
 #endif
@@ -159,6 +159,17 @@ PluginI::initialize()
     Ice::ObjectPrxPtr lookupReply = _replyAdapter->addWithUUID(ICE_MAKE_SHARED(LookupReplyI, _lookup))->ice_datagram();
     _lookup->setLookupReply(ICE_UNCHECKED_CAST(LookupReplyPrx, lookupReply));
 
+    //
+    // Add the announce Ice object, the locator registry multicasts the
+    // adapter registrations to the announce objects if enabled.
+    //
+    _multicastAdapter->add(ICE_MAKE_SHARED(AnnounceI, _lookup), Ice::stringToIdentity("IceDiscovery/Announce"));
+    if(properties->getPropertyAsInt("IceDiscovery.Announce") > 0)
+    {
+        Ice::ObjectPrxPtr announce = lookupPrx->ice_identity(Ice::stringToIdentity("IceDiscovery/Announce"));
+        locatorRegistry->setAnnounce(ICE_UNCHECKED_CAST(AnnouncePrx, announce));
+    }
+
     //
     // Setup locator on the communicator.
     //
@@ -296,9 +296,12 @@ extern "C" void CALLBACK activatorWaitCallback(PVOID data, BOOLEAN)
 }
 #endif
 
-Activator::Activator(const TraceLevelsPtr& traceLevels) :
+Activator::Activator(const TraceLevelsPtr& traceLevels, int maxActivations) :
     _traceLevels(traceLevels),
-    _deactivating(false)
+    _deactivating(false),
+    _maxActivations(maxActivations > 0 ? maxActivations : 1),
+    _activating(0),
+    _onDemandWaiting(0)
 {
 #ifdef _WIN32
     _hIntr = CreateEvent(
@@ -357,15 +360,73 @@ Activator::activate(const string& name,
 #endif
                     const Ice::StringSeq& options,
                     const Ice::StringSeq& envs,
-                    const ServerIPtr& server)
+                    const ServerIPtr& server,
+                    bool onDemand)
 {
-    IceUtil::Monitor< IceUtil::Mutex>::Lock sync(*this);
+    //
+    // Processes are spawned concurrently, up to the maximum number of
+    // activations. The on-demand activations are scheduled first, a
+    // client is waiting for the server adapters.
+    //
+    {
+        IceUtil::Monitor< IceUtil::Mutex>::Lock sync(*this);
+        if(onDemand)
+        {
+            ++_onDemandWaiting;
+        }
+        while(!_deactivating && (_activating >= _maxActivations || (!onDemand && _onDemandWaiting > 0)))
+        {
+            wait();
+        }
+        if(onDemand)
+        {
+            --_onDemandWaiting;
+        }
+        if(_deactivating)
+        {
+            notifyAll();
+            throw string("The node is being shutdown.");
+        }
+        ++_activating;
+    }
 
-    if(_deactivating)
+    try
     {
-        throw string("The node is being shutdown.");
+#ifndef _WIN32
+        int pid = spawn(name, exePath, pwdPath, uid, gid, options, envs, server);
+#else
+        int pid = spawn(name, exePath, pwdPath, options, envs, server);
+#endif
+        IceUtil::Monitor< IceUtil::Mutex>::Lock sync(*this);
+        --_activating;
+        notifyAll();
+        return pid;
+    }
+    catch(...)
+    {
+        IceUtil::Monitor< IceUtil::Mutex>::Lock sync(*this);
+        --_activating;
+        notifyAll();
+        throw;
     }
+}
 
+int
+Activator::spawn(const string& name,
+                 const string& exePath,
+                 const string& pwdPath,
+#ifndef _WIN32
+                 uid_t uid,
+                 gid_t gid,
+#endif
+                 const Ice::StringSeq& options,
+                 const Ice::StringSeq& envs,
+                 const ServerIPtr& server)
+{
+    //
+    // The process is spawned without holding the activator lock, the
+    // lock is only acquired to register the process.
+    //
     string path = exePath;
     if(path.empty())
     {
@@ -606,6 +667,15 @@ Activator::activate(const string& name,
     // keep the thread handle, so we close it now. The process handle will be closed later.
     //
     CloseHandle(pi.hThread);
+
+    IceUtil::Monitor< IceUtil::Mutex>::Lock sync(*this);
+    if(_deactivating)
+    {
+        TerminateProcess(pi.hProcess, 0);
+        CloseHandle(pi.hProcess);
+        throw string("The node is being shutdown.");
+    }
+
     process.activator = this;
     process.pid = pi.dwProcessId;
     process.hnd = pi.hProcess;
@@ -830,6 +900,20 @@ Activator::activate(const string& name,
         //
         close(errorFds[0]);
 
+        IceUtil::Monitor< IceUtil::Mutex>::Lock sync(*this);
+
+        //
+        // The termination listener might not wait for the process if
+        // the node was shutdown in the meantime, kill it.
+        //
+        if(_deactivating)
+        {
+            close(fds[0]);
+            ::kill(pid, SIGKILL);
+            waitPid(pid);
+            throw string("The node is being shutdown.");
+        }
+
         Process process;
         process.pid = pid;
         process.pipeFd = fds[0];
@@ -47,14 +47,14 @@ public:
         ServerIPtr server;
     };
 
-    Activator(const TraceLevelsPtr&);
+    Activator(const TraceLevelsPtr&, int);
     virtual ~Activator();
 
     virtual int activate(const std::string&, const std::string&, const std::string&,
 #ifndef _WIN32
                          uid_t, gid_t, 
 #endif
-                         const Ice::StringSeq&, const Ice::StringSeq&, const ServerIPtr&);
+                         const Ice::StringSeq&, const Ice::StringSeq&, const ServerIPtr&, bool);
     virtual void deactivate(const std::string&, const Ice::ProcessPrx&);
     virtual void kill(const std::string&);
     virtual void sendSignal(const std::string&, const std::string&);
@@ -77,6 +77,12 @@ public:
 
 private:
 
+    int spawn(const std::string&, const std::string&, const std::string&,
+#ifndef _WIN32
+              uid_t, gid_t,
+#endif
+              const Ice::StringSeq&, const Ice::StringSeq&, const ServerIPtr&);
+
     void terminationListener();
     void clearInterrupt();
     void setInterrupt();
@@ -88,6 +94,9 @@ private:
     TraceLevelsPtr _traceLevels;
     std::map<std::string, Process> _processes;
     bool _deactivating;
+    const int _maxActivations;
+    int _activating;
+    int _onDemandWaiting;
 
 #ifdef _WIN32
     HANDLE _hIntr;
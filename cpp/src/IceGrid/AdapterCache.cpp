@@ -66,6 +66,49 @@ struct TransformToReplica : public unary_function<const pair<string, ServerAdapt
     }
 };
 
+//
+// Order the replicas with the power of two choices: each of the first
+// nReplicas replicas is the least loaded of two replicas picked at
+// random among the remaining ones. The load of a replica is only
+// retrieved if it's picked. The other replicas, only used if the
+// selected ones are unreachable, are in random order.
+//
+void
+sortPowerOfTwoChoices(vector<ServerAdapterEntryPtr>& replicas, int nReplicas, LoadSample loadSample)
+{
+    RandomNumberGenerator rng;
+    const size_t size = replicas.size();
+    vector<float> loads(size, -1.0f);
+    for(size_t i = 0; i < size; ++i)
+    {
+        const ptrdiff_t remaining = static_cast<ptrdiff_t>(size - i);
+        size_t selected = i + rng(remaining);
+        if(static_cast<int>(i) < nReplicas && remaining > 1)
+        {
+            size_t other = i + rng(remaining - 1);
+            if(other >= selected)
+            {
+                ++other;
+            }
+
+            if(loads[selected] < 0.0f)
+            {
+                loads[selected] = replicas[selected]->getLeastLoadedNodeLoad(loadSample);
+            }
+            if(loads[other] < 0.0f)
+            {
+                loads[other] = replicas[other]->getLeastLoadedNodeLoad(loadSample);
+            }
+            if(loads[other] < loads[selected])
+            {
+                selected = other;
+            }
+        }
+        swap(replicas[i], replicas[selected]);
+        swap(loads[i], loads[selected]);
+    }
+}
+
 class ReplicaGroupSyncCallback : public SynchronizationCallback, public IceUtil::Mutex
 {
 public:
@@ -175,7 +218,9 @@ typedef IceUtil::Handle<ReplicaGroupSyncCallback> ReplicaGroupSyncCallbackPtr;
 
 }
 
-AdapterCache::AdapterCache(const Ice::CommunicatorPtr& communicator) : _communicator(communicator)
+AdapterCache::AdapterCache(const Ice::CommunicatorPtr& communicator) :
+    CacheByString<AdapterEntry>(true),
+    _communicator(communicator)
 {
 }
 
@@ -250,6 +295,17 @@ AdapterCache::get(const string& id) const
     return entry;
 }
 
+AdapterEntryPtr
+AdapterCache::lookup(const string& id) const
+{
+    AdapterEntryPtr entry = getSnapshot()->get(id);
+    if(!entry)
+    {
+        throw AdapterNotExistException(id);
+    }
+    return entry;
+}
+
 void
 AdapterCache::removeServerAdapter(const string& id)
 {
@@ -613,6 +669,7 @@ ReplicaGroupEntry::getLocatorAdapterInfo(LocatorAdapterInfoSeq& adapters, int& n
 {
     vector<ServerAdapterEntryPtr> replicas;
     bool adaptive = false;
+    bool powerOfTwo = false;
     LoadSample loadSample = LoadSample1;
     {
         Lock sync(*this);
@@ -642,6 +699,12 @@ ReplicaGroupEntry::getLocatorAdapterInfo(LocatorAdapterInfoSeq& adapters, int& n
             _lastReplica = (_lastReplica + 1) % static_cast<int>(_replicas.size());
             roundRobin = true;
         }
+        else if(PowerOfTwoLoadBalancingPolicyPtr::dynamicCast(_loadBalancing))
+        {
+            replicas = _replicas;
+            loadSample = _loadSample;
+            powerOfTwo = true;
+        }
         else if(AdaptiveLoadBalancingPolicyPtr::dynamicCast(_loadBalancing))
         {
             replicas = _replicas;
@@ -682,6 +745,13 @@ ReplicaGroupEntry::getLocatorAdapterInfo(LocatorAdapterInfoSeq& adapters, int& n
             replicas.clear();
             transform(rl.begin(), rl.end(), back_inserter(replicas), TransformToReplica());
         }
+        else if(powerOfTwo)
+        {
+            //
+            // Also done outside the synchronization, see above.
+            //
+            sortPowerOfTwoChoices(replicas, nReplicas, loadSample);
+        }
 
         //
         // Retrieve the proxy of each adapter from the server. The adapter
@@ -145,6 +145,12 @@ public:
     void addReplicaGroup(const ReplicaGroupDescriptor&, const std::string&);
 
     AdapterEntryPtr get(const std::string&) const;
+
+    //
+    // Lookup the adapter in the last published snapshot, this doesn't
+    // lock the cache.
+    //
+    AdapterEntryPtr lookup(const std::string&) const;
     
     void removeServerAdapter(const std::string&);
     void removeReplicaGroup(const std::string&);
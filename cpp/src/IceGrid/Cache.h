@@ -15,6 +15,8 @@
 #include <IceGrid/Util.h>
 #include <IceGrid/TraceLevels.h>
 
+#include <set>
+
 namespace IceGrid
 {
 
@@ -28,6 +30,80 @@ public:
 };
 typedef IceUtil::Handle<SynchronizationCallback> SynchronizationCallbackPtr;
 
+inline size_t
+cacheKeyHash(const std::string& key)
+{
+    size_t h = 2166136261U; // FNV-1a
+    for(std::string::const_iterator p = key.begin(); p != key.end(); ++p)
+    {
+        h = (h ^ static_cast<unsigned char>(*p)) * 16777619U;
+    }
+    return h;
+}
+
+inline size_t
+cacheKeyHash(const Ice::Identity& key)
+{
+    return cacheKeyHash(key.name) * 31 + cacheKeyHash(key.category);
+}
+
+template<typename Key, typename Value> class Cache;
+
+//
+// An immutable snapshot of the entries of a cache. Readers look up
+// entries in the snapshot without locking the cache. The entries are
+// partitioned in shards and a new snapshot shares the shards without
+// updated entries with the previous snapshot.
+//
+template<typename Key, typename Value>
+class CacheSnapshot : public IceUtil::Shared
+{
+    typedef IceUtil::Handle<Value> ValuePtr;
+    typedef std::map<Key, ValuePtr> ValueMap;
+
+public:
+
+    CacheSnapshot() : _shards(nShards)
+    {
+    }
+
+    CacheSnapshot(const CacheSnapshot& snapshot) : IceUtil::Shared(), _shards(snapshot._shards)
+    {
+    }
+
+    ValuePtr
+    get(const Key& key) const
+    {
+        const ShardPtr& shard = _shards[index(key)];
+        if(!shard)
+        {
+            return 0;
+        }
+        typename ValueMap::const_iterator p = shard->entries.find(key);
+        return p != shard->entries.end() ? p->second : ValuePtr();
+    }
+
+private:
+
+    friend class Cache<Key, Value>;
+
+    enum { nShards = 64 };
+
+    static size_t
+    index(const Key& key)
+    {
+        return cacheKeyHash(key) % nShards;
+    }
+
+    struct Shard : public IceUtil::Shared
+    {
+        ValueMap entries;
+    };
+    typedef IceUtil::Handle<Shard> ShardPtr;
+
+    std::vector<ShardPtr> _shards;
+};
+
 template<typename Key, typename Value>
 class Cache : public IceUtil::Monitor<IceUtil::Mutex>
 {
@@ -36,7 +112,10 @@ class Cache : public IceUtil::Monitor<IceUtil::Mutex>
 
 public:
 
-    Cache() : _entriesHint(_entries.end())
+    typedef CacheSnapshot<Key, Value> Snapshot;
+    typedef IceUtil::Handle<Snapshot> SnapshotPtr;
+
+    Cache(bool snapshot = false) : _entriesHint(_entries.end()), _snapshot(snapshot ? new Snapshot() : 0)
     {
     }
 
@@ -67,6 +146,60 @@ public:
 
     const TraceLevelsPtr& getTraceLevels() const { return _traceLevels; }
 
+    //
+    // Get the last published snapshot, only for caches created with
+    // snapshot support.
+    //
+    SnapshotPtr
+    getSnapshot() const
+    {
+        IceUtil::Mutex::Lock sync(_snapshotMutex);
+        assert(_snapshot);
+        return _snapshot;
+    }
+
+    //
+    // Publish a new snapshot with the entries added or removed since
+    // the last snapshot. Only the shards of these entries are copied.
+    //
+    void
+    publishSnapshot()
+    {
+        Lock sync(*this);
+        assert(_snapshot);
+        if(_updated.empty())
+        {
+            return;
+        }
+
+        SnapshotPtr snapshot = new Snapshot(*_snapshot);
+        std::vector<bool> copied(Snapshot::nShards, false);
+        for(typename std::set<Key>::const_iterator p = _updated.begin(); p != _updated.end(); ++p)
+        {
+            const size_t index = Snapshot::index(*p);
+            typename Snapshot::ShardPtr& shard = snapshot->_shards[index];
+            if(!copied[index])
+            {
+                shard = shard ? new typename Snapshot::Shard(*shard) : new typename Snapshot::Shard();
+                copied[index] = true;
+            }
+
+            typename ValueMap::const_iterator q = _entries.find(*p);
+            if(q != _entries.end())
+            {
+                shard->entries[*p] = q->second;
+            }
+            else
+            {
+                shard->entries.erase(*p);
+            }
+        }
+        _updated.clear();
+
+        IceUtil::Mutex::Lock sync2(_snapshotMutex);
+        _snapshot = snapshot;
+    }
+
 protected:
 
     virtual ValuePtr 
@@ -102,6 +235,10 @@ protected:
     {
         typename ValueMap::value_type v(key, entry);
         _entriesHint = _entries.insert(_entriesHint, v);
+        if(_snapshot)
+        {
+            _updated.insert(key);
+        }
         return entry;
     }
 
@@ -127,6 +264,10 @@ protected:
         {
             _entries.erase(p);
             _entriesHint = _entries.end();
+            if(_snapshot)
+            {
+                _updated.insert(key);
+            }
         }
         else
         {
@@ -137,6 +278,12 @@ protected:
     TraceLevelsPtr _traceLevels;
     ValueMap _entries;
     typename ValueMap::iterator _entriesHint;    
+
+private:
+
+    std::set<Key> _updated;
+    IceUtil::Mutex _snapshotMutex;
+    SnapshotPtr _snapshot;
 };
 
 template<typename T>
@@ -146,6 +293,10 @@ class CacheByString : public Cache<std::string, T>
 
 public:
 
+    CacheByString(bool snapshot = false) : Cache<std::string, T>(snapshot)
+    {
+    }
+
     virtual std::vector<std::string>
     getAll(const std::string& expr)
     {
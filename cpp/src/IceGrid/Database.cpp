@@ -36,6 +36,10 @@ typedef IceDB::Cursor<string, string, IceDB::IceContext, Ice::OutputStream> Adap
 typedef IceDB::ReadOnlyCursor<string, Ice::Identity, IceDB::IceContext, Ice::OutputStream> ObjectsByTypeMapROCursor;
 typedef IceDB::ReadOnlyCursor<Ice::Identity, ObjectInfo, IceDB::IceContext, Ice::OutputStream> ObjectsMapROCursor;
 
+typedef IceDB::View<string, IceDB::IceContext, Ice::OutputStream> StringView;
+typedef IceDB::View<Ice::Identity, IceDB::IceContext, Ice::OutputStream> IdentityView;
+typedef IceDB::View<ObjectInfo, IceDB::IceContext, Ice::OutputStream> ObjectInfoView;
+
 namespace
 {
 
@@ -61,11 +65,12 @@ toVector(const IceDB::ReadOnlyTxn& txn, const IceDB::Dbi<K, V, C, H>& m)
 {
     vector<V> v;
     IceDB::ReadOnlyCursor<K, V, C, H> cursor(m, txn);
-    K key;
-    V value;
+    IceDB::View<K, C, H> key;
+    IceDB::View<V, C, H> value;
     while(cursor.get(key, value, MDB_NEXT))
     {
-        v.push_back(value);
+        v.push_back(V());
+        value.read(v.back());
     }
     return v;
 }
@@ -93,6 +98,25 @@ logError(const Ice::CommunicatorPtr& com, const IceDB::LMDBException& ex)
     error << "LMDB error: " << ex;
 }
 
+class FlushWritesTask : public IceUtil::TimerTask
+{
+public:
+
+    FlushWritesTask(const DatabasePtr& database) : _database(database)
+    {
+    }
+
+    virtual void
+    runTimerTask()
+    {
+        _database->flushWrites();
+    }
+
+private:
+
+    const DatabasePtr _database;
+};
+
 void
 filterAdapterInfos(const string& filter,
                    const string& replicaGroupId,
@@ -146,21 +170,24 @@ findByReplicaGroupId(const IceDB::Txn& txn,
                      const StringStringMap& adaptersByGroupId,
                      const string& name)
 {
+    //
+    // The adapter ids of the replica group are the duplicates of the
+    // group key, they are used without unmarshaling them to lookup the
+    // adapters.
+    //
     vector<AdapterInfo> result;
     AdaptersByGroupMapCursor cursor(adaptersByGroupId, txn);
-    string id;
+    StringView id;
     if(cursor.find(name, id))
     {
-        AdapterInfo info;
-        adapters.get(txn, id, info);
-        result.push_back(info);
-
-        string n;
-        while(cursor.get(n, id, MDB_NEXT) && n == name)
+        StringView n;
+        do
         {
+            AdapterInfo info;
             adapters.get(txn, id, info);
             result.push_back(info);
         }
+        while(cursor.get(n, id, MDB_NEXT_DUP));
     }
     return result;
 }
@@ -173,19 +200,17 @@ findByType(const IceDB::ReadOnlyTxn& txn,
 {
     vector<ObjectInfo> result;
     ObjectsByTypeMapROCursor cursor(objectsByType, txn);
-    Ice::Identity id;
+    IdentityView id;
     if(cursor.find(type, id))
     {
-        ObjectInfo info;
-        objects.get(txn, id, info);
-        result.push_back(info);
-
-        string t;
-        while(cursor.get(t, id, MDB_NEXT) && t == type)
+        StringView t;
+        do
         {
+            ObjectInfo info;
             objects.get(txn, id, info);
             result.push_back(info);
         }
+        while(cursor.get(t, id, MDB_NEXT_DUP));
     }
     return result;
 }
@@ -215,7 +240,9 @@ Database::Database(const Ice::ObjectAdapterPtr& registryAdapter,
     _env(_communicator->getProperties()->getProperty("IceGrid.Registry.LMDB.Path"), 8,
          IceDB::getMapSize(_communicator->getProperties()->getPropertyAsInt("IceGrid.Registry.LMDB.MapSize"))),
     _pluginFacade(RegistryPluginFacadeIPtr::dynamicCast(getRegistryPluginFacade())),
-    _lock(0)
+    _lock(0),
+    _writing(false),
+    _flushScheduled(false)
 {
     IceDB::ReadWriteTxn txn(_env);
 
@@ -292,6 +319,11 @@ Database::Database(const Ice::ObjectAdapterPtr& registryAdapter,
     _registryObserverTopic->registryUp(info);
 
     _pluginFacade->setDatabase(this);
+
+    if(!_master)
+    {
+        _timer = new IceUtil::Timer(); // Used to commit the updates queued by the master.
+    }
 }
 
 std::string
@@ -310,6 +342,11 @@ Database::destroy()
     _applicationObserverTopic->destroy();
     _adapterObserverTopic->destroy();
     _objectObserverTopic->destroy();
+
+    if(_timer)
+    {
+        _timer->destroy();
+    }
 }
 
 ObserverTopicPtr
@@ -997,86 +1034,44 @@ Database::setAdapterDirectProxy(const string& adapterId, const string& replicaGr
 {
     assert(dbSerial != 0 || _master);
 
-    int serial = 0; // Initialize to prevent warning.
-    {
-        Lock sync(*this);
-        if(_adapterCache.has(adapterId))
-        {
-            throw AdapterExistsException(adapterId);
-        }
-
-        AdapterInfo info;
-        info.id = adapterId;
-        info.proxy = proxy;
-        info.replicaGroupId = replicaGroupId;
-
-        bool updated = false;
-        try
-        {
-            IceDB::ReadWriteTxn txn(_env);
-
-            AdapterInfo oldInfo;
-            bool found = _adapters.get(txn, adapterId, oldInfo);
-            if(proxy)
-            {
-                updated = found;
-
-                if(replicaGroupId != oldInfo.replicaGroupId)
-                {
-                    _adaptersByGroupId.del(txn, oldInfo.replicaGroupId, adapterId);
-                }
-                addAdapter(txn, info);
-            }
-            else
-            {
-                if(!found)
-                {
-                    return;
-                }
-                deleteAdapter(txn, oldInfo);
-            }
-            dbSerial = updateSerial(txn, adaptersDbName, dbSerial);
+    PendingWritePtr write = new PendingWrite(PendingWrite::SetAdapterDirectProxy, dbSerial);
+    write->adapter.id = adapterId;
+    write->adapter.proxy = proxy;
+    write->adapter.replicaGroupId = replicaGroupId;
+    commitWrite(write);
+    _adapterObserverTopic->waitForSyncedSubscribers(write->serial);
+}
 
-            txn.commit();
-        }
-        catch(const IceDB::KeyTooLongException&)
-        {
-            throw;
-        }
-        catch(const IceDB::LMDBException& ex)
-        {
-            logError(_communicator, ex);
-            throw;
-        }
+void
+Database::queueAdapterDirectProxy(const string& adapterId, const string& replicaGroupId, const Ice::ObjectPrx& proxy,
+                                  Ice::Long dbSerial, const DatabaseWriteCallbackPtr& callback)
+{
+    assert(dbSerial != 0 || _master);
 
-        if(_traceLevels->adapter > 0)
-        {
-            Ice::Trace out(_traceLevels->logger, _traceLevels->adapterCat);
-            out << (proxy ? (updated ? "updated" : "added") : "removed") << " adapter `" << adapterId << "'";
-            if(!replicaGroupId.empty())
-            {
-                out << " with replica group `" << replicaGroupId << "'";
-            }
-            out << " (serial = `" << dbSerial << "')";
-        }
+    PendingWritePtr write = new PendingWrite(PendingWrite::SetAdapterDirectProxy, dbSerial);
+    write->adapter.id = adapterId;
+    write->adapter.proxy = proxy;
+    write->adapter.replicaGroupId = replicaGroupId;
+    write->callback = callback;
+    queueWrite(write);
+}
 
-        if(proxy)
+void
+Database::flushWrites()
+{
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_writeMonitor);
+    _flushScheduled = false;
+    while(_writing || !_writes.empty())
+    {
+        if(_writing)
         {
-            if(updated)
-            {
-                serial = _adapterObserverTopic->adapterUpdated(dbSerial, info);
-            }
-            else
-            {
-                serial = _adapterObserverTopic->adapterAdded(dbSerial, info);
-            }
+            _writeMonitor.wait();
         }
         else
         {
-            serial = _adapterObserverTopic->adapterRemoved(dbSerial, adapterId);
+            commitQueuedWrites(sync);
         }
     }
-    _adapterObserverTopic->waitForSyncedSubscribers(serial);
 }
 
 Ice::ObjectPrx
@@ -1204,11 +1199,12 @@ Database::getLocatorAdapterInfo(const string& id,
                                 bool& roundRobin,
                                 const set<string>& excludes)
 {
+    //
+    // The adapter is looked up in the snapshot of the adapter cache,
+    // this doesn't wait for updates in progress.
+    //
     string filter;
-    {
-        Lock sync(*this); // Make sure this isn't call during an update.
-        _adapterCache.get(id)->getLocatorAdapterInfo(adpts, count, replicaGroup, roundRobin, filter, excludes);
-    }
+    _adapterCache.lookup(id)->getLocatorAdapterInfo(adpts, count, replicaGroup, roundRobin, filter, excludes);
 
     if(_pluginFacade->hasReplicaGroupFilters() && !adpts.empty())
     {
@@ -1448,45 +1444,10 @@ Database::addObject(const ObjectInfo& info)
 {
     assert(_master);
 
-    int serial = 0;
-    {
-        Lock sync(*this);
-        const Ice::Identity id = info.proxy->ice_getIdentity();
-
-        if(_objectCache.has(id))
-        {
-            throw ObjectExistsException(id);
-        }
-
-        Ice::Long dbSerial = 0;
-        try
-        {
-            IceDB::ReadWriteTxn txn(_env);
-
-            if(_objects.find(txn, id))
-            {
-                throw ObjectExistsException(id);
-            }
-            addObject(txn, info, false);
-            dbSerial = updateSerial(txn, objectsDbName);
-
-            txn.commit();
-        }
-        catch(const IceDB::LMDBException& ex)
-        {
-            logError(_communicator, ex);
-            throw;
-        }
-
-        serial = _objectObserverTopic->objectAdded(dbSerial, info);
-
-        if(_traceLevels->object > 0)
-        {
-            Ice::Trace out(_traceLevels->logger, _traceLevels->objectCat);
-            out << "added object `" << _communicator->identityToString(id) << "' (serial = `" << dbSerial << "')";
-        }
-    }
-    _objectObserverTopic->waitForSyncedSubscribers(serial);
+    PendingWritePtr write = new PendingWrite(PendingWrite::AddObject);
+    write->object = info;
+    commitWrite(write);
+    _objectObserverTopic->waitForSyncedSubscribers(write->serial);
 }
 
 void
@@ -1601,53 +1562,10 @@ Database::updateObject(const Ice::ObjectPrx& proxy)
 {
     assert(_master);
 
-    int serial = 0;
-    {
-        Lock sync(*this);
-
-        const Ice::Identity id = proxy->ice_getIdentity();
-        if(_objectCache.has(id))
-        {
-            DeploymentException ex;
-            ex.reason = "updating object `" + _communicator->identityToString(id) + "' is not allowed:\n";
-            ex.reason += "the object was added with the application descriptor `";
-            ex.reason += _objectCache.get(id)->getApplication();
-            ex.reason += "'";
-            throw ex;
-        }
-
-        ObjectInfo info;
-        Ice::Long dbSerial = 0;
-        try
-        {
-            IceDB::ReadWriteTxn txn(_env);
-
-            if(!_objects.get(txn, id, info))
-            {
-                ObjectNotRegisteredException ex;
-                ex.id = id;
-                throw ex;
-            }
-            info.proxy = proxy;
-            addObject(txn, info, false);
-            dbSerial = updateSerial(txn, objectsDbName);
-
-            txn.commit();
-        }
-        catch(const IceDB::LMDBException& ex)
-        {
-            logError(_communicator, ex);
-            throw;
-        }
-
-        serial = _objectObserverTopic->objectUpdated(dbSerial, info);
-        if(_traceLevels->object > 0)
-        {
-            Ice::Trace out(_traceLevels->logger, _traceLevels->objectCat);
-            out << "updated object `" << _communicator->identityToString(id) << "' (serial = `" << dbSerial << "')";
-        }
-    }
-    _objectObserverTopic->waitForSyncedSubscribers(serial);
+    PendingWritePtr write = new PendingWrite(PendingWrite::UpdateObject);
+    write->object.proxy = proxy;
+    commitWrite(write);
+    _objectObserverTopic->waitForSyncedSubscribers(write->serial);
 }
 
 int
@@ -1713,7 +1631,7 @@ Database::getObjectProxy(const Ice::Identity& id)
         //
         // Only return proxies for non allocatable objects.
         //
-        return _objectCache.get(id)->getProxy();
+        return _objectCache.lookup(id)->getProxy();
     }
     catch(const ObjectNotRegisteredException&)
     {
@@ -1828,15 +1746,26 @@ Database::getAllObjectInfos(const string& expression)
 
     IceDB::ReadOnlyTxn txn(_env);
 
-    Ice::Identity id;
-    ObjectInfo info;
+    //
+    // Only the identities are unmarshaled to match the expression, the
+    // object infos are unmarshaled if they match.
+    //
+    IdentityView key;
+    ObjectInfoView value;
     ObjectsMapROCursor cursor(_objects, txn);
-    while(cursor.get(id, info, MDB_NEXT))
+    while(cursor.get(key, value, MDB_NEXT))
     {
-        if(expression.empty() || IceUtilInternal::match(_communicator->identityToString(id), expression, true))
+        if(!expression.empty())
         {
-            infos.push_back(info);
+            Ice::Identity id;
+            key.read(id);
+            if(!IceUtilInternal::match(_communicator->identityToString(id), expression, true))
+            {
+                continue;
+            }
         }
+        infos.push_back(ObjectInfo());
+        value.read(infos.back());
     }
     return infos;
 }
@@ -2171,6 +2100,8 @@ Database::load(const ApplicationHelper& app, ServerEntrySeq& entries, const stri
     {
         entries.push_back(_serverCache.add(p->second));
     }
+
+    publishSnapshots();
 }
 
 void
@@ -2198,6 +2129,8 @@ Database::unload(const ApplicationHelper& app, ServerEntrySeq& entries)
     {
         _nodeCache.get(n->first)->removeDescriptor(application);
     }
+
+    publishSnapshots();
 }
 
 void
@@ -2323,6 +2256,19 @@ Database::reload(const ApplicationHelper& oldApp,
             entries.push_back(_serverCache.add(q->second));
         }
     }
+
+    publishSnapshots();
+}
+
+void
+Database::publishSnapshots()
+{
+    //
+    // Publish the adapters and objects once the update is complete,
+    // the locator lookups never see a partially updated application.
+    //
+    _adapterCache.publishSnapshot();
+    _objectCache.publishSnapshot();
 }
 
 Ice::Long
@@ -2789,3 +2735,371 @@ Database::deleteObject(const IceDB::ReadWriteTxn& txn, const ObjectInfo& info, b
         _objectsByType.del(txn, info.type, info.proxy->ice_getIdentity());
     }
 }
+
+void
+Database::commitWrite(const PendingWritePtr& write)
+{
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_writeMonitor);
+    _writes.push_back(write);
+    while(!write->done)
+    {
+        if(_writing)
+        {
+            _writeMonitor.wait();
+        }
+        else
+        {
+            commitQueuedWrites(sync);
+        }
+    }
+
+    if(write->exception.get())
+    {
+        write->exception->ice_throw();
+    }
+}
+
+void
+Database::queueWrite(const PendingWritePtr& write)
+{
+    assert(_timer);
+
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_writeMonitor);
+    _writes.push_back(write);
+    if(!_writing && !_flushScheduled)
+    {
+        try
+        {
+            _timer->schedule(new FlushWritesTask(this), IceUtil::Time());
+            _flushScheduled = true;
+        }
+        catch(const IceUtil::IllegalArgumentException&)
+        {
+            // Ignore, the database is being destroyed.
+        }
+    }
+}
+
+void
+Database::commitQueuedWrites(IceUtil::Monitor<IceUtil::Mutex>::Lock& sync)
+{
+    //
+    // Commit the queued writes with a single transaction. The writes
+    // queued while the transaction is committed are committed by the
+    // next transaction, by one of the callers waiting for its write
+    // or, if only writes from queueAdapterDirectProxy are left, by
+    // this thread.
+    //
+    assert(!_writing);
+    _writing = true;
+    bool waiting = false;
+    do
+    {
+        vector<PendingWritePtr> writes;
+        writes.swap(_writes);
+        sync.release();
+
+        try
+        {
+            commitWrites(writes);
+        }
+        catch(const std::exception& ex)
+        {
+            failWrites(writes, ex.what());
+        }
+        catch(...)
+        {
+            failWrites(writes, "unknown c++ exception");
+        }
+
+        try
+        {
+            for(vector<PendingWritePtr>::const_iterator p = writes.begin(); p != writes.end(); ++p)
+            {
+                if((*p)->callback)
+                {
+                    if((*p)->exception.get())
+                    {
+                        (*p)->callback->failed(*(*p)->exception);
+                    }
+                    else
+                    {
+                        (*p)->callback->committed();
+                    }
+                }
+            }
+        }
+        catch(...)
+        {
+            //
+            // Release the writers waiting for this transaction before
+            // propagating the exception of the callback, they would
+            // otherwise wait forever.
+            //
+            sync.acquire();
+            for(vector<PendingWritePtr>::const_iterator p = writes.begin(); p != writes.end(); ++p)
+            {
+                (*p)->done = true;
+            }
+            _writing = false;
+            _writeMonitor.notifyAll();
+            throw;
+        }
+
+        sync.acquire();
+        for(vector<PendingWritePtr>::const_iterator p = writes.begin(); p != writes.end(); ++p)
+        {
+            (*p)->done = true;
+        }
+        _writeMonitor.notifyAll();
+
+        for(vector<PendingWritePtr>::const_iterator p = _writes.begin(); p != _writes.end() && !waiting; ++p)
+        {
+            waiting = !(*p)->callback;
+        }
+    }
+    while(!_writes.empty() && !waiting);
+    _writing = false;
+}
+
+void
+Database::failWrites(const vector<PendingWritePtr>& writes, const string& reason)
+{
+    Ice::UnknownException ex(__FILE__, __LINE__);
+    ex.unknown = reason;
+    for(vector<PendingWritePtr>::const_iterator p = writes.begin(); p != writes.end(); ++p)
+    {
+        if(!(*p)->exception.get())
+        {
+            (*p)->exception.reset(ex.ice_clone());
+        }
+    }
+}
+
+void
+Database::commitWrites(const vector<PendingWritePtr>& writes)
+{
+    Lock sync(*this);
+
+    bool committed = false;
+    while(!committed)
+    {
+        try
+        {
+            IceDB::ReadWriteTxn txn(_env);
+
+            bool aborted = false;
+            for(vector<PendingWritePtr>::const_iterator p = writes.begin(); p != writes.end() && !aborted; ++p)
+            {
+                if((*p)->exception.get())
+                {
+                    continue;
+                }
+
+                try
+                {
+                    applyWrite(txn, *p);
+                }
+                catch(const Ice::UserException& ex)
+                {
+                    (*p)->exception.reset(ex.ice_clone()); // Raised before the write modifies the database.
+                }
+                catch(const IceDB::KeyTooLongException& ex)
+                {
+                    //
+                    // The write might be partially applied, abort the
+                    // transaction and apply the other writes again.
+                    //
+                    (*p)->exception.reset(ex.ice_clone());
+                    aborted = true;
+                }
+            }
+
+            if(!aborted)
+            {
+                txn.commit();
+                committed = true;
+            }
+        }
+        catch(const IceDB::LMDBException& ex)
+        {
+            //
+            // None of the writes is persisted if the transaction fails.
+            //
+            logError(_communicator, ex);
+            for(vector<PendingWritePtr>::const_iterator p = writes.begin(); p != writes.end(); ++p)
+            {
+                if(!(*p)->exception.get())
+                {
+                    (*p)->exception.reset(ex.ice_clone());
+                }
+            }
+            return;
+        }
+    }
+
+    if(writes.size() > 1 && (_traceLevels->adapter > 1 || _traceLevels->object > 1))
+    {
+        Ice::Trace out(_traceLevels->logger, _traceLevels->object > 1 ? _traceLevels->objectCat :
+                       _traceLevels->adapterCat);
+        out << "committed " << writes.size() << " writes in one transaction";
+    }
+
+    for(vector<PendingWritePtr>::const_iterator p = writes.begin(); p != writes.end(); ++p)
+    {
+        if(!(*p)->exception.get() && !(*p)->ignored)
+        {
+            //
+            // The write is persisted, a failure to publish it to the
+            // observers must not be reported to the caller.
+            //
+            try
+            {
+                publishWrite(*p);
+            }
+            catch(const std::exception& ex)
+            {
+                Ice::Error out(_traceLevels->logger);
+                out << "failed to publish committed write:\n" << ex;
+            }
+        }
+    }
+}
+
+void
+Database::applyWrite(const IceDB::ReadWriteTxn& txn, const PendingWritePtr& write)
+{
+    switch(write->kind)
+    {
+    case PendingWrite::SetAdapterDirectProxy:
+    {
+        const AdapterInfo& info = write->adapter;
+        if(_adapterCache.has(info.id))
+        {
+            throw AdapterExistsException(info.id);
+        }
+
+        AdapterInfo oldInfo;
+        bool found = _adapters.get(txn, info.id, oldInfo);
+        write->ignored = false;
+        if(info.proxy)
+        {
+            write->updated = found;
+
+            if(info.replicaGroupId != oldInfo.replicaGroupId)
+            {
+                _adaptersByGroupId.del(txn, oldInfo.replicaGroupId, info.id);
+            }
+            addAdapter(txn, info);
+        }
+        else
+        {
+            if(!found)
+            {
+                write->ignored = true;
+                return;
+            }
+            deleteAdapter(txn, oldInfo);
+        }
+        write->newDbSerial = updateSerial(txn, adaptersDbName, write->dbSerial);
+        break;
+    }
+    case PendingWrite::AddObject:
+    {
+        const Ice::Identity id = write->object.proxy->ice_getIdentity();
+        if(_objectCache.has(id) || _objects.find(txn, id))
+        {
+            throw ObjectExistsException(id);
+        }
+        addObject(txn, write->object, false);
+        write->newDbSerial = updateSerial(txn, objectsDbName);
+        break;
+    }
+    case PendingWrite::UpdateObject:
+    {
+        const Ice::ObjectPrx proxy = write->object.proxy;
+        const Ice::Identity id = proxy->ice_getIdentity();
+        if(_objectCache.has(id))
+        {
+            DeploymentException ex;
+            ex.reason = "updating object `" + _communicator->identityToString(id) + "' is not allowed:\n";
+            ex.reason += "the object was added with the application descriptor `";
+            ex.reason += _objectCache.get(id)->getApplication();
+            ex.reason += "'";
+            throw ex;
+        }
+
+        if(!_objects.get(txn, id, write->object))
+        {
+            ObjectNotRegisteredException ex;
+            ex.id = id;
+            throw ex;
+        }
+        write->object.proxy = proxy;
+        addObject(txn, write->object, false);
+        write->newDbSerial = updateSerial(txn, objectsDbName);
+        break;
+    }
+    }
+}
+
+void
+Database::publishWrite(const PendingWritePtr& write)
+{
+    switch(write->kind)
+    {
+    case PendingWrite::SetAdapterDirectProxy:
+    {
+        const AdapterInfo& info = write->adapter;
+        if(_traceLevels->adapter > 0)
+        {
+            Ice::Trace out(_traceLevels->logger, _traceLevels->adapterCat);
+            out << (info.proxy ? (write->updated ? "updated" : "added") : "removed") << " adapter `" << info.id << "'";
+            if(!info.replicaGroupId.empty())
+            {
+                out << " with replica group `" << info.replicaGroupId << "'";
+            }
+            out << " (serial = `" << write->newDbSerial << "')";
+        }
+
+        if(info.proxy)
+        {
+            if(write->updated)
+            {
+                write->serial = _adapterObserverTopic->adapterUpdated(write->newDbSerial, info);
+            }
+            else
+            {
+                write->serial = _adapterObserverTopic->adapterAdded(write->newDbSerial, info);
+            }
+        }
+        else
+        {
+            write->serial = _adapterObserverTopic->adapterRemoved(write->newDbSerial, info.id);
+        }
+        break;
+    }
+    case PendingWrite::AddObject:
+    case PendingWrite::UpdateObject:
+    {
+        const bool added = write->kind == PendingWrite::AddObject;
+        if(added)
+        {
+            write->serial = _objectObserverTopic->objectAdded(write->newDbSerial, write->object);
+        }
+        else
+        {
+            write->serial = _objectObserverTopic->objectUpdated(write->newDbSerial, write->object);
+        }
+
+        if(_traceLevels->object > 0)
+        {
+            Ice::Trace out(_traceLevels->logger, _traceLevels->objectCat);
+            out << (added ? "added" : "updated") << " object `"
+                << _communicator->identityToString(write->object.proxy->ice_getIdentity())
+                << "' (serial = `" << write->newDbSerial << "')";
+        }
+        break;
+    }
+    }
+}
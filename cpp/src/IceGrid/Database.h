@@ -13,6 +13,8 @@
 #include <IceUtil/Mutex.h>
 #include <IceUtil/Shared.h>
 #include <IceUtil/FileUtil.h>
+#include <IceUtil/Timer.h>
+#include <IceUtil/UniquePtr.h>
 #include <Ice/CommunicatorF.h>
 #include <IceGrid/Admin.h>
 #include <IceGrid/Internal.h>
@@ -57,6 +59,20 @@ typedef IceDB::Dbi<std::string, std::string, IceDB::IceContext, Ice::OutputStrea
 
 typedef IceDB::Dbi<std::string, Ice::Long, IceDB::IceContext, Ice::OutputStream> StringLongMap;
 
+//
+// Callback for the writes queued with Database::queueAdapterDirectProxy,
+// called once the transaction holding the write is committed.
+//
+class DatabaseWriteCallback : public virtual IceUtil::Shared
+{
+public:
+
+    virtual void committed() = 0;
+
+    virtual void failed(const IceUtil::Exception&) = 0;
+};
+typedef IceUtil::Handle<DatabaseWriteCallback> DatabaseWriteCallbackPtr;
+
 class Database : public IceUtil::Shared, public IceUtil::Monitor<IceUtil::Mutex>
 {
 public:
@@ -114,7 +130,26 @@ public:
     AllocatableObjectCache& getAllocatableObjectCache();
     AllocatableObjectEntryPtr getAllocatableObject(const Ice::Identity&) const;
 
+    //
+    // The adapter direct proxy and object writes are group committed:
+    // the writes issued while a transaction is being committed are
+    // queued and committed together in the next transaction. These
+    // methods return once the transaction holding the write is
+    // committed and the synchronized replicas acknowledged it; if the
+    // transaction fails, all its writes fail and none is persisted.
+    //
     void setAdapterDirectProxy(const std::string&, const std::string&, const Ice::ObjectPrx&, Ice::Long = 0);
+
+    //
+    // Used by replicas to apply the updates from the master without
+    // waiting for the commit, the callback is called once the write
+    // is committed. Queued writes are committed in order, flushWrites()
+    // returns once all the queued writes are committed.
+    //
+    void queueAdapterDirectProxy(const std::string&, const std::string&, const Ice::ObjectPrx&, Ice::Long,
+                                 const DatabaseWriteCallbackPtr&);
+    void flushWrites();
+
     Ice::ObjectPrx getAdapterDirectProxy(const std::string&, const Ice::EncodingVersion&, const Ice::ConnectionPtr&,
                                          const Ice::Context&);
 
@@ -175,6 +210,7 @@ private:
     void load(const ApplicationHelper&, ServerEntrySeq&, const std::string&, int);
     void unload(const ApplicationHelper&, ServerEntrySeq&);
     void reload(const ApplicationHelper&, const ApplicationHelper&, ServerEntrySeq&, const std::string&, int, bool);
+    void publishSnapshots();
 
     void checkUpdate(const ApplicationHelper&, const ApplicationHelper&, const std::string&, int, bool);
 
@@ -199,6 +235,43 @@ private:
     void addObject(const IceDB::ReadWriteTxn&, const ObjectInfo&, bool);
     void deleteObject(const IceDB::ReadWriteTxn&, const ObjectInfo&, bool);
 
+    struct PendingWrite : public IceUtil::Shared
+    {
+        enum Kind
+        {
+            SetAdapterDirectProxy,
+            AddObject,
+            UpdateObject
+        };
+
+        PendingWrite(Kind k, Ice::Long s = 0) :
+            kind(k), dbSerial(s), newDbSerial(0), serial(-1), updated(false), ignored(false), done(false)
+        {
+        }
+
+        const Kind kind;
+        const Ice::Long dbSerial;
+        AdapterInfo adapter;
+        ObjectInfo object;
+        DatabaseWriteCallbackPtr callback;
+
+        Ice::Long newDbSerial;
+        int serial;
+        bool updated;
+        bool ignored;
+        bool done;
+        IceUtil::UniquePtr<IceUtil::Exception> exception;
+    };
+    typedef IceUtil::Handle<PendingWrite> PendingWritePtr;
+
+    void commitWrite(const PendingWritePtr&);
+    void queueWrite(const PendingWritePtr&);
+    void commitQueuedWrites(IceUtil::Monitor<IceUtil::Mutex>::Lock&);
+    void commitWrites(const std::vector<PendingWritePtr>&);
+    void failWrites(const std::vector<PendingWritePtr>&, const std::string&);
+    void applyWrite(const IceDB::ReadWriteTxn&, const PendingWritePtr&);
+    void publishWrite(const PendingWritePtr&);
+
     friend struct AddComponent;
 
     static const std::string _applicationDbName;
@@ -249,6 +322,12 @@ private:
     AdminSessionI* _lock;
     std::string _lockUserId;
 
+    IceUtil::Monitor<IceUtil::Mutex> _writeMonitor;
+    std::vector<PendingWritePtr> _writes;
+    bool _writing;
+    bool _flushScheduled;
+    IceUtil::TimerPtr _timer;
+
     struct UpdateInfo
     {
         std::string name;
@@ -300,6 +300,12 @@ ApplicationDescriptorBuilder::setLoadBalancing(const XmlAttributesHelper& attrs)
         alb->loadSample = attrs("load-sample", "1");
         policy = alb;
     }
+    else if(type == "power-of-two")
+    {
+        PowerOfTwoLoadBalancingPolicyPtr plb = new PowerOfTwoLoadBalancingPolicy();
+        plb->loadSample = attrs("load-sample", "1");
+        policy = plb;
+    }
     else
     {
         throw "invalid load balancing policy `" + type + "'";
@@ -3154,6 +3154,10 @@ ApplicationHelper::print(Output& out, const ApplicationInfo& info) const
             {
                 out << "round-robin";
             }
+            else if(PowerOfTwoLoadBalancingPolicyPtr::dynamicCast(p->loadBalancing))
+            {
+                out << "power-of-two";
+            }
             else if(AdaptiveLoadBalancingPolicyPtr::dynamicCast(p->loadBalancing))
             {
                 out << "adaptive" ;
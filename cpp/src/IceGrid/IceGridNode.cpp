@@ -297,10 +297,12 @@ NodeService::startImpl(int argc, char* argv[], int& status)
     setupThreadPool(properties, "IceGrid.Node.ThreadPool", 1, 100);
 
     //
-    // Create the activator.
+    // Create the activator, it spawns at most MaxConcurrentActivations
+    // server processes concurrently.
     //
     TraceLevelsPtr traceLevels = new TraceLevels(communicator(), "IceGrid.Node");
-    _activator = new Activator(traceLevels);
+    _activator = new Activator(traceLevels,
+                               properties->getPropertyAsIntWithDefault("IceGrid.Node.MaxConcurrentActivations", 8));
 
     //
     // Collocate the IceGrid registry if we need to.
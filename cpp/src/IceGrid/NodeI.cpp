@@ -10,6 +10,7 @@
 #include <IceUtil/Timer.h>
 #include <IceUtil/FileUtil.h>
 #include <Ice/Ice.h>
+#include <Ice/InstrumentationI.h>
 #include <IcePatch2Lib/Util.h>
 #include <IcePatch2/ClientUtil.h>
 #include <IceGrid/NodeI.h>
@@ -277,6 +278,58 @@ private:
     AdapterDynamicInfo _info;
 };
 
+class ActivationHelper : public IceMX::MetricsHelperT<IceMX::Metrics>
+{
+public:
+
+    class Attributes : public IceMX::AttributeResolverT<ActivationHelper>
+    {
+    public:
+
+        Attributes()
+        {
+            add("parent", &ActivationHelper::getNode);
+            add("id", &ActivationHelper::getServer);
+            add("server", &ActivationHelper::getServer);
+            add("application", &ActivationHelper::getApplication);
+        }
+    };
+    static Attributes attributes;
+
+    ActivationHelper(const string& node, const string& server, const string& application) :
+        _node(node), _server(server), _application(application)
+    {
+    }
+
+    virtual string operator()(const string& attribute) const
+    {
+        return attributes(this, attribute);
+    }
+
+    const string& getNode() const
+    {
+        return _node;
+    }
+
+    const string& getServer() const
+    {
+        return _server;
+    }
+
+    const string& getApplication() const
+    {
+        return _application;
+    }
+
+private:
+
+    const string& _node;
+    const string& _server;
+    const string& _application;
+};
+
+ActivationHelper::Attributes ActivationHelper::attributes;
+
 }
 
 NodeI::Update::Update(const NodeIPtr& node, const NodeObserverPrx& observer) : _node(node), _observer(observer)
@@ -352,6 +405,18 @@ NodeI::NodeI(const Ice::ObjectAdapterPtr& adapter,
             _propertiesOverride.push_back(createProperty(q->first, q->second));
         }
     }
+
+    //
+    // If an Ice metrics observer is setup on the communicator, also
+    // record the server activations.
+    //
+    IceInternal::CommunicatorObserverIPtr o =
+        IceInternal::CommunicatorObserverIPtr::dynamicCast(_communicator->getObserver());
+    if(o)
+    {
+        _activations.reset(new IceMX::ObserverFactoryT<IceMX::ObserverT<IceMX::Metrics> >(o->getFacet(),
+                                                                                        "ServerActivation"));
+    }
 }
 
 void
@@ -781,6 +846,16 @@ NodeI::getActivator() const
     return _activator;
 }
 
+Ice::Instrumentation::ObserverPtr
+NodeI::getActivationObserver(const string& server, const string& application) const
+{
+    if(!_activations.get() || !_activations->isEnabled())
+    {
+        return 0;
+    }
+    return _activations->getObserver(ActivationHelper(_name, server, application));
+}
+
 IceUtil::TimerPtr
 NodeI::getTimer() const
 {
@@ -11,6 +11,8 @@
 #define ICE_GRID_NODE_I_H
 
 #include <IceUtil/Timer.h>
+#include <IceUtil/UniquePtr.h>
+#include <Ice/MetricsObserverI.h>
 #include <IcePatch2/FileServer.h>
 #include <IceGrid/Internal.h>
 #include <IceGrid/PlatformInfo.h>
@@ -145,6 +147,13 @@ public:
 
     bool canRemoveServerDirectory(const std::string&);
 
+    //
+    // Returns an observer for the activation of the given server, the
+    // observer is null if the metrics for server activations are
+    // disabled.
+    //
+    Ice::Instrumentation::ObserverPtr getActivationObserver(const std::string&, const std::string&) const;
+
 private:
 
     std::vector<ServerCommandPtr> checkConsistencyNoSync(const Ice::StringSeq&);
@@ -179,6 +188,7 @@ private:
     const std::string _tmpDir;
     const FileCachePtr _fileCache;
     PropertyDescriptorSeq _propertiesOverride;
+    IceUtil::UniquePtr<IceMX::ObserverFactoryT<IceMX::ObserverT<IceMX::Metrics> > > _activations;
 
     unsigned long _serial;
     bool _consistencyCheckDone;
@@ -69,7 +69,9 @@ ObjectCache::TypeEntry::remove(const ObjectEntryPtr& obj)
     return _objects.empty();
 }
 
-ObjectCache::ObjectCache(const Ice::CommunicatorPtr& communicator) : _communicator(communicator)
+ObjectCache::ObjectCache(const Ice::CommunicatorPtr& communicator) :
+    Cache<Ice::Identity, ObjectEntry>(true),
+    _communicator(communicator)
 {
 }
 
@@ -115,6 +117,17 @@ ObjectCache::get(const Ice::Identity& id) const
     return entry;
 }
 
+ObjectEntryPtr
+ObjectCache::lookup(const Ice::Identity& id) const
+{
+    ObjectEntryPtr entry = getSnapshot()->get(id);
+    if(!entry)
+    {
+        throw ObjectNotRegisteredException(id);
+    }
+    return entry;
+}
+
 void
 ObjectCache::remove(const Ice::Identity& id)
 {
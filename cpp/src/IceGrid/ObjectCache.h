@@ -47,6 +47,7 @@ public:
 
     void add(const ObjectInfo&, const std::string&);
     ObjectEntryPtr get(const Ice::Identity&) const;
+    ObjectEntryPtr lookup(const Ice::Identity&) const; // Lookup in the last published snapshot
     void remove(const Ice::Identity&);
 
     Ice::ObjectProxySeq getObjectsByType(const std::string&); 
@@ -19,6 +19,72 @@ using namespace IceGrid;
 namespace IceGrid
 {
 
+class AdapterUpdateCallback : public DatabaseWriteCallback
+{
+public:
+
+    AdapterUpdateCallback(const ReplicaSessionManager::ThreadPtr& thread,
+                          const ReplicaSessionPrx& session,
+                          const string& id,
+                          int serial) :
+        _thread(thread),
+        _session(session),
+        _id(id),
+        _serial(serial)
+    {
+    }
+
+    virtual void
+    committed()
+    {
+        receivedUpdate(string());
+    }
+
+    virtual void
+    failed(const IceUtil::Exception& ex)
+    {
+        string failure;
+        try
+        {
+            ex.ice_throw();
+        }
+        catch(const AdapterExistsException&)
+        {
+            failure = "adapter `" + _id + "' already exists and belongs to an application";
+        }
+        catch(const IceUtil::Exception& e)
+        {
+            ostringstream os;
+            os << e;
+            failure = os.str();
+        }
+        receivedUpdate(failure);
+    }
+
+private:
+
+    void
+    receivedUpdate(const string& failure)
+    {
+        try
+        {
+            _session->receivedUpdate(AdapterObserverTopicName, _serial, failure);
+        }
+        catch(const Ice::LocalException&)
+        {
+        }
+        if(!failure.empty())
+        {
+            _thread->destroyActiveSession();
+        }
+    }
+
+    const ReplicaSessionManager::ThreadPtr _thread;
+    const ReplicaSessionPrx _session;
+    const string _id;
+    const int _serial;
+};
+
 class MasterDatabaseObserverI : public DatabaseObserver, public IceUtil::Mutex
 {
 public:
@@ -35,6 +101,7 @@ public:
     virtual void 
     applicationInit(int, const ApplicationInfoSeq& applications, const Ice::Current& current)
     {
+        _database->flushWrites();
         int serial;
         _database->syncApplications(applications, getSerials(current.ctx, serial));
         receivedUpdate(ApplicationObserverTopicName, serial);
@@ -43,6 +110,7 @@ public:
     virtual void 
     applicationAdded(int, const ApplicationInfo& application, const Ice::Current& current)
     {
+        _database->flushWrites();
         int serial;
         string failure;
         try
@@ -61,6 +129,7 @@ public:
     virtual void 
     applicationRemoved(int, const std::string& name, const Ice::Current& current)
     {
+        _database->flushWrites();
         int serial;
         string failure;
         try
@@ -79,6 +148,7 @@ public:
     virtual void 
     applicationUpdated(int, const ApplicationUpdateInfo& update, const Ice::Current& current)
     {
+        _database->flushWrites();
         int serial;
         string failure;
         try
@@ -103,6 +173,7 @@ public:
     virtual void
     adapterInit(const AdapterInfoSeq& adapters, const Ice::Current& current)
     {
+        _database->flushWrites();
         int serial;
         _database->syncAdapters(adapters, getSerials(current.ctx, serial));
         receivedUpdate(AdapterObserverTopicName, serial);
@@ -111,49 +182,19 @@ public:
     virtual void 
     adapterAdded(const AdapterInfo& info, const Ice::Current& current)
     {
-        int serial;
-        string failure;
-        try
-        {
-            _database->setAdapterDirectProxy(info.id, info.replicaGroupId, info.proxy, getSerials(current.ctx, serial));
-        }
-        catch(const AdapterExistsException&)
-        {
-            failure = "adapter `" + info.id + "' already exists and belongs to an application";
-        }
-        receivedUpdate(AdapterObserverTopicName, serial, failure);
+        setAdapterDirectProxy(info.id, info.replicaGroupId, info.proxy, current);
     }
 
     virtual void 
     adapterUpdated(const AdapterInfo& info, const Ice::Current& current)
     {
-        int serial;
-        string failure;
-        try
-        {
-            _database->setAdapterDirectProxy(info.id, info.replicaGroupId, info.proxy, getSerials(current.ctx, serial));
-        }
-        catch(const AdapterExistsException&)
-        {
-            failure = "adapter `" + info.id + "' already exists and belongs to an application";
-        }
-        receivedUpdate(AdapterObserverTopicName, serial, failure);
+        setAdapterDirectProxy(info.id, info.replicaGroupId, info.proxy, current);
     }
 
     virtual void 
     adapterRemoved(const std::string& id, const Ice::Current& current)
     {
-        int serial;
-        string failure;
-        try
-        {
-            _database->setAdapterDirectProxy(id, "", 0, getSerials(current.ctx, serial));
-        }
-        catch(const AdapterExistsException&)
-        {
-            failure = "adapter `" + id + "' already exists and belongs to an application";
-        }
-        receivedUpdate(AdapterObserverTopicName, serial, failure);
+        setAdapterDirectProxy(id, "", 0, current);
     }
 
     virtual void
@@ -231,6 +272,23 @@ public:
 
 private:
 
+    void
+    setAdapterDirectProxy(const string& id, const string& replicaGroupId, const Ice::ObjectPrx& proxy,
+                          const Ice::Current& current)
+    {
+        //
+        // Don't wait for the update to be committed, the updates sent
+        // by the master in the meantime are committed with it. The
+        // master is notified once the update is committed. The other
+        // updates flush the queued adapter updates to preserve the
+        // ordering of the updates from the master.
+        //
+        int serial;
+        Ice::Long dbSerial = getSerials(current.ctx, serial);
+        _database->queueAdapterDirectProxy(id, replicaGroupId, proxy, dbSerial,
+                                           new AdapterUpdateCallback(_thread, _session, id, serial));
+    }
+
     Ice::Long
     getSerials(const Ice::Context& context, int& serial)
     {
@@ -616,6 +674,7 @@ ReplicaSessionManager::createSessionImpl(const InternalRegistryPrx& registry, Ic
         //
         DatabaseObserverPtr servant = new MasterDatabaseObserverI(_thread, _database, session);
         _observer = DatabaseObserverPrx::uncheckedCast(_database->getInternalAdapter()->addWithUUID(servant));
+        _database->flushWrites(); // Commit the updates from the previous session first.
         StringLongDict serials = _database->getSerials();
         IceUtil::Optional<StringLongDict> serialsOpt;
         if(!serials.empty())
@@ -819,6 +819,8 @@ ServerI::ServerI(const NodeIPtr& node, const ServerPrx& proxy, const string& ser
     _state(ServerI::Inactive),
     _activation(ServerI::Disabled),
     _failureTime(IceUtil::Time::now(IceUtil::Time::Monotonic)), // Ensure that _activation is init. in updateImpl().
+    _waitForReplication(false),
+    _activateOnDemand(false),
     _pid(0)
 {
     assert(_node->getActivator());
@@ -1185,6 +1187,15 @@ ServerI::start(ServerActivation activation, const AMD_Server_startPtr& amdCB)
         if(!_start)
         {
             _start = new StartCommand(this, _node->getTimer(), _activationTimeout);
+            _activateOnDemand = false;
+        }
+        if(activation == OnDemand)
+        {
+            //
+            // A client is waiting for the server adapters, the
+            // activator spawns this server before the others.
+            //
+            _activateOnDemand = true;
         }
         if(amdCB)
         {
@@ -1619,6 +1630,7 @@ ServerI::activate()
     InternalServerDescriptorPtr desc;
     ServerAdapterDict adpts;
     bool waitForReplication;
+    bool activateOnDemand;
 
 #ifndef _WIN32
     uid_t uid;
@@ -1647,6 +1659,22 @@ ServerI::activate()
             waitForReplication = _waitForReplication;
             _waitForReplication = false;
 
+            activateOnDemand = _activateOnDemand;
+
+            //
+            // The activation observer records the time from the
+            // activation request to the activation of the server
+            // adapters, including the wait for an activation slot.
+            //
+            if(!_activationObserver)
+            {
+                _activationObserver = _node->getActivationObserver(_id, desc->application);
+                if(_activationObserver)
+                {
+                    _activationObserver->attach();
+                }
+            }
+
             _process = 0;
 
 #ifndef _WIN32
@@ -1703,9 +1731,11 @@ ServerI::activate()
         }
 
 #ifndef _WIN32
-        int pid = _node->getActivator()->activate(desc->id, desc->exe, desc->pwd, uid, gid, options, envs, this);
+        int pid = _node->getActivator()->activate(desc->id, desc->exe, desc->pwd, uid, gid, options, envs, this,
+                                                  activateOnDemand);
 #else
-        int pid = _node->getActivator()->activate(desc->id, desc->exe, desc->pwd, options, envs, this);
+        int pid = _node->getActivator()->activate(desc->id, desc->exe, desc->pwd, options, envs, this,
+                                                  activateOnDemand);
 #endif
         ServerCommandPtr command;
         bool active = false;
@@ -2858,6 +2888,7 @@ ServerI::setStateNoSync(InternalServerState st, const std::string& reason)
         }
         break;
     case Active:
+        activationCompleted(false);
         if(_start)
         {
             _start->finished();
@@ -2865,6 +2896,7 @@ ServerI::setStateNoSync(InternalServerState st, const std::string& reason)
         }
         break;
     case ActivationTimeout:
+        activationCompleted(true);
         if(_start)
         {
             _start->failed(reason);
@@ -2872,6 +2904,7 @@ ServerI::setStateNoSync(InternalServerState st, const std::string& reason)
         }
         break;
     case Deactivating:
+        activationCompleted(true);
         if(_start)
         {
             _start->failed(reason.empty() ? string("The server is being deactivated.") : reason);
@@ -2879,6 +2912,7 @@ ServerI::setStateNoSync(InternalServerState st, const std::string& reason)
         }
         break;
     case Destroying:
+        activationCompleted(true);
         loadFailure = _destroy->loadFailure();
         if(_patch)
         {
@@ -3071,6 +3105,20 @@ ServerI::setStateNoSync(InternalServerState st, const std::string& reason)
     }
 }
 
+void
+ServerI::activationCompleted(bool failed)
+{
+    if(_activationObserver)
+    {
+        if(failed)
+        {
+            _activationObserver->failed(ServerStartException::ice_staticId());
+        }
+        _activationObserver->detach();
+        _activationObserver = 0;
+    }
+}
+
 ServerState
 ServerI::toServerState(InternalServerState st) const
 {
@@ -12,6 +12,7 @@
 
 #include <IceUtil/Mutex.h>
 #include <IceUtil/Timer.h>
+#include <Ice/Instrumentation.h>
 #include <IceGrid/Activator.h>
 #include <IceGrid/Internal.h>
 #include <set>
@@ -134,6 +135,7 @@ private:
     bool checkActivation();
     void checkDestroyed() const;
     void disableOnFailure();
+    void activationCompleted(bool);
 
     void setState(InternalServerState, const std::string& = std::string());
     ServerCommandPtr nextCommand();
@@ -169,6 +171,8 @@ private:
     ServerActivation _previousActivation;
     IceUtil::TimerTaskPtr _timerTask;
     bool _waitForReplication;
+    bool _activateOnDemand;
+    Ice::Instrumentation::ObserverPtr _activationObserver;
     std::string _stdErrFile;
     std::string _stdOutFile;
     Ice::StringSeq _logs;
@@ -27,10 +27,152 @@ Ice::EncodingVersion encodings[] = {
     { 1, 1 }
 };
 
+class ApplicationUpdate : public ObserverUpdate
+{
+public:
+
+    enum Kind
+    {
+        Added,
+        Removed,
+        Updated
+    };
+
+    ApplicationUpdate(const ApplicationInfo& info) : _kind(Added), _info(info)
+    {
+    }
+
+    ApplicationUpdate(const string& name) : _kind(Removed), _name(name)
+    {
+    }
+
+    ApplicationUpdate(const ApplicationUpdateInfo& update) : _kind(Updated), _update(update)
+    {
+    }
+
+    virtual void
+    send(const Ice::ObjectPrx& obsv, int serial, const Ice::Context& context) const
+    {
+        ApplicationObserverPrx observer = ApplicationObserverPrx::uncheckedCast(obsv);
+        switch(_kind)
+        {
+        case Added:
+            observer->applicationAdded(serial, _info, context);
+            break;
+        case Removed:
+            observer->applicationRemoved(serial, _name, context);
+            break;
+        case Updated:
+            observer->applicationUpdated(serial, _update, context);
+            break;
+        }
+    }
+
+private:
+
+    const Kind _kind;
+    const ApplicationInfo _info;
+    const string _name;
+    const ApplicationUpdateInfo _update;
+};
+
+class AdapterUpdate : public ObserverUpdate
+{
+public:
+
+    enum Kind
+    {
+        Added,
+        Updated,
+        Removed
+    };
+
+    AdapterUpdate(Kind kind, const AdapterInfo& info) : _kind(kind), _info(info)
+    {
+    }
+
+    AdapterUpdate(const string& id) : _kind(Removed), _id(id)
+    {
+    }
+
+    virtual void
+    send(const Ice::ObjectPrx& obsv, int, const Ice::Context& context) const
+    {
+        AdapterObserverPrx observer = AdapterObserverPrx::uncheckedCast(obsv);
+        switch(_kind)
+        {
+        case Added:
+            observer->adapterAdded(_info, context);
+            break;
+        case Updated:
+            observer->adapterUpdated(_info, context);
+            break;
+        case Removed:
+            observer->adapterRemoved(_id, context);
+            break;
+        }
+    }
+
+private:
+
+    const Kind _kind;
+    const AdapterInfo _info;
+    const string _id;
+};
+
+class ObjectUpdate : public ObserverUpdate
+{
+public:
+
+    enum Kind
+    {
+        Added,
+        Updated,
+        Removed
+    };
+
+    ObjectUpdate(Kind kind, const ObjectInfo& info) : _kind(kind), _info(info)
+    {
+    }
+
+    ObjectUpdate(const Ice::Identity& id) : _kind(Removed), _id(id)
+    {
+    }
+
+    virtual void
+    send(const Ice::ObjectPrx& obsv, int, const Ice::Context& context) const
+    {
+        ObjectObserverPrx observer = ObjectObserverPrx::uncheckedCast(obsv);
+        switch(_kind)
+        {
+        case Added:
+            observer->objectAdded(_info, context);
+            break;
+        case Updated:
+            observer->objectUpdated(_info, context);
+            break;
+        case Removed:
+            observer->objectRemoved(_id, context);
+            break;
+        }
+    }
+
+private:
+
+    const Kind _kind;
+    const ObjectInfo _info;
+    const Ice::Identity _id;
+};
+
 }
 
 ObserverTopic::ObserverTopic(const IceStorm::TopicManagerPrx& topicManager, const string& name, Ice::Long dbSerial) :
-    _logger(topicManager->ice_getCommunicator()->getLogger()), _serial(0), _dbSerial(dbSerial)
+    _logger(topicManager->ice_getCommunicator()->getLogger()),
+    _serial(0),
+    _dbSerial(dbSerial),
+    _updateLogSize(static_cast<size_t>(max(0, topicManager->ice_getCommunicator()->getProperties()->
+                                              getPropertyAsIntWithDefault("IceGrid.Registry.UpdateLogSize", 1000)))),
+    _updateLogStart(dbSerial + 1) // Subscribers with the same serial might still have a different state.
 {
     for(int i = 0; i < static_cast<int>(sizeof(encodings) / sizeof(Ice::EncodingVersion)); ++i)
     {
@@ -61,7 +203,7 @@ ObserverTopic::~ObserverTopic()
 }
 
 int
-ObserverTopic::subscribe(const Ice::ObjectPrx& obsv, const string& name)
+ObserverTopic::subscribe(const Ice::ObjectPrx& obsv, const string& name, Ice::Long dbSerial)
 {
     Lock sync(*this);
     if(_topics.empty())
@@ -70,6 +212,7 @@ ObserverTopic::subscribe(const Ice::ObjectPrx& obsv, const string& name)
     }
 
     assert(obsv);
+    bool initialized = true;
     try
     {
         IceStorm::QoS qos;
@@ -82,7 +225,26 @@ ObserverTopic::subscribe(const Ice::ObjectPrx& obsv, const string& name)
             out << "unsupported encoding version for observer `" << obsv << "'";
             return -1;
         }
-        initObserver(p->second->subscribeAndGetPublisher(qos, obsv->ice_twoway()));
+        Ice::ObjectPrx publisher = p->second->subscribeAndGetPublisher(qos, obsv->ice_twoway());
+
+        //
+        // If the subscriber provides the serial of its database and
+        // the log has all the updates since this serial, only send
+        // these updates rather than initializing the subscriber with
+        // the full state. A subscriber which failed to apply an update
+        // is always initialized, its database might differ from ours
+        // even if its serial is up to date.
+        //
+        if(dbSerial > 0 && dbSerial >= _updateLogStart && dbSerial <= _dbSerial &&
+           _initSubscribers.find(name) == _initSubscribers.end())
+        {
+            initialized = sendUpdates(publisher, dbSerial);
+        }
+        else
+        {
+            initObserver(publisher);
+            _initSubscribers.erase(name);
+        }
     }
     catch(const IceStorm::AlreadySubscribed&)
     {
@@ -93,8 +255,11 @@ ObserverTopic::subscribe(const Ice::ObjectPrx& obsv, const string& name)
     {
         assert(_syncSubscribers.find(name) == _syncSubscribers.end());
         _syncSubscribers.insert(name);
-        addExpectedUpdate(_serial, name);
-        return _serial;
+        if(initialized)
+        {
+            addExpectedUpdate(_serial, name);
+            return _serial;
+        }
     }
     return -1;
 }
@@ -159,6 +324,11 @@ void
 ObserverTopic::receivedUpdate(const string& name, int serial, const string& failure)
 {
     Lock sync(*this);
+    if(!failure.empty())
+    {
+        _initSubscribers.insert(name);
+    }
+
     map<int, set<string> >::iterator p = _waitForUpdates.find(serial);
     if(p != _waitForUpdates.end())
     {
@@ -181,6 +351,15 @@ ObserverTopic::receivedUpdate(const string& name, int serial, const string& fail
 
         notifyAll();
     }
+    else if(!failure.empty())
+    {
+        //
+        // The failure of an update replayed from the log, nobody waits
+        // for its acknowledgment.
+        //
+        Ice::Error err(_logger);
+        err << "replication failed on replica `" << name << "':\n" << failure;
+    }
 }
 
 void
@@ -288,6 +467,71 @@ ObserverTopic::getContext(int serial, Ice::Long dbSerial) const
     return context;
 }
 
+void
+ObserverTopic::logUpdate(Ice::Long dbSerial, const ObserverUpdatePtr& update)
+{
+    //
+    // Must be called with the lock held, after updateSerial(). The
+    // updates which don't change the database are logged with the
+    // current database serial.
+    //
+    LoggedUpdate logged;
+    logged.database = dbSerial > 0;
+    logged.dbSerial = _dbSerial;
+    logged.update = update;
+    _updateLog.push_back(logged);
+
+    while(_updateLog.size() > _updateLogSize)
+    {
+        const LoggedUpdate& first = _updateLog.front();
+        _updateLogStart = max(_updateLogStart, first.database ? first.dbSerial : first.dbSerial + 1);
+        _updateLog.pop_front();
+    }
+}
+
+void
+ObserverTopic::clearUpdates()
+{
+    //
+    // Must be called with the lock held, after updateSerial(). The
+    // subscribers can't be synchronized from the log anymore once the
+    // full state is replaced.
+    //
+    _updateLog.clear();
+    _updateLogStart = _dbSerial + 1;
+}
+
+bool
+ObserverTopic::sendUpdates(const Ice::ObjectPrx& observer, Ice::Long dbSerial)
+{
+    //
+    // Must be called with the lock held. Send the updates which
+    // followed the given database serial. The updates which don't
+    // change the database and were logged with this serial might
+    // already be known by the observer, they are sent again.
+    //
+    vector<const LoggedUpdate*> updates;
+    for(deque<LoggedUpdate>::const_iterator p = _updateLog.begin(); p != _updateLog.end(); ++p)
+    {
+        if(p->database ? p->dbSerial > dbSerial : p->dbSerial >= dbSerial)
+        {
+            updates.push_back(&*p);
+        }
+    }
+
+    //
+    // The observer acknowledges the last update with the current
+    // serial. The previous updates are acknowledged without serial,
+    // only their failures are taken into account by receivedUpdate.
+    //
+    for(vector<const LoggedUpdate*>::const_iterator p = updates.begin(); p != updates.end(); ++p)
+    {
+        const int serial = p + 1 == updates.end() ? _serial : -1;
+        (*p)->update->send(observer, serial, getContext(serial, (*p)->database ? (*p)->dbSerial : 0));
+    }
+    return !updates.empty();
+}
+
 RegistryObserverTopic::RegistryObserverTopic(const IceStorm::TopicManagerPrx& topicManager) : 
     ObserverTopic(topicManager, "RegistryObserver")
 {
@@ -587,6 +831,7 @@ ApplicationObserverTopic::applicationInit(Ice::Long dbSerial, const ApplicationI
     {
         _applications.insert(make_pair(p->descriptor.name, *p));
     }
+    clearUpdates();
     try
     {
         for(vector<ApplicationObserverPrx>::const_iterator p = _publishers.begin(); p != _publishers.end(); ++p)
@@ -614,6 +859,7 @@ ApplicationObserverTopic::applicationAdded(Ice::Long dbSerial, const Application
 
     updateSerial(dbSerial);
     _applications.insert(make_pair(info.descriptor.name, info));
+    logUpdate(dbSerial, new ApplicationUpdate(info));
     try
     {
         for(vector<ApplicationObserverPrx>::const_iterator p = _publishers.begin(); p != _publishers.end(); ++p)
@@ -640,6 +886,7 @@ ApplicationObserverTopic::applicationRemoved(Ice::Long dbSerial, const string& n
     }
     updateSerial(dbSerial);
     _applications.erase(name);
+    logUpdate(dbSerial, new ApplicationUpdate(name));
     try
     {
         for(vector<ApplicationObserverPrx>::const_iterator p = _publishers.begin(); p != _publishers.end(); ++p)
@@ -666,6 +913,7 @@ ApplicationObserverTopic::applicationUpdated(Ice::Long dbSerial, const Applicati
     }
 
     updateSerial(dbSerial);
+    logUpdate(dbSerial, new ApplicationUpdate(info));
     try
     {
         map<string, ApplicationInfo>::iterator p = _applications.find(info.descriptor.name);
@@ -752,6 +1000,7 @@ AdapterObserverTopic::adapterInit(Ice::Long dbSerial, const AdapterInfoSeq& adpt
     {
         _adapters.insert(make_pair(q->id, *q));
     }
+    clearUpdates();
     try
     {
         for(vector<AdapterObserverPrx>::const_iterator p = _publishers.begin(); p != _publishers.end(); ++p)
@@ -778,6 +1027,7 @@ AdapterObserverTopic::adapterAdded(Ice::Long dbSerial, const AdapterInfo& info)
     }
     updateSerial(dbSerial);
     _adapters.insert(make_pair(info.id, info));
+    logUpdate(dbSerial, new AdapterUpdate(AdapterUpdate::Added, info));
     try
     {
         for(vector<AdapterObserverPrx>::const_iterator p = _publishers.begin(); p != _publishers.end(); ++p)
@@ -804,6 +1054,7 @@ AdapterObserverTopic::adapterUpdated(Ice::Long dbSerial, const AdapterInfo& info
     }
     updateSerial(dbSerial);
     _adapters[info.id] = info;
+    logUpdate(dbSerial, new AdapterUpdate(AdapterUpdate::Updated, info));
     try
     {
         for(vector<AdapterObserverPrx>::const_iterator p = _publishers.begin(); p != _publishers.end(); ++p)
@@ -830,6 +1081,7 @@ AdapterObserverTopic::adapterRemoved(Ice::Long dbSerial, const string& id)
     }
     updateSerial(dbSerial);
     _adapters.erase(id);
+    logUpdate(dbSerial, new AdapterUpdate(id));
     try
     {
         for(vector<AdapterObserverPrx>::const_iterator p = _publishers.begin(); p != _publishers.end(); ++p)
@@ -880,6 +1132,7 @@ ObjectObserverTopic::objectInit(Ice::Long dbSerial, const ObjectInfoSeq& objects
     {
         _objects.insert(make_pair(r->proxy->ice_getIdentity(), *r));
     }
+    clearUpdates();
     try
     {
         for(vector<ObjectObserverPrx>::const_iterator p = _publishers.begin(); p != _publishers.end(); ++p)
@@ -906,6 +1159,7 @@ ObjectObserverTopic::objectAdded(Ice::Long dbSerial, const ObjectInfo& info)
     }
     updateSerial(dbSerial);
     _objects.insert(make_pair(info.proxy->ice_getIdentity(), info));
+    logUpdate(dbSerial, new ObjectUpdate(ObjectUpdate::Added, info));
     try
     {
         for(vector<ObjectObserverPrx>::const_iterator p = _publishers.begin(); p != _publishers.end(); ++p)
@@ -932,6 +1186,7 @@ ObjectObserverTopic::objectUpdated(Ice::Long dbSerial, const ObjectInfo& info)
     }
     updateSerial(dbSerial);
     _objects[info.proxy->ice_getIdentity()] = info;
+    logUpdate(dbSerial, new ObjectUpdate(ObjectUpdate::Updated, info));
     try
     {
         for(vector<ObjectObserverPrx>::const_iterator p = _publishers.begin(); p != _publishers.end(); ++p)
@@ -958,6 +1213,7 @@ ObjectObserverTopic::objectRemoved(Ice::Long dbSerial, const Ice::Identity& id)
     }
     updateSerial(dbSerial);
     _objects.erase(id);
+    logUpdate(dbSerial, new ObjectUpdate(id));
     try
     {
         for(vector<ObjectObserverPrx>::const_iterator p = _publishers.begin(); p != _publishers.end(); ++p)
@@ -990,6 +1246,7 @@ ObjectObserverTopic::wellKnownObjectsAddedOrUpdated(const ObjectInfoSeq& infos)
         if(q != _objects.end())
         {
             q->second = *p;
+            logUpdate(0, new ObjectUpdate(ObjectUpdate::Updated, *p));
             try
             {
                 for(vector<ObjectObserverPrx>::const_iterator q = _publishers.begin(); q != _publishers.end(); ++q)
@@ -1006,6 +1263,7 @@ ObjectObserverTopic::wellKnownObjectsAddedOrUpdated(const ObjectInfoSeq& infos)
         else
         {
             _objects.insert(make_pair(p->proxy->ice_getIdentity(), *p));
+            logUpdate(0, new ObjectUpdate(ObjectUpdate::Added, *p));
             try
             {
                 for(vector<ObjectObserverPrx>::const_iterator q = _publishers.begin(); q != _publishers.end(); ++q)
@@ -1043,6 +1301,7 @@ ObjectObserverTopic::wellKnownObjectsRemoved(const ObjectInfoSeq& infos)
     {
         updateSerial();
         _objects.erase(p->proxy->ice_getIdentity());
+        logUpdate(0, new ObjectUpdate(p->proxy->ice_getIdentity()));
         try
         {
             for(vector<ObjectObserverPrx>::const_iterator q = _publishers.begin(); q != _publishers.end(); ++q)
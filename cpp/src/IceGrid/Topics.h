@@ -15,10 +15,24 @@
 #include <IceGrid/Internal.h>
 #include <IceGrid/Registry.h>
 #include <set>
+#include <deque>
 
 namespace IceGrid
 {
 
+//
+// An update published by an observer topic. The topics keep the last
+// updates to only send the updates missed by a replica when it
+// subscribes again instead of the full state.
+//
+class ObserverUpdate : public IceUtil::Shared
+{
+public:
+
+    virtual void send(const Ice::ObjectPrx&, int, const Ice::Context&) const = 0;
+};
+typedef IceUtil::Handle<ObserverUpdate> ObserverUpdatePtr;
+
 class ObserverTopic : public IceUtil::Monitor<IceUtil::Mutex>, public virtual Ice::Object
 {
 public:
@@ -26,7 +40,7 @@ public:
     ObserverTopic(const IceStorm::TopicManagerPrx&, const std::string&, Ice::Long = 0);
     virtual ~ObserverTopic();
 
-    int subscribe(const Ice::ObjectPrx&, const std::string& = std::string());
+    int subscribe(const Ice::ObjectPrx&, const std::string& = std::string(), Ice::Long = 0);
     void unsubscribe(const Ice::ObjectPrx&, const std::string& = std::string());
     void destroy();
 
@@ -45,6 +59,10 @@ protected:
     void updateSerial(Ice::Long = 0);
     Ice::Context getContext(int, Ice::Long = 0) const;
 
+    void logUpdate(Ice::Long, const ObserverUpdatePtr&);
+    void clearUpdates();
+    bool sendUpdates(const Ice::ObjectPrx&, Ice::Long);
+
     template<typename T> std::vector<T> getPublishers() const
     {
         std::vector<T> publishers;
@@ -64,6 +82,17 @@ protected:
     std::set<std::string> _syncSubscribers;
     std::map<int, std::set<std::string> > _waitForUpdates;
     std::map<int, std::map<std::string, std::string> > _updateFailures;
+
+    struct LoggedUpdate
+    {
+        Ice::Long dbSerial;
+        bool database;
+        ObserverUpdatePtr update;
+    };
+    const size_t _updateLogSize;
+    std::deque<LoggedUpdate> _updateLog;
+    Ice::Long _updateLogStart; // The lowest database serial from which the log has all the updates.
+    std::set<std::string> _initSubscribers; // Subscribers which failed to apply an update.
 };
 typedef IceUtil::Handle<ObserverTopic> ObserverTopicPtr;
 
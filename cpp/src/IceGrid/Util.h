@@ -21,12 +21,29 @@
 namespace IceGrid
 {
 
+//
+// Random number generator used to shuffle replicas and objects. It's
+// seeded once with IceUtilInternal::random(), which reads /dev/urandom
+// under a global mutex on each call, and then uses a xorshift
+// generator.
+//
 struct RandomNumberGenerator : public std::unary_function<ptrdiff_t, ptrdiff_t>
 {
+    RandomNumberGenerator() : _state(IceUtilInternal::random() | 1)
+    {
+    }
+
     ptrdiff_t operator()(ptrdiff_t d)
     {
-        return IceUtilInternal::random(static_cast<int>(d));
+        _state ^= _state << 13;
+        _state ^= _state >> 17;
+        _state ^= _state << 5;
+        return static_cast<ptrdiff_t>(_state % static_cast<unsigned int>(d));
     }
+
+private:
+
+    unsigned int _state;
 };
 
 
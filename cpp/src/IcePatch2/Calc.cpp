@@ -13,6 +13,12 @@
 #include <IcePatch2Lib/Util.h>
 #include <iterator>
 
+#ifdef _WIN32
+#   include <windows.h>
+#else
+#   include <unistd.h>
+#endif
+
 using namespace std;
 using namespace Ice;
 using namespace IcePatch2;
@@ -107,6 +113,9 @@ usage(const string& appName)
         "-z, --compress          Always compress files.\n"
         "-Z, --no-compress       Never compress files.\n"
         "-i, --case-insensitive  Files must not differ in case only.\n"
+        "-t, --threads NUM       Compute checksums with NUM threads (default is\n"
+        "                        the number of processors).\n"
+        "-n, --no-cache          Don't use the checksum cache, read all files.\n"
         "-V, --verbose           Verbose mode.\n"
         ;
 }
@@ -139,6 +148,8 @@ main(int argc, char* argv[])
     opts.addOpt("Z", "no-compress");
     opts.addOpt("V", "verbose");
     opts.addOpt("i", "case-insensitive");
+    opts.addOpt("t", "threads", IceUtilInternal::Options::NeedArg);
+    opts.addOpt("n", "no-cache");
     
     vector<string> args;
     try
@@ -181,6 +192,36 @@ main(int argc, char* argv[])
     verbose = opts.isSet("verbose");
     caseInsensitive = opts.isSet("case-insensitive");
 
+    int threads;
+    if(opts.isSet("threads"))
+    {
+        istringstream is(opts.optArg("threads"));
+        if(!(is >> threads) || threads < 1)
+        {
+            cerr << appName << ": invalid number of threads `" << opts.optArg("threads") << "'" << endl;
+            usage(appName);
+            return EXIT_FAILURE;
+        }
+    }
+    else
+    {
+#ifdef _WIN32
+        SYSTEM_INFO sysInfo;
+        GetSystemInfo(&sysInfo);
+        threads = static_cast<int>(sysInfo.dwNumberOfProcessors);
+#else
+        threads = static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN));
+#endif
+        threads = max(threads, 1);
+    }
+
+    //
+    // The checksum cache avoids reading the files which didn't change
+    // since the last run.
+    //
+    ChecksumCache cache;
+    ChecksumCache* checksumCache = opts.isSet("no-cache") ? 0 : &cache;
+
     if(args.empty())
     {
         cerr << appName << ": no data directory specified" << endl;
@@ -239,7 +280,11 @@ main(int argc, char* argv[])
         if(fileSeq.empty())
         {
             CalcCB calcCB;
-            if(!getFileInfoSeq(absDataDir, compress, verbose ? &calcCB : 0, infoSeq))
+            if(checksumCache)
+            {
+                loadChecksumCache(absDataDir, cache);
+            }
+            if(!getFileInfoSeq(absDataDir, compress, verbose ? &calcCB : 0, infoSeq, threads, checksumCache))
             {
                 return EXIT_FAILURE;
             }
@@ -247,13 +292,18 @@ main(int argc, char* argv[])
         else
         {
             loadFileInfoSeq(absDataDir, infoSeq);
+            if(checksumCache)
+            {
+                loadChecksumCache(absDataDir, cache);
+            }
 
             for(StringSeq::iterator p = fileSeq.begin(); p != fileSeq.end(); ++p)
             {
                 LargeFileInfoSeq partialInfoSeq;
 
                 CalcCB calcCB;
-                if(!getFileInfoSeqSubDir(absDataDir, *p, compress, verbose ? &calcCB : 0, partialInfoSeq))
+                if(!getFileInfoSeqSubDir(absDataDir, *p, compress, verbose ? &calcCB : 0, partialInfoSeq, threads,
+                                         checksumCache))
                 {
                     return EXIT_FAILURE;
                 }
@@ -309,6 +359,24 @@ main(int argc, char* argv[])
         }
 
         saveFileInfoSeq(absDataDir, infoSeq);
+
+        if(checksumCache)
+        {
+            //
+            // Only keep the checksums of the files which are still in
+            // the data directory.
+            //
+            ChecksumCache newCache;
+            for(LargeFileInfoSeq::const_iterator p = infoSeq.begin(); p != infoSeq.end(); ++p)
+            {
+                ChecksumCache::const_iterator q = cache.find(p->path);
+                if(q != cache.end())
+                {
+                    newCache.insert(*q);
+                }
+            }
+            saveChecksumCache(absDataDir, newCache);
+        }
     }
     catch(const string& ex)
     {
@@ -150,7 +150,7 @@ public:
             cout << '\b';
         }
         ostringstream s;
-        s << progress << '/' << size << " (" << totalProgress << '/' << totalSize << ')';
+        s << progress << '/' << size << " (" << totalProgress << '/' << totalSize << ')' << _rate;
         _lastProgress = s.str();
         cout << _lastProgress << flush;
         return !keyPressed();
@@ -163,6 +163,19 @@ public:
         return !keyPressed();
     }
 
+    virtual bool
+    patchRate(Long rate, Long eta)
+    {
+        ostringstream s;
+        s << ' ' << rate / 1024 << " KB/s";
+        if(eta >= 0)
+        {
+            s << ", " << eta << "s left";
+        }
+        _rate = s.str();
+        return true;
+    }
+
 private:
 
 #ifdef _WIN32
@@ -250,6 +263,7 @@ private:
     }
 
     string _lastProgress;
+    string _rate;
     bool _pressAnyKeyMessage;
 };
 
@@ -0,0 +1,185 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <IceUtil/DisableWarnings.h>
+#include <IceUtil/FileUtil.h>
+#include <IceUtil/StringUtil.h>
+#include <IcePatch2/FileCache.h>
+#include <IcePatch2/FileServer.h>
+
+#ifdef _WIN32
+#   include <io.h>
+#else
+#   include <unistd.h>
+#   include <sys/mman.h>
+#endif
+
+using namespace std;
+using namespace Ice;
+using namespace IcePatch2;
+
+IcePatch2::OpenFile::OpenFile(const string& dataDir, const string& path) :
+    _path(path),
+    _fd(-1),
+    _size(0),
+    _map(0)
+{
+    const string absolutePath = dataDir + '/' + path;
+    _fd = IceUtilInternal::open(absolutePath, O_RDONLY|O_BINARY);
+    if(_fd == -1)
+    {
+        throw FileAccessException(string("cannot open `") + path + "' for reading: " + strerror(errno));
+    }
+
+    IceUtilInternal::structstat buf;
+    if(IceUtilInternal::stat(absolutePath, &buf) == -1)
+    {
+        IceUtilInternal::close(_fd);
+        throw FileAccessException(string("cannot stat `") + path + "':\n" + IceUtilInternal::lastErrorToString());
+    }
+    _size = buf.st_size;
+
+#ifndef _WIN32
+    //
+    // Map the file if it fits in the address space. The descriptor
+    // isn't needed anymore once the file is mapped. The data directory
+    // isn't supposed to change while the server is running, truncating
+    // a mapped file would make the reads fail.
+    //
+    if(_size > 0 && static_cast<Long>(static_cast<size_t>(_size)) == _size)
+    {
+        void* map = mmap(0, static_cast<size_t>(_size), PROT_READ, MAP_SHARED, _fd, 0);
+        if(map != MAP_FAILED)
+        {
+            //
+            // Clients read the files sequentially, let the kernel read
+            // ahead aggressively.
+            //
+            posix_madvise(map, static_cast<size_t>(_size), POSIX_MADV_SEQUENTIAL);
+            _map = static_cast<const Byte*>(map);
+            IceUtilInternal::close(_fd);
+            _fd = -1;
+        }
+    }
+#   if defined(__linux)
+    if(!_map)
+    {
+        posix_fadvise(_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    }
+#   endif
+#endif
+}
+
+IcePatch2::OpenFile::~OpenFile()
+{
+#ifndef _WIN32
+    if(_map)
+    {
+        munmap(const_cast<Byte*>(_map), static_cast<size_t>(_size));
+    }
+#endif
+    if(_fd != -1)
+    {
+        IceUtilInternal::close(_fd);
+    }
+}
+
+pair<const Byte*, const Byte*>
+IcePatch2::OpenFile::read(Long pos, Int num, vector<Byte>& buffer) const
+{
+    if(num <= 0 || pos < 0 || pos >= _size)
+    {
+        return pair<const Byte*, const Byte*>(0, 0);
+    }
+
+    size_t count = static_cast<size_t>(min(static_cast<Long>(num), _size - pos));
+    if(_map)
+    {
+        return pair<const Byte*, const Byte*>(_map + pos, _map + pos + count);
+    }
+
+    buffer.resize(count);
+#ifdef _WIN32
+    int r;
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        if(_lseeki64(_fd, pos, SEEK_SET) != pos)
+        {
+            ostringstream posStr;
+            posStr << pos;
+            throw FileAccessException("cannot seek position " + posStr.str() + " in file `" + _path + "': " +
+                                      strerror(errno));
+        }
+        r = _read(_fd, &buffer[0], static_cast<unsigned int>(count));
+    }
+#else
+    ssize_t r = pread(_fd, &buffer[0], count, static_cast<off_t>(pos));
+#endif
+    if(r == -1)
+    {
+        throw FileAccessException("cannot read `" + _path + "': " + strerror(errno));
+    }
+    else if(r == 0)
+    {
+        return pair<const Byte*, const Byte*>(0, 0);
+    }
+    return pair<const Byte*, const Byte*>(&buffer[0], &buffer[0] + r);
+}
+
+IcePatch2::FileCache::FileCache(const string& dataDir, size_t maxSize) :
+    _dataDir(dataDir),
+    _maxSize(maxSize)
+{
+}
+
+OpenFilePtr
+IcePatch2::FileCache::get(const string& path)
+{
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        OpenFileMap::iterator p = _files.find(path);
+        if(p != _files.end())
+        {
+            _lru.splice(_lru.begin(), _lru, p->second);
+            return p->second->second;
+        }
+    }
+
+    //
+    // Open the file without holding the lock, a slow open doesn't block
+    // the requests for the other files.
+    //
+    OpenFilePtr file = new OpenFile(_dataDir, path);
+
+    IceUtil::Mutex::Lock sync(_mutex);
+    OpenFileMap::iterator p = _files.find(path);
+    if(p != _files.end())
+    {
+        //
+        // Another request opened the file concurrently.
+        //
+        _lru.splice(_lru.begin(), _lru, p->second);
+        return p->second->second;
+    }
+
+    if(_maxSize > 0)
+    {
+        _lru.push_front(make_pair(path, file));
+        _files.insert(make_pair(path, _lru.begin()));
+        while(_files.size() > _maxSize)
+        {
+            //
+            // The file is closed once the requests using it complete.
+            //
+            _files.erase(_lru.back().first);
+            _lru.pop_back();
+        }
+    }
+    return file;
+}
@@ -0,0 +1,89 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_PATCH2_FILE_CACHE_H
+#define ICE_PATCH2_FILE_CACHE_H
+
+#include <Ice/Ice.h>
+#include <IceUtil/Mutex.h>
+
+#include <list>
+#include <map>
+
+namespace IcePatch2
+{
+
+//
+// A file opened for reading by the file server. On platforms which
+// support it, the file is mapped in memory and the chunks are returned
+// directly from the mapped memory.
+//
+class OpenFile : public IceUtil::Shared
+{
+public:
+
+    OpenFile(const std::string&, const std::string&);
+    virtual ~OpenFile();
+
+    Ice::Long size() const
+    {
+        return _size;
+    }
+
+    //
+    // Read up to the given number of bytes at the given position. The
+    // returned range is either in the mapped memory or in the given
+    // buffer, it's only valid as long as the file and the buffer are.
+    //
+    std::pair<const Ice::Byte*, const Ice::Byte*> read(Ice::Long, Ice::Int, std::vector<Ice::Byte>&) const;
+
+private:
+
+    const std::string _path;
+    int _fd;
+    Ice::Long _size;
+    const Ice::Byte* _map;
+#ifdef _WIN32
+    IceUtil::Mutex _mutex; // Protects the file position
+#endif
+};
+typedef IceUtil::Handle<OpenFile> OpenFilePtr;
+
+//
+// A cache of the files opened by the file server, which bounds the
+// number of open file descriptors. The least recently used file is
+// closed once the last request using it completes.
+//
+class FileCache : private IceUtil::noncopyable
+{
+public:
+
+    FileCache(const std::string&, size_t);
+
+    //
+    // Get the file with the given path, relative to the data directory.
+    //
+    OpenFilePtr get(const std::string&);
+
+private:
+
+    typedef std::list<std::pair<std::string, OpenFilePtr> > OpenFileList;
+    typedef std::map<std::string, OpenFileList::iterator> OpenFileMap;
+
+    const std::string _dataDir;
+    const size_t _maxSize;
+
+    IceUtil::Mutex _mutex;
+    OpenFileMap _files;
+    OpenFileList _lru; // Most recently used file first.
+};
+
+}
+
+#endif
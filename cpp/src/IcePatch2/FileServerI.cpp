@@ -12,19 +12,67 @@
 #include <IceUtil/StringUtil.h>
 #include <IcePatch2/FileServerI.h>
 
-#ifdef _WIN32
-#   include <io.h>
-#else
-#   include <unistd.h>
-#endif
-
 using namespace std;
 using namespace Ice;
 using namespace IcePatch2;
 using namespace IcePatch2Internal;
 
-IcePatch2::FileServerI::FileServerI(const std::string& dataDir, const LargeFileInfoSeq& infoSeq) :
-    _dataDir(dataDir), _tree0(FileTree0())
+namespace
+{
+
+string
+checkPath(const string& pa)
+{
+    if(IceUtilInternal::isAbsolutePath(pa))
+    {
+        throw FileAccessException(string("illegal absolute path `") + pa + "'");
+    }
+
+    string path = simplify(pa);
+    
+    if(path == ".." ||
+       path.find("/../") != string::npos ||
+       (path.size() >= 3 && (path.substr(0, 3) == "../" || path.substr(path.size() - 3, 3) == "/..")))
+    {
+        throw FileAccessException(string("illegal `..' component in path `") + path + "'");
+    }
+    return path;
+}
+
+}
+
+namespace IcePatch2
+{
+
+class ChunkIndexerThread : public IceUtil::Thread
+{
+public:
+
+    ChunkIndexerThread(const FileServerI* server) :
+        IceUtil::Thread("IcePatch2 chunk indexer"),
+        _server(server)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        _server->runChunkIndexer();
+    }
+
+private:
+
+    //
+    // Not a handle, the server joins this thread when destroyed.
+    //
+    const FileServerI* _server;
+};
+
+}
+
+IcePatch2::FileServerI::FileServerI(const std::string& dataDir, const LargeFileInfoSeq& infoSeq,
+                                    size_t maxOpenFiles) :
+    _dataDir(dataDir), _tree0(FileTree0()), _destroyed(false), _fileCache(dataDir, maxOpenFiles)
 {
     FileTree0& tree0 = const_cast<FileTree0&>(_tree0);
     getFileTree0(infoSeq, tree0);
@@ -76,16 +124,10 @@ IcePatch2::FileServerI::getFileCompressed_async(const AMD_FileServer_getFileComp
 {
     try
     {
+        pair<const Byte*, const Byte*> bytes;
         vector<Byte> buffer;
-        getFileCompressedInternal(pa, pos, num, buffer, false);
-        if(buffer.empty())
-        {
-            cb->ice_response(make_pair<const Byte*, const Byte*>(0, 0));
-        }
-        else
-        {
-            cb->ice_response(make_pair<const Byte*, const Byte*>(&buffer[0], &buffer[0] + buffer.size()));
-        }
+        OpenFilePtr file = getFileCompressedInternal(pa, pos, num, bytes, buffer, false);
+        cb->ice_response(bytes);
     }
     catch(const std::exception& ex)
     {
@@ -99,17 +141,10 @@ IcePatch2::FileServerI::getLargeFileCompressed_async(const AMD_FileServer_getLar
 {
     try
     {
+        pair<const Byte*, const Byte*> bytes;
         vector<Byte> buffer;
-        getFileCompressedInternal(pa, pos, num, buffer, true);
-        if(buffer.empty())
-        {
-            cb->ice_response(make_pair<const Byte*, const Byte*>(0, 0));
-        }
-        else
-        {
-            cb->ice_response(make_pair<const Byte*, const Byte*>(&buffer[0], &buffer[0] + buffer.size()));
-        }
-        
+        OpenFilePtr file = getFileCompressedInternal(pa, pos, num, bytes, buffer, true);
+        cb->ice_response(bytes);
     }
     catch(const std::exception& ex)
     {
@@ -118,80 +153,194 @@ IcePatch2::FileServerI::getLargeFileCompressed_async(const AMD_FileServer_getLar
 }
 
 void
-IcePatch2::FileServerI::getFileCompressedInternal(const std::string& pa, Ice::Long pos, Ice::Int num, 
-                                                  vector<Byte>& buffer, bool largeFile) const
+IcePatch2::FileServerI::getChunkInfoSeq_async(const AMD_FileServer_getChunkInfoSeqPtr& cb, const string& pa,
+                                              const Current&) const
 {
-    if(IceUtilInternal::isAbsolutePath(pa))
+    string path;
+    try
     {
-        throw FileAccessException(string("illegal absolute path `") + pa + "'");
+        path = checkPath(pa);
+    }
+    catch(const std::exception& ex)
+    {
+        cb->ice_exception(ex);
+        return;
     }
 
-    string path = simplify(pa);
-    
-    if(path == ".." ||
-       path.find("/../") != string::npos ||
-       (path.size() >= 3 && (path.substr(0, 3) == "../" || path.substr(path.size() - 3, 3) == "/..")))
+    ChunkInfoSeq chunks;
     {
-        throw FileAccessException(string("illegal `..' component in path `") + path + "'");
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_chunksMonitor);
+        map<string, ChunkInfoSeq>::const_iterator p = _chunks.find(path);
+        if(p == _chunks.end())
+        {
+            if(_destroyed)
+            {
+                cb->ice_exception(Ice::ObjectNotExistException(__FILE__, __LINE__));
+                return;
+            }
+
+            //
+            // Queue the file for the chunk indexer thread unless it's
+            // already queued, the request is answered once the chunks
+            // are computed.
+            //
+            vector<AMD_FileServer_getChunkInfoSeqPtr>& requests = _chunksRequests[path];
+            if(requests.empty())
+            {
+                _chunksQueue.push_back(path);
+                if(!_chunkIndexer)
+                {
+                    _chunkIndexer = new ChunkIndexerThread(this);
+                    _chunkIndexer->start();
+                }
+                _chunksMonitor.notify();
+            }
+            requests.push_back(cb);
+            return;
+        }
+        chunks = p->second;
     }
-    
+    cb->ice_response(chunks);
+}
+
+void
+IcePatch2::FileServerI::getFileChunk_async(const AMD_FileServer_getFileChunkPtr& cb,
+                                           const string& pa, Long pos, Int num, const Current&) const
+{
+    try
+    {
+        pair<const Byte*, const Byte*> bytes;
+        vector<Byte> buffer;
+        OpenFilePtr file = getFileCompressedInternal(pa, pos, num, bytes, buffer, true, false);
+        cb->ice_response(bytes);
+    }
+    catch(const std::exception& ex)
+    {
+        cb->ice_exception(ex);
+    }
+}
+
+OpenFilePtr
+IcePatch2::FileServerI::getFileCompressedInternal(const std::string& pa, Ice::Long pos, Ice::Int num,
+                                                  pair<const Byte*, const Byte*>& bytes, vector<Byte>& buffer,
+                                                  bool largeFile, bool compressed) const
+{
+    string path = checkPath(pa);
+
+    bytes = pair<const Byte*, const Byte*>(0, 0);
     if(num <= 0 || pos < 0)
     {   
-        return;
+        return 0;
     }
     
-    string absolutePath = _dataDir + '/' + path + ".bz2";
-    int fd = IceUtilInternal::open(absolutePath, O_RDONLY|O_BINARY);
-    if(fd == -1)
+    OpenFilePtr file = _fileCache.get(compressed ? path + ".bz2" : path);
+    
+    if(!largeFile && file->size() > 0x7FFFFFFF)
     {
-        throw FileAccessException(string("cannot open `") + path + "' for reading: " + strerror(errno));
+        ostringstream os;
+        os << "cannot encode size `" << file->size() << "' for file `" << path << "' as Ice::Int" << endl;
+        throw FileAccessException(os.str());
     }
-    
-    if(!largeFile)
+
+    //
+    // The returned range points to the mapped file, or to the buffer
+    // if the file isn't mapped. The caller keeps the returned file until
+    // the reply is marshaled.
+    //
+    bytes = file->read(pos, num, buffer);
+    return file;
+}
+
+void
+IcePatch2::FileServerI::destroy()
+{
+    IceUtil::ThreadPtr chunkIndexer;
+    map<string, vector<AMD_FileServer_getChunkInfoSeqPtr> > requests;
     {
-        IceUtilInternal::structstat buf;
-        if(IceUtilInternal::stat(absolutePath, &buf) == -1)
-        {
-            throw FileAccessException(string("cannot stat `") + path + "':\n" + IceUtilInternal::lastErrorToString());
-        }
-        
-        if(buf.st_size > 0x7FFFFFFF)
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_chunksMonitor);
+        _destroyed = true;
+        _chunksMonitor.notify();
+        chunkIndexer = _chunkIndexer;
+        _chunkIndexer = 0;
+        requests.swap(_chunksRequests);
+        _chunksQueue.clear();
+    }
+
+    if(chunkIndexer)
+    {
+        chunkIndexer->getThreadControl().join();
+    }
+
+    for(map<string, vector<AMD_FileServer_getChunkInfoSeqPtr> >::const_iterator p = requests.begin();
+        p != requests.end(); ++p)
+    {
+        for(vector<AMD_FileServer_getChunkInfoSeqPtr>::const_iterator q = p->second.begin(); q != p->second.end(); ++q)
         {
-            ostringstream os;
-            os << "cannot encode size `" << buf.st_size << "' for file `" << path << "' as Ice::Int" << endl;
-            throw FileAccessException(os.str());
+            (*q)->ice_exception(Ice::ObjectNotExistException(__FILE__, __LINE__));
         }
     }
+}
 
-    if(
-#if defined(_MSC_VER)
-        _lseek(fd, static_cast<off_t>(pos), SEEK_SET)
-#else
-        lseek(fd, static_cast<off_t>(pos), SEEK_SET)
-#endif
-        != static_cast<off_t>(pos))
+void
+IcePatch2::FileServerI::runChunkIndexer() const
+{
+    while(true)
     {
-        IceUtilInternal::close(fd);
+        string path;
+        {
+            IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_chunksMonitor);
+            while(_chunksQueue.empty() && !_destroyed)
+            {
+                _chunksMonitor.wait();
+            }
+            if(_destroyed)
+            {
+                return;
+            }
+            path = _chunksQueue.front();
+            _chunksQueue.pop_front();
+        }
 
-        ostringstream posStr;
-        posStr << pos;
+        ChunkInfoSeq chunks;
+        string error;
+        try
+        {
+            IcePatch2Internal::getChunkInfoSeq(_dataDir + '/' + path, chunks);
+        }
+        catch(const string& ex)
+        {
+            error = ex;
+        }
 
-        throw FileAccessException("cannot seek position " + posStr.str() + " in file `" + path + "': " +
-                                  strerror(errno));
-    }
+        //
+        // Errors aren't cached, the next request for the file computes
+        // its chunks again.
+        //
+        vector<AMD_FileServer_getChunkInfoSeqPtr> requests;
+        {
+            IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_chunksMonitor);
+            if(error.empty())
+            {
+                _chunks.insert(make_pair(path, chunks));
+            }
+            map<string, vector<AMD_FileServer_getChunkInfoSeqPtr> >::iterator p = _chunksRequests.find(path);
+            if(p != _chunksRequests.end())
+            {
+                requests.swap(p->second);
+                _chunksRequests.erase(p);
+            }
+        }
 
-    buffer.resize(num);
-#ifdef _WIN32
-    int r;
-    if((r = _read(fd, &buffer[0], static_cast<unsigned int>(num))) == -1)
-#else
-    ssize_t r;
-    if((r = read(fd, &buffer[0], static_cast<size_t>(num))) == -1)
-#endif
-    {
-        IceUtilInternal::close(fd);
-        throw FileAccessException("cannot read `" + path + "': " + strerror(errno));
+        for(vector<AMD_FileServer_getChunkInfoSeqPtr>::const_iterator p = requests.begin(); p != requests.end(); ++p)
+        {
+            if(error.empty())
+            {
+                (*p)->ice_response(chunks);
+            }
+            else
+            {
+                (*p)->ice_exception(FileAccessException(error));
+            }
+        }
     }
-
-    IceUtilInternal::close(fd);
 }
@@ -12,6 +12,12 @@
 
 #include <IcePatch2Lib/Util.h>
 #include <IcePatch2/FileServer.h>
+#include <IcePatch2/FileCache.h>
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Monitor.h>
+#include <IceUtil/Thread.h>
+
+#include <deque>
 
 namespace IcePatch2
 {
@@ -20,7 +26,7 @@ class FileServerI : public FileServer
 {
 public:
 
-    FileServerI(const std::string&, const LargeFileInfoSeq&);
+    FileServerI(const std::string&, const LargeFileInfoSeq&, size_t);
 
     FileInfoSeq getFileInfoSeq(Ice::Int, const Ice::Current&) const;
     
@@ -43,18 +49,53 @@ public:
                                       Ice::Int, 
                                       const Ice::Current&) const;
 
+    void getChunkInfoSeq_async(const AMD_FileServer_getChunkInfoSeqPtr&,
+                               const std::string&,
+                               const Ice::Current&) const;
+
+    void getFileChunk_async(const AMD_FileServer_getFileChunkPtr&,
+                            const std::string&,
+                            Ice::Long,
+                            Ice::Int,
+                            const Ice::Current&) const;
+
+    void destroy();
+
 private:
+
+    friend class ChunkIndexerThread;
+    void runChunkIndexer() const;
     
-    void
+    OpenFilePtr
     getFileCompressedInternal(const std::string&,
                               Ice::Long,
                               Ice::Int, 
+                              std::pair<const Ice::Byte*, const Ice::Byte*>&,
                               std::vector<Ice::Byte>&,
-                              bool) const;
+                              bool,
+                              bool = true) const;
 
     const std::string _dataDir;
     const IcePatch2Internal::FileTree0 _tree0;
+
+    //
+    // The chunks of the files computed so far. The data directory
+    // doesn't change while the server is running, so the chunks of a
+    // file are only computed once. They are computed on the first
+    // request by a single thread, outside the server thread pool, and
+    // the concurrent requests for the same file wait for the same
+    // computation.
+    //
+    mutable IceUtil::Monitor<IceUtil::Mutex> _chunksMonitor;
+    mutable std::map<std::string, ChunkInfoSeq> _chunks;
+    mutable std::map<std::string, std::vector<AMD_FileServer_getChunkInfoSeqPtr> > _chunksRequests;
+    mutable std::deque<std::string> _chunksQueue;
+    mutable IceUtil::ThreadPtr _chunkIndexer;
+    mutable bool _destroyed;
+
+    mutable FileCache _fileCache;
 };
+typedef IceUtil::Handle<FileServerI> FileServerIPtr;
 
 }
 
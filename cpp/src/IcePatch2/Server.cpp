@@ -37,6 +37,8 @@ protected:
 private:
 
     void usage(const std::string&);
+
+    FileServerIPtr _fileServer;
 };
 
 };
@@ -141,7 +143,13 @@ IcePatch2::PatcherService::start(int argc, char* argv[], int& status)
     Identity id;
     id.category = instanceName;
     id.name = "server";
-    adapter->add(new FileServerI(dataDir, infoSeq), id);
+    //
+    // The maximum number of files kept open by the file server.
+    //
+    size_t maxOpenFiles =
+        static_cast<size_t>(max(properties->getPropertyAsIntWithDefault("IcePatch2.MaxOpenFiles", 64), 0));
+    _fileServer = new FileServerI(dataDir, infoSeq, maxOpenFiles);
+    adapter->add(_fileServer, id);
 
     adapter->activate();
 
@@ -151,6 +159,11 @@ IcePatch2::PatcherService::start(int argc, char* argv[], int& status)
 bool
 IcePatch2::PatcherService::stop()
 {
+    if(_fileServer)
+    {
+        _fileServer->destroy();
+        _fileServer = 0;
+    }
     return true;
 }
 
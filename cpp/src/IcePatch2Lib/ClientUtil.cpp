@@ -9,9 +9,19 @@
 
 #include <IceUtil/StringUtil.h>
 #include <IceUtil/FileUtil.h>
+#include <IceUtil/SHA1.h>
 #include <IcePatch2/ClientUtil.h>
 #include <IcePatch2Lib/Util.h>
+
+#ifdef _WIN32
+#   include <io.h>
+#else
+#   include <unistd.h>
+#endif
+
 #include <list>
+#include <deque>
+#include <set>
 #include <iterator>
 
 using namespace std;
@@ -31,21 +41,32 @@ IcePatch2::PatcherFeedback::~PatcherFeedback()
     // Out of line to avoid weak vtable
 }
 
+bool
+IcePatch2::PatcherFeedback::patchRate(Ice::Long, Ice::Long)
+{
+    return true;
+}
+
 namespace
 {
 
-class Decompressor : public IceUtil::Thread, public IceUtil::Monitor<IceUtil::Mutex>
+//
+// The decompressor decompresses the downloaded files with a pool of
+// threads while the patcher downloads the next files.
+//
+class Decompressor : public IceUtil::Shared, public IceUtil::Monitor<IceUtil::Mutex>
 {
 public:
 
     Decompressor(const string&);
     virtual ~Decompressor();
 
+    void start(int);
     void destroy();
     void add(const LargeFileInfo&);
     void exception() const;
     void log(FILE* fp);
-    virtual void run();
+    void run();
 
 private:
 
@@ -55,9 +76,31 @@ private:
     list<LargeFileInfo> _files;
     LargeFileInfoSeq _filesDone;
     bool _destroy;
+    vector<IceUtil::ThreadPtr> _threads;
 };
 typedef IceUtil::Handle<Decompressor> DecompressorPtr;
 
+class DecompressorThread : public IceUtil::Thread
+{
+public:
+
+    DecompressorThread(const DecompressorPtr& decompressor) :
+        IceUtil::Thread("IcePatch2 decompressor thread"),
+        _decompressor(decompressor)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        _decompressor->run();
+    }
+
+private:
+
+    const DecompressorPtr _decompressor;
+};
+
 class PatcherI : public Patcher
 {
 public:
@@ -78,11 +121,23 @@ private:
     bool updateFilesInternal(const LargeFileInfoSeq&, const DecompressorPtr&);
     bool updateFlags(const LargeFileInfoSeq&);
 
+    struct ChunkRequest
+    {
+        LargeFileInfoSeq::const_iterator file;
+        Ice::AsyncResultPtr result;
+    };
+    void sendChunkRequests(std::deque<ChunkRequest>&, LargeFileInfoSeq::const_iterator&, Ice::Long&,
+                           const LargeFileInfoSeq::const_iterator&);
+    bool patchFileChunks(const LargeFileInfo&, const ChunkInfoSeq&, Ice::Long&, Ice::Long, bool&);
+
     const PatcherFeedbackPtr _feedback;
     const std::string _dataDir;
     const bool _thorough;
     const Ice::Int _chunkSize;
     const Ice::Int _remove;
+    const Ice::Int _chunkWindow;
+    const Ice::Int _decompressThreads;
+    const Ice::Long _deltaMinSize;
     const FileServerPrx _serverCompress;
     const FileServerPrx _serverNoCompress;
 
@@ -104,14 +159,46 @@ Decompressor::Decompressor(const string& dataDir) :
 Decompressor::~Decompressor()
 {
     assert(_destroy);
+    assert(_threads.empty());
+}
+
+void
+Decompressor::start(int threadCount)
+{
+    for(int i = 0; i < threadCount; ++i)
+    {
+        IceUtil::ThreadPtr thread = new DecompressorThread(this);
+#if defined(__hppa)
+        //
+        // The thread stack size is only 64KB only HP-UX and that's not
+        // enough for this thread.
+        //
+        thread->start(256 * 1024); // 256KB
+#else
+        thread->start();
+#endif
+        _threads.push_back(thread);
+    }
 }
 
 void
 Decompressor::destroy()
 {
-    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
-    _destroy = true;
-    notify();
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+        _destroy = true;
+        notifyAll();
+    }
+
+    //
+    // Wait for the threads to decompress the remaining files. This also
+    // releases the threads which hold a reference on the decompressor.
+    //
+    for(vector<IceUtil::ThreadPtr>::const_iterator p = _threads.begin(); p != _threads.end(); ++p)
+    {
+        (*p)->getThreadControl().join();
+    }
+    _threads.clear();
 }
 
 void
@@ -193,7 +280,11 @@ Decompressor::run()
         {
             IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
             _destroy = true;
-            _exception = ex;
+            if(_exception.empty())
+            {
+                _exception = ex;
+            }
+            notifyAll();
             return;
         }
     }
@@ -206,6 +297,9 @@ PatcherI::PatcherI(const CommunicatorPtr& communicator, const PatcherFeedbackPtr
     _thorough(communicator->getProperties()->getPropertyAsIntWithDefault("IcePatch2Client.Thorough", 0) > 0),
     _chunkSize(communicator->getProperties()->getPropertyAsIntWithDefault("IcePatch2Client.ChunkSize", 100)),
     _remove(communicator->getProperties()->getPropertyAsIntWithDefault("IcePatch2Client.Remove", 1)),
+    _chunkWindow(0),
+    _decompressThreads(0),
+    _deltaMinSize(0),
     _log(0),
     _useSmallFileAPI(false)
 {
@@ -236,6 +330,10 @@ PatcherI::PatcherI(const FileServerPrx& server,
     _thorough(thorough),
     _chunkSize(chunkSize),
     _remove(remove),
+    _chunkWindow(0),
+    _decompressThreads(0),
+    _deltaMinSize(0),
+    _log(0),
     _useSmallFileAPI(false)
 {
     init(server);
@@ -629,6 +727,25 @@ PatcherI::init(const FileServerPrx& server)
         const_cast<Int&>(_chunkSize) *= 1024;
     }
 
+    //
+    // The number of chunk requests sent ahead of the chunk being
+    // written, and the number of threads decompressing the downloaded
+    // files.
+    //
+    const_cast<Int&>(_chunkWindow) =
+        max(communicator->getProperties()->getPropertyAsIntWithDefault("IcePatch2Client.ChunkWindow", 4), 1);
+    const_cast<Int&>(_decompressThreads) =
+        max(communicator->getProperties()->getPropertyAsIntWithDefault("IcePatch2Client.DecompressThreads", 1), 1);
+
+    //
+    // Files at least this large (in kilobytes) which already exist
+    // locally are patched by only downloading the chunks that changed.
+    // A value of 0 disables delta patching.
+    //
+    const_cast<Long&>(_deltaMinSize) =
+        static_cast<Long>(communicator->getProperties()->getPropertyAsIntWithDefault("IcePatch2Client.DeltaMinSize",
+                                                                                     1024)) * 1024;
+
     if(!IceUtilInternal::isAbsolutePath(_dataDir))
     {
         string cwd;
@@ -651,11 +768,28 @@ PatcherI::removeFiles(const LargeFileInfoSeq& files)
         return true;
     }
 
+    //
+    // Files whose contents are updated are kept on disk, they are
+    // replaced when updated and their chunks can be reused to patch
+    // them.
+    //
+    set<string> updatePaths;
+    for(LargeFileInfoSeq::const_iterator p = _updateFiles.begin(); p != _updateFiles.end(); ++p)
+    {
+        if(p->size >= 0)
+        {
+            updatePaths.insert(p->path);
+        }
+    }
+
     for(LargeFileInfoSeq::const_reverse_iterator p = files.rbegin(); p != files.rend(); ++p)
     {
         try
         {
-            remove(_dataDir + '/' + p->path);
+            if(p->size < 0 || updatePaths.find(p->path) == updatePaths.end())
+            {
+                remove(_dataDir + '/' + p->path);
+            }
             if(fputc('-', _log) == EOF || ! writeFileInfo(_log, *p))
             {
                 throw "error writing log file:\n" + IceUtilInternal::lastErrorToString();
@@ -700,15 +834,7 @@ bool
 PatcherI::updateFiles(const LargeFileInfoSeq& files)
 {
     DecompressorPtr decompressor = new Decompressor(_dataDir);
-#if defined(__hppa)
-    //
-    // The thread stack size is only 64KB only HP-UX and that's not
-    // enough for this thread.
-    //
-    decompressor->start(256 * 1024); // 256KB
-#else
-    decompressor->start();
-#endif
+    decompressor->start(_decompressThreads);
     bool result;
 
     try
@@ -718,19 +844,231 @@ PatcherI::updateFiles(const LargeFileInfoSeq& files)
     catch(...)
     {
         decompressor->destroy();
-        decompressor->getThreadControl().join();
         decompressor->log(_log);
         throw;
     }
 
     decompressor->destroy();
-    decompressor->getThreadControl().join();
     decompressor->log(_log);
     decompressor->exception();
 
     return result;
 }
 
+void
+PatcherI::sendChunkRequests(deque<ChunkRequest>& requests, LargeFileInfoSeq::const_iterator& file, Long& pos,
+                            const LargeFileInfoSeq::const_iterator& end)
+{
+    //
+    // Keep up to _chunkWindow chunk requests outstanding. The requests
+    // don't stop at the end of the current file, the first chunks of
+    // the next files are requested while the current file is written.
+    //
+    while(requests.size() < static_cast<size_t>(_chunkWindow))
+    {
+        while(file != end && pos >= file->size) // Skip directories, empty files and completed files.
+        {
+            ++file;
+            pos = 0;
+        }
+
+        if(file == end)
+        {
+            return;
+        }
+
+        ChunkRequest request;
+        request.file = file;
+        request.result = _useSmallFileAPI ?
+            _serverNoCompress->begin_getFileCompressed(file->path, static_cast<Ice::Int>(pos), _chunkSize) :
+            _serverNoCompress->begin_getLargeFileCompressed(file->path, pos, _chunkSize);
+        requests.push_back(request);
+        pos += _chunkSize;
+    }
+}
+
+void
+closeChunkFiles(FILE* fp, int fd, const string& pathTemp)
+{
+    if(fp)
+    {
+        fclose(fp);
+        remove(pathTemp);
+    }
+    if(fd != -1)
+    {
+        IceUtilInternal::close(fd);
+    }
+}
+
+bool
+PatcherI::patchFileChunks(const LargeFileInfo& info, const ChunkInfoSeq& chunks, Long& updated, Long total,
+                          bool& patched)
+{
+    const string path = simplify(_dataDir + '/' + info.path);
+    const string pathTemp = path + ".bz2temp"; // Ignored and removed if orphaned, like the .bz2 files.
+
+    const ChunkInfo& last = chunks.back();
+    const Long size = last.offset + last.size;
+
+    //
+    // The file checksum is computed over the relative path followed
+    // by the file contents, see getFileInfoSeq().
+    //
+    IceUtilInternal::SHA1 hasher;
+    hasher.update(reinterpret_cast<const IceUtil::Byte*>(info.path.c_str()), info.path.size());
+
+    int fd = -1;
+    FILE* fp = 0;
+    try
+    {
+        //
+        // Index the chunks of the local file by checksum.
+        //
+        ChunkInfoSeq localChunkSeq;
+        getChunkInfoSeq(path, localChunkSeq);
+        map<ByteSeq, ChunkInfo> localChunks;
+        for(ChunkInfoSeq::const_iterator p = localChunkSeq.begin(); p != localChunkSeq.end(); ++p)
+        {
+            localChunks.insert(make_pair(p->checksum, *p));
+        }
+
+        fd = IceUtilInternal::open(path, O_BINARY|O_RDONLY);
+        if(fd == -1)
+        {
+            throw "cannot open `" + path + "' for reading:\n" + IceUtilInternal::lastErrorToString();
+        }
+
+        fp = IceUtilInternal::fopen(pathTemp, "wb");
+        if(fp == 0)
+        {
+            throw "cannot open `" + pathTemp + "' for writing:\n" + IceUtilInternal::lastErrorToString();
+        }
+
+        //
+        // The missing chunks are requested ahead, up to _chunkWindow
+        // requests are outstanding.
+        //
+        vector<AsyncResultPtr> results(chunks.size());
+        size_t next = 0;
+        Int outstanding = 0;
+        Long pos = 0;
+        for(size_t i = 0; i < chunks.size(); ++i)
+        {
+            for(; next < chunks.size() && outstanding < _chunkWindow; ++next)
+            {
+                if(localChunks.find(chunks[next].checksum) == localChunks.end())
+                {
+                    results[next] = _serverCompress->begin_getFileChunk(info.path, chunks[next].offset,
+                                                                        chunks[next].size);
+                    ++outstanding;
+                }
+            }
+
+            const ChunkInfo& chunk = chunks[i];
+            if(chunk.size <= 0 || chunk.offset != pos)
+            {
+                throw "invalid chunk list for `" + info.path + "'";
+            }
+
+            ByteSeq bytes;
+            if(results[i])
+            {
+                try
+                {
+                    bytes = _serverCompress->end_getFileChunk(results[i]);
+                }
+                catch(const FileAccessException& ex)
+                {
+                    throw "error from IcePatch2 server for `" + info.path + "': " + ex.reason;
+                }
+                results[i] = 0;
+                --outstanding;
+            }
+            else
+            {
+                const ChunkInfo& local = localChunks[chunk.checksum];
+                bytes.resize(static_cast<size_t>(local.size));
+                if(
+#if defined(_MSC_VER)
+                    _lseek(fd, static_cast<off_t>(local.offset), SEEK_SET)
+#else
+                    lseek(fd, static_cast<off_t>(local.offset), SEEK_SET)
+#endif
+                    != static_cast<off_t>(local.offset) ||
+#if defined(_MSC_VER)
+                    _read(fd, &bytes[0], static_cast<unsigned int>(bytes.size()))
+#else
+                    read(fd, &bytes[0], bytes.size())
+#endif
+                    != static_cast<int>(bytes.size()))
+                {
+                    throw "cannot read from `" + path + "':\n" + IceUtilInternal::lastErrorToString();
+                }
+            }
+
+            if(bytes.size() != static_cast<size_t>(chunk.size))
+            {
+                throw "size mismatch for `" + info.path + "'";
+            }
+
+            if(fwrite(reinterpret_cast<char*>(&bytes[0]), bytes.size(), 1, fp) != 1)
+            {
+                throw ": cannot write `" + pathTemp + "':\n" + IceUtilInternal::lastErrorToString();
+            }
+            hasher.update(&bytes[0], bytes.size());
+            pos += chunk.size;
+
+            //
+            // The progress is reported relative to the compressed file
+            // size, like for the files that are downloaded in full.
+            //
+            Long progress = static_cast<Long>(static_cast<double>(pos) / size * info.size);
+            if(!_feedback->patchProgress(progress, info.size, updated + progress, total))
+            {
+                fclose(fp);
+                IceUtilInternal::close(fd);
+                remove(pathTemp);
+                return false;
+            }
+        }
+    }
+    catch(const string&)
+    {
+        //
+        // Fall back to downloading the whole file.
+        //
+        closeChunkFiles(fp, fd, pathTemp);
+        return true;
+    }
+    catch(...)
+    {
+        closeChunkFiles(fp, fd, pathTemp);
+        throw;
+    }
+
+    fclose(fp);
+    IceUtilInternal::close(fd);
+
+    ByteSeq checksum;
+    hasher.finalize(checksum);
+    if(checksum != info.checksum)
+    {
+        remove(pathTemp);
+        return true;
+    }
+
+    rename(pathTemp, path);
+    setFileFlags(path, info);
+    if(fputc('+', _log) == EOF || !writeFileInfo(_log, info))
+    {
+        throw "error writing log file:\n" + IceUtilInternal::lastErrorToString();
+    }
+    updated += info.size;
+    patched = true;
+    return true;
+}
+
 bool
 PatcherI::updateFilesInternal(const LargeFileInfoSeq& files, const DecompressorPtr& decompressor)
 {
@@ -745,10 +1083,78 @@ PatcherI::updateFilesInternal(const LargeFileInfoSeq& files, const DecompressorP
         }
     }
 
-    AsyncResultPtr curCB;
-    AsyncResultPtr nxtCB;
-
+    //
+    // First patch the files which already exist locally by only
+    // downloading the chunks that changed. The other files, and the
+    // files for which this fails, are downloaded in full below.
+    //
+    LargeFileInfoSeq fullFiles;
+    bool delta = _deltaMinSize > 0;
     for(LargeFileInfoSeq::const_iterator p = files.begin(); p != files.end(); ++p)
+    {
+        IceUtilInternal::structstat buf;
+        if(!delta || p->size <= 0 || IceUtilInternal::stat(simplify(_dataDir + '/' + p->path), &buf) == -1 ||
+           !S_ISREG(buf.st_mode) || buf.st_size < _deltaMinSize)
+        {
+            fullFiles.push_back(*p);
+            continue;
+        }
+
+        ChunkInfoSeq chunks;
+        try
+        {
+            chunks = _serverNoCompress->getChunkInfoSeq(p->path);
+        }
+        catch(const Ice::OperationNotExistException&)
+        {
+            delta = false; // The server doesn't support delta patching.
+        }
+        catch(const FileAccessException&)
+        {
+        }
+
+        bool patched = false;
+        if(!chunks.empty())
+        {
+            if(!_feedback->patchStart(p->path, p->size, updated, total))
+            {
+                return false;
+            }
+
+            if(!patchFileChunks(*p, chunks, updated, total, patched))
+            {
+                return false;
+            }
+
+            if(!_feedback->patchEnd())
+            {
+                return false;
+            }
+        }
+
+        if(!patched)
+        {
+            fullFiles.push_back(*p);
+        }
+    }
+
+    //
+    // The chunk requests are sent in order and their replies are
+    // consumed in the same order, so each file is still written
+    // sequentially.
+    //
+    deque<ChunkRequest> requests;
+    LargeFileInfoSeq::const_iterator nextFile = fullFiles.begin();
+    Long nextPos = 0;
+
+    //
+    // Download rate and estimated remaining time, reported to the
+    // feedback at most once per second.
+    //
+    const IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    IceUtil::Time lastRate = start;
+
+    for(LargeFileInfoSeq::const_iterator p = fullFiles.begin(); p != fullFiles.end(); ++p)
     {
         if(p->size < 0) // Directory?
         {
@@ -805,41 +1211,11 @@ PatcherI::updateFilesInternal(const LargeFileInfoSeq& files, const DecompressorP
 
                     while(pos < p->size)
                     {
-                        if(!curCB)
-                        {
-                            assert(!nxtCB);
-                            curCB = _useSmallFileAPI ?
-                                _serverNoCompress->begin_getFileCompressed(p->path, static_cast<Ice::Int>(pos), _chunkSize) :
-                                _serverNoCompress->begin_getLargeFileCompressed(p->path, pos, _chunkSize);
-                        }
-                        else
-                        {
-                            assert(nxtCB);
-                            swap(nxtCB, curCB);
-                        }
+                        sendChunkRequests(requests, nextFile, nextPos, fullFiles.end());
+                        assert(!requests.empty() && requests.front().file == p);
 
-                        if(pos + _chunkSize < p->size)
-                        {
-                            nxtCB = _useSmallFileAPI ?
-                                _serverNoCompress->begin_getFileCompressed(p->path, static_cast<Ice::Int>(pos + _chunkSize), _chunkSize) :
-                                _serverNoCompress->begin_getLargeFileCompressed(p->path, pos + _chunkSize, _chunkSize);
-                        }
-                        else
-                        {
-                            LargeFileInfoSeq::const_iterator q = p + 1;
-
-                            while(q != files.end() && q->size <= 0)
-                            {
-                                ++q;
-                            }
-
-                            if(q != files.end())
-                            {
-                                nxtCB = _useSmallFileAPI ?
-                                    _serverNoCompress->begin_getFileCompressed(q->path, 0, _chunkSize) :
-                                    _serverNoCompress->begin_getLargeFileCompressed(q->path, 0, _chunkSize);
-                            }
-                        }
+                        AsyncResultPtr curCB = requests.front().result;
+                        requests.pop_front();
 
                         ByteSeq bytes;
 
@@ -853,25 +1229,43 @@ PatcherI::updateFilesInternal(const LargeFileInfoSeq& files, const DecompressorP
                             throw "error from IcePatch2 server for `" + p->path + "': " + ex.reason;
                         }
 
-                        if(bytes.empty())
+                        //
+                        // The next chunks are requested at fixed offsets, so
+                        // every chunk but the last one must be complete.
+                        //
+                        if(bytes.empty() ||
+                           (bytes.size() < static_cast<size_t>(_chunkSize) && pos + static_cast<Long>(bytes.size()) < p->size))
                         {
                             throw "size mismatch for `" + p->path + "'";
                         }
 
-                        if(fwrite(reinterpret_cast<char*>(&bytes[0]), bytes.size(), 1, fileBZ2) != 1)
-                        {
-                            throw ": cannot write `" + pathBZ2 + "':\n" + IceUtilInternal::lastErrorToString();
-                        }
-
                         // 'bytes' is always returned with size '_chunkSize'. When a file is smaller than '_chunkSize'
                         // or we are reading the last chunk of a file, 'bytes' will be larger than necessary. In this
                         // case we calculate the current position and updated size based on the known file size.
                         size_t size = (pos + bytes.size()) > static_cast<size_t>(p->size) ?
                             static_cast<size_t>(p->size - pos) : bytes.size();
 
+                        if(fwrite(reinterpret_cast<char*>(&bytes[0]), size, 1, fileBZ2) != 1)
+                        {
+                            throw ": cannot write `" + pathBZ2 + "':\n" + IceUtilInternal::lastErrorToString();
+                        }
+
                         pos += size;
                         updated += size;
 
+                        IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+                        if(now - lastRate >= IceUtil::Time::seconds(1))
+                        {
+                            lastRate = now;
+                            Long rate = static_cast<Long>(updated / (now - start).toSecondsDouble());
+                            Long eta = rate > 0 ? (total - updated) / rate : -1;
+                            if(!_feedback->patchRate(rate, eta))
+                            {
+                                fclose(fileBZ2);
+                                return false;
+                            }
+                        }
+
                         if(!_feedback->patchProgress(pos, p->size, updated, total))
                         {
                             fclose(fileBZ2);
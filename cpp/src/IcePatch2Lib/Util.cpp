@@ -24,6 +24,7 @@
 #include <IcePatch2/FileServer.h>
 #include <bzlib.h>
 #include <iomanip>
+#include <fstream>
 
 #ifdef _WIN32
 #   include <direct.h>
@@ -41,6 +42,7 @@
 
 const char* IcePatch2Internal::checksumFile = "IcePatch2.sum";
 const char* IcePatch2Internal::logFile = "IcePatch2.log";
+const char* IcePatch2Internal::checksumCacheFile = "IcePatch2.cache";
 
 using namespace std;
 using namespace Ice;
@@ -747,11 +749,371 @@ IcePatch2Internal::setFileFlags(const string&, const LargeFileInfo&)
 namespace
 {
 
+//
+// The chunk boundaries are found with a gear rolling hash: a boundary
+// is placed after a byte if the top 16 bits of the hash are zero,
+// which gives chunks of 64KB on average. The hash only depends on the
+// last 32 bytes.
+//
+const size_t chunkMinSize = 16 * 1024;
+const size_t chunkMaxSize = 256 * 1024;
+const unsigned int chunkBoundaryMask = 0xFFFF0000;
+
+class GearTable
+{
+public:
+
+    GearTable()
+    {
+        //
+        // The client and the server must compute the same chunks, so
+        // the table is filled with a fixed pseudo-random sequence.
+        //
+        unsigned int x = 0x9E3779B9;
+        for(int i = 0; i < 256; ++i)
+        {
+            x ^= x << 13;
+            x ^= x >> 17;
+            x ^= x << 5;
+            _table[i] = x & 0xFFFFFFFF;
+        }
+    }
+
+    unsigned int
+    operator[](Byte b) const
+    {
+        return _table[b];
+    }
+
+private:
+
+    unsigned int _table[256];
+};
+const GearTable gearTable;
+
+void
+addChunk(ChunkInfoSeq& chunks, Long offset, const ByteSeq& bytes)
+{
+    ChunkInfo chunk;
+    chunk.offset = offset;
+    chunk.size = static_cast<Int>(bytes.size());
+    IceUtilInternal::sha1(&bytes[0], bytes.size(), chunk.checksum);
+    chunks.push_back(chunk);
+}
+
+}
+
+void
+IcePatch2Internal::getChunkInfoSeq(const string& pa, ChunkInfoSeq& chunks)
+{
+    const string path = simplify(pa);
+
+    int fd = IceUtilInternal::open(path, O_BINARY|O_RDONLY);
+    if(fd == -1)
+    {
+        throw "cannot open `" + path + "' for reading:\n" + IceUtilInternal::lastErrorToString();
+    }
+
+    ByteSeq buffer(1024 * 1024);
+    ByteSeq chunk;
+    chunk.reserve(chunkMaxSize);
+    Long offset = 0;
+    unsigned int hash = 0;
+    while(true)
+    {
+#if defined(_MSC_VER)
+        int r = _read(fd, &buffer[0], static_cast<unsigned int>(buffer.size()));
+#else
+        ssize_t r = read(fd, &buffer[0], buffer.size());
+#endif
+        if(r == -1)
+        {
+            IceUtilInternal::close(fd);
+            throw "cannot read from `" + path + "':\n" + IceUtilInternal::lastErrorToString();
+        }
+        else if(r == 0)
+        {
+            break;
+        }
+
+        for(ByteSeq::const_iterator p = buffer.begin(); p != buffer.begin() + r; ++p)
+        {
+            chunk.push_back(*p);
+            hash = ((hash << 1) + gearTable[*p]) & 0xFFFFFFFF;
+            if((chunk.size() >= chunkMinSize && (hash & chunkBoundaryMask) == 0) || chunk.size() >= chunkMaxSize)
+            {
+                addChunk(chunks, offset, chunk);
+                offset += static_cast<Long>(chunk.size());
+                chunk.clear();
+                hash = 0;
+            }
+        }
+    }
+    IceUtilInternal::close(fd);
+
+    if(!chunk.empty())
+    {
+        addChunk(chunks, offset, chunk);
+    }
+}
+
+namespace
+{
+
+//
+// Compute the checksum of the given regular file, and compress it if
+// requested.
+//
+void
+computeFileInfo(const string& path, const string& relPath, const IceUtilInternal::structstat& buf, bool doCompress,
+                LargeFileInfo& info)
+{
+    IceUtilInternal::structstat bufBZ2;
+    const string pathBZ2 = path + ".bz2";
+
+    ByteSeq bytesSHA;
+
+    if(relPath.size() + buf.st_size == 0)
+    {
+        bytesSHA.resize(20);
+        fill(bytesSHA.begin(), bytesSHA.end(), 0);
+    }
+    else
+    {
+        IceUtilInternal::SHA1 hasher;
+        if(relPath.size() != 0)
+        {
+            hasher.update(reinterpret_cast<const IceUtil::Byte*>(relPath.c_str()), relPath.size());
+        }
+
+        if(buf.st_size != 0)
+        {
+            int fd = IceUtilInternal::open(path.c_str(), O_BINARY|O_RDONLY);
+            if(fd == -1)
+            {
+                throw "cannot open `" + path + "' for reading:\n" + IceUtilInternal::lastErrorToString();
+            }
+
+            const string pathBZ2Temp = path + ".bz2temp";
+            FILE* stdioFile = 0;
+            int bzError = 0;
+            BZFILE* bzFile = 0;
+            if(doCompress)
+            {
+                stdioFile = IceUtilInternal::fopen(simplify(pathBZ2Temp), "wb");
+                if(!stdioFile)
+                {
+                    IceUtilInternal::close(fd);
+                    throw "cannot open `" + pathBZ2Temp + "' for writing:\n" + IceUtilInternal::lastErrorToString();
+                }
+
+                bzFile = BZ2_bzWriteOpen(&bzError, stdioFile, 5, 0, 0);
+                if(bzError != BZ_OK)
+                {
+                    string ex = "BZ2_bzWriteOpen failed";
+                    if(bzError == BZ_IO_ERROR)
+                    {
+                    ex += string(": ") + IceUtilInternal::lastErrorToString();
+                    }
+                    fclose(stdioFile);
+                    IceUtilInternal::close(fd);
+                    throw ex;
+                }
+            }
+
+            //
+            // The same buffer is used for all the reads, a read can
+            // return less bytes than requested.
+            //
+            ByteSeq bytes(static_cast<size_t>(min(static_cast<Long>(buf.st_size), static_cast<Long>(1024 * 1024))));
+            Long bytesLeft = buf.st_size;
+            while(bytesLeft > 0)
+            {
+                unsigned int num = static_cast<unsigned int>(min(bytesLeft, static_cast<Long>(bytes.size())));
+#if defined(_MSC_VER)
+                int bytesRead = _read(fd, &bytes[0], num);
+#else
+                ssize_t bytesRead = read(fd, &bytes[0], num);
+#endif
+                if(bytesRead <= 0)
+                {
+                    if(doCompress)
+                    {
+                        fclose(stdioFile);
+                    }
+
+                    IceUtilInternal::close(fd);
+                    if(bytesRead == 0)
+                    {
+                        throw "unexpected end of file `" + path + "'";
+                    }
+                    throw "cannot read from `" + path + "':\n" + IceUtilInternal::lastErrorToString();
+                }
+                bytesLeft -= bytesRead;
+                if(doCompress)
+                {
+                    BZ2_bzWrite(&bzError, bzFile, const_cast<Byte*>(&bytes[0]), static_cast<int>(bytesRead));
+                    if(bzError != BZ_OK)
+                    {
+                        string ex = "BZ2_bzWrite failed";
+                        if(bzError == BZ_IO_ERROR)
+                        {
+                            ex += string(": ") + IceUtilInternal::lastErrorToString();
+                        }
+                        BZ2_bzWriteClose(&bzError, bzFile, 0, 0, 0);
+                        fclose(stdioFile);
+                        IceUtilInternal::close(fd);
+                        throw ex;
+                    }
+                }
+
+                hasher.update(reinterpret_cast<IceUtil::Byte*>(&bytes[0]), static_cast<size_t>(bytesRead));
+            }
+
+            IceUtilInternal::close(fd);
+
+            if(doCompress)
+            {
+                BZ2_bzWriteClose(&bzError, bzFile, 0, 0, 0);
+                if(bzError != BZ_OK)
+                {
+                    string ex = "BZ2_bzWriteClose failed";
+                    if(bzError == BZ_IO_ERROR)
+                    {
+                        ex += string(": ") + IceUtilInternal::lastErrorToString();
+                    }
+                    fclose(stdioFile);
+                    throw ex;
+                }
+
+                fclose(stdioFile);
+
+                rename(pathBZ2Temp, pathBZ2);
+
+                if(IceUtilInternal::stat(pathBZ2, &bufBZ2) == -1)
+                {
+                    throw "cannot stat `" + pathBZ2 + "':\n" + IceUtilInternal::lastErrorToString();
+                }
+
+                info.size = bufBZ2.st_size;
+            }
+        }
+        hasher.finalize(bytesSHA);
+    }
+
+    info.checksum.swap(bytesSHA);
+}
+
+//
+// A regular file whose checksum is computed by the thread pool once
+// the directory walk completes.
+//
+struct FileTask
+{
+    string path;
+    string relPath;
+    IceUtilInternal::structstat buf;
+    bool doCompress;
+    size_t index;
+};
+
+class FileTaskQueue : public IceUtil::Mutex
+{
+public:
+
+    FileTaskQueue(const vector<FileTask>& tasks, LargeFileInfoSeq& infoSeq) :
+        _tasks(tasks),
+        _infoSeq(infoSeq),
+        _next(0)
+    {
+    }
+
+    void
+    run()
+    {
+        const FileTask* task;
+        while((task = next()) != 0)
+        {
+            try
+            {
+                computeFileInfo(task->path, task->relPath, task->buf, task->doCompress, _infoSeq[task->index]);
+            }
+            catch(const string& ex)
+            {
+                error(ex);
+            }
+            catch(const char* ex)
+            {
+                error(ex);
+            }
+        }
+    }
+
+    void
+    checkError() const
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        if(!_error.empty())
+        {
+            throw _error;
+        }
+    }
+
+private:
+
+    const FileTask*
+    next()
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        if(!_error.empty() || _next == _tasks.size())
+        {
+            return 0;
+        }
+        return &_tasks[_next++];
+    }
+
+    void
+    error(const string& ex)
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        if(_error.empty())
+        {
+            _error = ex;
+        }
+    }
+
+    const vector<FileTask>& _tasks;
+    LargeFileInfoSeq& _infoSeq; // Each task only updates its own element.
+    size_t _next;
+    string _error;
+};
+
+class FileTaskThread : public IceUtil::Thread
+{
+public:
+
+    FileTaskThread(FileTaskQueue& queue) :
+        IceUtil::Thread("IcePatch2 checksum thread"),
+        _queue(queue)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        _queue.run();
+    }
+
+private:
+
+    FileTaskQueue& _queue;
+};
+
 static bool
 getFileInfoSeqInternal(const string& basePath, const string& relPath, int compress, GetFileInfoSeqCB* cb,
-                       LargeFileInfoSeq& infoSeq)
+                       LargeFileInfoSeq& infoSeq, vector<FileTask>* tasks, const ChecksumCache* cache)
 {
-    if(relPath == checksumFile || relPath == logFile)
+    if(relPath == checksumFile || relPath == logFile || relPath == checksumCacheFile)
     {
         return true;
     }
@@ -836,7 +1198,7 @@ getFileInfoSeqInternal(const string& basePath, const string& relPath, int compre
             StringSeq content = readDirectory(path);
             for(StringSeq::const_iterator p = content.begin(); p != content.end() ; ++p)
             {
-                if(!getFileInfoSeqInternal(basePath, simplify(relPath + '/' + *p), compress, cb, infoSeq))
+                if(!getFileInfoSeqInternal(basePath, simplify(relPath + '/' + *p), compress, cb, infoSeq, tasks, cache))
                 {
                     return false;
                 }
@@ -878,135 +1240,44 @@ getFileInfoSeqInternal(const string& basePath, const string& relPath, int compre
                 }
             }
 
+            //
+            // Reuse the cached checksum if the file didn't change since
+            // it was computed. The compressed file is up to date if it
+            // doesn't need to be compressed again.
+            //
+            if(cache && !doCompress)
+            {
+                ChecksumCache::const_iterator p = cache->find(relPath);
+                if(p != cache->end() && p->second.size == static_cast<Long>(buf.st_size) &&
+                   p->second.mtime == static_cast<Long>(buf.st_mtime) &&
+                   p->second.inode == static_cast<Long>(buf.st_ino))
+                {
+                    info.checksum = p->second.checksum;
+                    infoSeq.push_back(info);
+                    return true;
+                }
+            }
+
             if(cb && !cb->checksum(relPath))
             {
                 return false;
             }
 
-            ByteSeq bytesSHA;
-
-            if(relPath.size() + buf.st_size == 0)
+            if(tasks)
             {
-                bytesSHA.resize(20);
-                fill(bytesSHA.begin(), bytesSHA.end(), 0);
+                FileTask task;
+                task.path = path;
+                task.relPath = relPath;
+                task.buf = buf;
+                task.doCompress = doCompress;
+                task.index = infoSeq.size();
+                tasks->push_back(task);
             }
             else
             {
-                IceUtilInternal::SHA1 hasher;
-                if(relPath.size() != 0)
-                {
-                    hasher.update(reinterpret_cast<const IceUtil::Byte*>(relPath.c_str()), relPath.size());
-                }
-
-                if(buf.st_size != 0)
-                {
-                    int fd = IceUtilInternal::open(path.c_str(), O_BINARY|O_RDONLY);
-                    if(fd == -1)
-                    {
-                        throw "cannot open `" + path + "' for reading:\n" + IceUtilInternal::lastErrorToString();
-                    }
-
-                    const string pathBZ2Temp = path + ".bz2temp";
-                    FILE* stdioFile = 0;
-                    int bzError = 0;
-                    BZFILE* bzFile = 0;
-                    if(doCompress)
-                    {
-                        stdioFile = IceUtilInternal::fopen(simplify(pathBZ2Temp), "wb");
-                        if(!stdioFile)
-                        {
-                            IceUtilInternal::close(fd);
-                            throw "cannot open `" + pathBZ2Temp + "' for writing:\n" + IceUtilInternal::lastErrorToString();
-                        }
-
-                        bzFile = BZ2_bzWriteOpen(&bzError, stdioFile, 5, 0, 0);
-                        if(bzError != BZ_OK)
-                        {
-                            string ex = "BZ2_bzWriteOpen failed";
-                            if(bzError == BZ_IO_ERROR)
-                            {
-                            ex += string(": ") + IceUtilInternal::lastErrorToString();
-                            }
-                            fclose(stdioFile);
-                            IceUtilInternal::close(fd);
-                            throw ex;
-                        }
-                    }
-
-                    long bytesLeft = buf.st_size;
-                    while(bytesLeft > 0)
-                    {
-                        ByteSeq bytes(min(bytesLeft, 1024l*1024));
-                        if(
-#if defined(_MSC_VER)
-                            _read(fd, &bytes[0], static_cast<unsigned int>(bytes.size()))
-#else
-                            read(fd, &bytes[0], static_cast<unsigned int>(bytes.size()))
-#endif
-                            == -1)
-                        {
-                            if(doCompress)
-                            {
-                                fclose(stdioFile);
-                            }
-
-                            IceUtilInternal::close(fd);
-                            throw "cannot read from `" + path + "':\n" + IceUtilInternal::lastErrorToString();
-                        }
-                        bytesLeft -= static_cast<unsigned int>(bytes.size());
-                        if(doCompress)
-                        {
-                            BZ2_bzWrite(&bzError, bzFile, const_cast<Byte*>(&bytes[0]), static_cast<int>(bytes.size()));
-                            if(bzError != BZ_OK)
-                            {
-                                string ex = "BZ2_bzWrite failed";
-                                if(bzError == BZ_IO_ERROR)
-                                {
-                                    ex += string(": ") + IceUtilInternal::lastErrorToString();
-                                }
-                                BZ2_bzWriteClose(&bzError, bzFile, 0, 0, 0);
-                                fclose(stdioFile);
-                                IceUtilInternal::close(fd);
-                                throw ex;
-                            }
-                        }
-
-                        hasher.update(reinterpret_cast<IceUtil::Byte*>(&bytes[0]), bytes.size());
-                    }
-
-                    IceUtilInternal::close(fd);
-
-                    if(doCompress)
-                    {
-                        BZ2_bzWriteClose(&bzError, bzFile, 0, 0, 0);
-                        if(bzError != BZ_OK)
-                        {
-                            string ex = "BZ2_bzWriteClose failed";
-                            if(bzError == BZ_IO_ERROR)
-                            {
-                                ex += string(": ") + IceUtilInternal::lastErrorToString();
-                            }
-                            fclose(stdioFile);
-                            throw ex;
-                        }
-
-                        fclose(stdioFile);
-
-                        rename(pathBZ2Temp, pathBZ2);
-
-                        if(IceUtilInternal::stat(pathBZ2, &bufBZ2) == -1)
-                        {
-                            throw "cannot stat `" + pathBZ2 + "':\n" + IceUtilInternal::lastErrorToString();
-                        }
-
-                        info.size = bufBZ2.st_size;
-                    }
-                }
-                hasher.finalize(bytesSHA);
+                computeFileInfo(path, relPath, buf, doCompress, info);
             }
 
-            info.checksum.swap(bytesSHA);
-
             infoSeq.push_back(info);
         }
     }
@@ -1023,23 +1294,71 @@ IcePatch2Internal::GetFileInfoSeqCB::~GetFileInfoSeqCB()
 
 bool
 IcePatch2Internal::getFileInfoSeq(const string& basePath, int compress, GetFileInfoSeqCB* cb,
-                                  LargeFileInfoSeq& infoSeq)
+                                  LargeFileInfoSeq& infoSeq, int threads, ChecksumCache* cache)
 {
-    return getFileInfoSeqSubDir(basePath, ".", compress, cb, infoSeq);
+    return getFileInfoSeqSubDir(basePath, ".", compress, cb, infoSeq, threads, cache);
 }
 
 bool
 IcePatch2Internal::getFileInfoSeqSubDir(const string& basePa, const string& relPa, int compress, GetFileInfoSeqCB* cb,
-                                        LargeFileInfoSeq& infoSeq)
+                                        LargeFileInfoSeq& infoSeq, int threads, ChecksumCache* cache)
 {
     const string basePath = simplify(basePa);
     const string relPath = simplify(relPa);
+    const time_t start = time(0);
 
-    if(!getFileInfoSeqInternal(basePath, relPath, compress, cb, infoSeq))
+    //
+    // With a single thread and no cache, the checksums are computed
+    // while walking the directory, right after the callback. Otherwise
+    // they are computed once the walk completes.
+    //
+    vector<FileTask> tasks;
+    if(!getFileInfoSeqInternal(basePath, relPath, compress, cb, infoSeq, threads > 1 || cache ? &tasks : 0, cache))
     {
         return false;
     }
 
+    if(!tasks.empty())
+    {
+        FileTaskQueue queue(tasks, infoSeq);
+        vector<IceUtil::ThreadPtr> pool;
+        for(int i = 1; i < threads && static_cast<size_t>(i) < tasks.size(); ++i)
+        {
+            IceUtil::ThreadPtr thread = new FileTaskThread(queue);
+            thread->start();
+            pool.push_back(thread);
+        }
+        queue.run(); // The calling thread also computes checksums.
+        for(vector<IceUtil::ThreadPtr>::const_iterator p = pool.begin(); p != pool.end(); ++p)
+        {
+            (*p)->getThreadControl().join();
+        }
+        queue.checkError();
+
+        if(cache)
+        {
+            for(vector<FileTask>::const_iterator p = tasks.begin(); p != tasks.end(); ++p)
+            {
+                //
+                // Don't cache the checksum of a file modified after the
+                // walk started, it could be modified again within the
+                // same second without changing its modification time.
+                //
+                if(p->buf.st_mtime >= start)
+                {
+                    cache->erase(p->relPath);
+                    continue;
+                }
+
+                FileChecksum& checksum = (*cache)[p->relPath];
+                checksum.size = static_cast<Long>(p->buf.st_size);
+                checksum.mtime = static_cast<Long>(p->buf.st_mtime);
+                checksum.inode = static_cast<Long>(p->buf.st_ino);
+                checksum.checksum = infoSeq[p->index].checksum;
+            }
+        }
+    }
+
     sort(infoSeq.begin(), infoSeq.end(), FileInfoLess());
     infoSeq.erase(unique(infoSeq.begin(), infoSeq.end(), FileInfoEqual()), infoSeq.end());
 
@@ -1186,6 +1505,67 @@ IcePatch2Internal::loadFileInfoSeq(const string& pa, LargeFileInfoSeq& infoSeq)
     }
 }
 
+void
+IcePatch2Internal::saveChecksumCache(const string& pa, const ChecksumCache& cache)
+{
+    const string path = simplify(pa + '/' + checksumCacheFile);
+    FILE* fp = IceUtilInternal::fopen(path, "w");
+    if(!fp)
+    {
+        throw "cannot open `" + path + "' for writing:\n" + IceUtilInternal::lastErrorToString();
+    }
+    for(ChecksumCache::const_iterator p = cache.begin(); p != cache.end(); ++p)
+    {
+        if(fprintf(fp, "%s\t%s\t" ICE_INT64_FORMAT "\t" ICE_INT64_FORMAT "\t" ICE_INT64_FORMAT "\n",
+                   escapeString(p->first, "", IceUtilInternal::Compat).c_str(),
+                   bytesToString(p->second.checksum).c_str(),
+                   p->second.size,
+                   p->second.mtime,
+                   p->second.inode) <= 0)
+        {
+            fclose(fp);
+            throw "error writing `" + path + "':\n" + IceUtilInternal::lastErrorToString();
+        }
+    }
+    fclose(fp);
+}
+
+void
+IcePatch2Internal::loadChecksumCache(const string& pa, ChecksumCache& cache)
+{
+    //
+    // The cache is optional, a missing or unreadable cache file just
+    // means that all the checksums are computed again.
+    //
+    const string path = simplify(pa + '/' + checksumCacheFile);
+    ifstream is(IceUtilInternal::streamFilename(path).c_str());
+    string line;
+    while(getline(is, line))
+    {
+        istringstream ls(line);
+        string escapedPath;
+        string checksum;
+        FileChecksum entry;
+        if(!getline(ls, escapedPath, '\t') || !getline(ls, checksum, '\t') ||
+           !(ls >> entry.size >> entry.mtime >> entry.inode))
+        {
+            cache.clear();
+            return;
+        }
+
+        try
+        {
+            entry.checksum = stringToBytes(checksum);
+            cache[IceUtilInternal::unescapeString(escapedPath, 0, escapedPath.size(), "")] = entry;
+        }
+        catch(const IceUtil::IllegalArgumentException&)
+        {
+            cache.clear();
+            return;
+        }
+    }
+}
+
 void
 IcePatch2Internal::getFileTree0(const LargeFileInfoSeq& infoSeq, FileTree0& tree0)
 {
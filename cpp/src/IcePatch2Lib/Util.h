@@ -19,6 +19,7 @@ namespace IcePatch2Internal
 
 ICEPATCH2_API extern const char* checksumFile;
 ICEPATCH2_API extern const char* logFile;
+ICEPATCH2_API extern const char* checksumCacheFile;
 
 ICEPATCH2_API std::string lastError();
 
@@ -51,6 +52,14 @@ ICEPATCH2_API void decompressFile(const std::string&);
 
 ICEPATCH2_API void setFileFlags(const std::string&, const IcePatch2::LargeFileInfo&);
 
+//
+// Split the given file in content-defined chunks. The chunk
+// boundaries only depend on the contents preceding them, so the
+// chunks of two versions of a file only differ around the
+// modifications.
+//
+ICEPATCH2_API void getChunkInfoSeq(const std::string&, IcePatch2::ChunkInfoSeq&);
+
 struct FileInfoEqual : public std::binary_function<const IcePatch2::LargeFileInfo&, const IcePatch2::LargeFileInfo&, bool>
 {
     bool
@@ -163,9 +172,33 @@ public:
     virtual bool compress(const std::string&) = 0;
 };
 
-ICEPATCH2_API bool getFileInfoSeq(const std::string&, int, GetFileInfoSeqCB*, IcePatch2::LargeFileInfoSeq&);
+//
+// The checksums computed by getFileInfoSeq(), keyed by path. A cached
+// checksum is reused as long as the size, modification time and inode
+// of the file don't change.
+//
+struct FileChecksum
+{
+    Ice::Long size;
+    Ice::Long mtime;
+    Ice::Long inode;
+    Ice::ByteSeq checksum;
+};
+typedef std::map<std::string, FileChecksum> ChecksumCache;
+
+ICEPATCH2_API void saveChecksumCache(const std::string&, const ChecksumCache&);
+ICEPATCH2_API void loadChecksumCache(const std::string&, ChecksumCache&);
+
+//
+// The checksums are computed by the given number of threads. If a
+// cache is provided, unchanged files aren't read again and the cache
+// is updated with the new checksums.
+//
+ICEPATCH2_API bool getFileInfoSeq(const std::string&, int, GetFileInfoSeqCB*, IcePatch2::LargeFileInfoSeq&,
+                                  int = 1, ChecksumCache* = 0);
 
-ICEPATCH2_API bool getFileInfoSeqSubDir(const std::string&, const std::string&, int, GetFileInfoSeqCB*, IcePatch2::LargeFileInfoSeq&);
+ICEPATCH2_API bool getFileInfoSeqSubDir(const std::string&, const std::string&, int, GetFileInfoSeqCB*,
+                                        IcePatch2::LargeFileInfoSeq&, int = 1, ChecksumCache* = 0);
 
 ICEPATCH2_API void saveFileInfoSeq(const std::string&, const IcePatch2::LargeFileInfoSeq&);
 
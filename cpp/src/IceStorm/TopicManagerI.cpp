@@ -285,13 +285,17 @@ TopicManagerImpl::TopicManagerImpl(const PersistentInstancePtr& instance) :
             _instance->lluMap().put(txn, lluDbKey, empty);
 
 
-            // Recreate each of the topics.
+            // Recreate each of the topics. The records are only
+            // unmarshaled if they are subscriber records, the topic
+            // place holder records only need their key.
             SubscriberRecordKey k;
-            SubscriberRecord v;
+            IceDB::View<SubscriberRecordKey, IceDB::IceContext, Ice::OutputStream> kv;
+            IceDB::View<SubscriberRecord, IceDB::IceContext, Ice::OutputStream> v;
 
             SubscriberMapRWCursor cursor(_subscriberMap, txn);
-            if(cursor.get(k, v, MDB_FIRST))
+            if(cursor.get(kv, v, MDB_FIRST))
             {
+                kv.read(k);
                 bool moreTopics = false;
                 do
                 {
@@ -301,11 +305,16 @@ TopicManagerImpl::TopicManagerImpl(const PersistentInstancePtr& instance) :
 
                     Ice::Identity topic = k.topic;
 
-                    bool moreTopics;
                     SubscriberRecordSeq content;
-                    while((moreTopics = cursor.get(k, v, MDB_NEXT)) && k.topic == topic)
+                    while((moreTopics = cursor.get(kv, v, MDB_NEXT)))
                     {
-                        content.push_back(v);
+                        kv.read(k);
+                        if(k.topic != topic)
+                        {
+                            break;
+                        }
+                        content.push_back(SubscriberRecord());
+                        v.read(content.back());
                     }
 
                     string name = identityToTopicName(topic);
@@ -318,6 +318,12 @@ CallbackI::initiateCallbackWithPayload_async(const AMD_Callback_initiateCallback
         newCookie(cb));
 }
 
+Ice::ByteSeq
+CallbackI::echo(const Ice::ByteSeq& payload, const Ice::Current&)
+{
+    return payload;
+}
+
 void
 CallbackI::shutdown(const Ice::Current& current)
 {
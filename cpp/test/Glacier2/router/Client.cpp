@@ -692,6 +692,31 @@ CallbackClient::run(int argc, char* argv[])
         cout << "ok" << endl;
     }
 
+    {
+        //
+        // Glacier2 forwards the reply message of the server as is, only
+        // the request ID and the compression status are rewritten.
+        //
+        cout << "testing forwarded replies... " << flush;
+        const int sizes[] = { 0, 1, 1024, 64 * 1024, 512 * 1024 };
+        for(size_t i = 0; i < sizeof(sizes) / sizeof(int); ++i)
+        {
+            ByteSeq payload(sizes[i]);
+            for(size_t j = 0; j < payload.size(); ++j)
+            {
+                payload[j] = static_cast<Byte>(j % 251);
+            }
+
+            test(twoway->echo(payload) == payload);
+
+            Context context;
+            context["_fwd"] = "z";
+            test(twoway->echo(payload, context) == payload);
+            test(CallbackPrx::uncheckedCast(twoway->ice_compress(true))->echo(payload, context) == payload);
+        }
+        cout << "ok" << endl;
+    }
+
     {
         cout << "trying twoway callback with fake category... " << flush;
         Context context;
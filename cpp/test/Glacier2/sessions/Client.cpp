@@ -0,0 +1,120 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <IceUtil/Time.h>
+#include <Ice/Application.h>
+#include <Glacier2/Router.h>
+#include <Backend.h>
+#include <TestCommon.h>
+
+using namespace std;
+using namespace Ice;
+using namespace Test;
+
+//
+// Simulates many sessions, each with its own connection to the router,
+// issuing requests concurrently and reports the routing throughput.
+// The number of sessions and requests can be set with the Test.Sessions
+// and Test.Requests properties.
+//
+class SessionsClient : public Application
+{
+public:
+
+    virtual int run(int, char*[]);
+};
+
+int
+main(int argc, char* argv[])
+{
+#ifdef ICE_STATIC_LIBS
+    Ice::registerIceSSL();
+#endif
+
+    SessionsClient app;
+    return app.main(argc, argv);
+}
+
+int
+SessionsClient::run(int, char**)
+{
+    PropertiesPtr properties = communicator()->getProperties();
+    const int sessionCount = properties->getPropertyAsIntWithDefault("Test.Sessions", 100);
+    const int requestCount = properties->getPropertyAsIntWithDefault("Test.Requests", 100);
+
+    ObjectPrx routerBase = communicator()->stringToProxy("Glacier2/router:default -p 12347");
+    ObjectPrx backendBase = communicator()->stringToProxy("backend:tcp -p 12010");
+
+    cout << "creating " << sessionCount << " sessions... " << flush;
+    vector<Glacier2::RouterPrx> routers;
+    vector<BackendPrx> backends;
+    for(int i = 0; i < sessionCount; ++i)
+    {
+        //
+        // Each session uses its own connection to the router.
+        //
+        ostringstream connectionId;
+        connectionId << "session-" << i;
+        Glacier2::RouterPrx router =
+            Glacier2::RouterPrx::uncheckedCast(routerBase->ice_connectionId(connectionId.str()));
+        router->createSession("userid", "abc123");
+        routers.push_back(router);
+        backends.push_back(BackendPrx::uncheckedCast(
+                               backendBase->ice_router(router)->ice_connectionId(connectionId.str())));
+    }
+    for(vector<BackendPrx>::const_iterator p = backends.begin(); p != backends.end(); ++p)
+    {
+        (*p)->ice_ping();
+    }
+    cout << "ok" << endl;
+
+    cout << "sending " << requestCount << " requests per session... " << flush;
+    IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    for(int i = 0; i < requestCount; ++i)
+    {
+        vector<AsyncResultPtr> results;
+        results.reserve(backends.size());
+        for(vector<BackendPrx>::const_iterator p = backends.begin(); p != backends.end(); ++p)
+        {
+            results.push_back((*p)->begin_ice_ping());
+        }
+        for(vector<AsyncResultPtr>::const_iterator q = results.begin(); q != results.end(); ++q)
+        {
+            (*q)->getProxy()->end_ice_ping(*q);
+        }
+    }
+    IceUtil::Time elapsed = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+    cout << "ok (" << static_cast<Ice::Long>(sessionCount * requestCount / elapsed.toSecondsDouble())
+         << " requests/s)" << endl;
+
+    cout << "destroying sessions... " << flush;
+    for(vector<Glacier2::RouterPrx>::const_iterator p = routers.begin(); p != routers.end(); ++p)
+    {
+        (*p)->destroySession();
+    }
+    cout << "ok" << endl;
+
+    cout << "testing server and router shutdown... " << flush;
+    BackendPrx::uncheckedCast(backendBase)->shutdown();
+    ObjectPrx adminBase = communicator()->stringToProxy("Glacier2/admin -f Process:tcp -h 127.0.0.1 -p 12348");
+    Ice::ProcessPrx process = Ice::ProcessPrx::checkedCast(adminBase);
+    test(process);
+    process->shutdown();
+    try
+    {
+        process->ice_ping();
+        test(false);
+    }
+    catch(const Ice::LocalException&)
+    {
+        cout << "ok" << endl;
+    }
+
+    return EXIT_SUCCESS;
+}
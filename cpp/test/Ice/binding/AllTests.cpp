@@ -64,6 +64,97 @@ private:
 typedef IceUtil::Handle<GetAdapterNameCB> GetAdapterNameCBPtr;
 #endif
 
+//
+// Counts the host lookups traced by the endpoint host resolver.
+//
+class ResolverLoggerI : public Ice::Logger,
+                        private IceUtil::Mutex
+#ifdef ICE_CPP11_MAPPING
+                      , public std::enable_shared_from_this<ResolverLoggerI>
+#endif
+{
+public:
+
+    ResolverLoggerI() : _lookups(0)
+    {
+    }
+
+    virtual void
+    print(const string&)
+    {
+    }
+
+    virtual void
+    trace(const string&, const string& message)
+    {
+        Lock sync(*this);
+        if(message.find("resolved host `localhost'") != string::npos)
+        {
+            ++_lookups;
+        }
+    }
+
+    virtual void
+    warning(const string&)
+    {
+    }
+
+    virtual void
+    error(const string&)
+    {
+    }
+
+    virtual string
+    getPrefix()
+    {
+        return "";
+    }
+
+    virtual Ice::LoggerPtr
+    cloneWithPrefix(const string&)
+    {
+        return ICE_SHARED_FROM_THIS;
+    }
+
+    int
+    getLookups()
+    {
+        Lock sync(*this);
+        return _lookups;
+    }
+
+private:
+
+    int _lookups;
+};
+ICE_DEFINE_PTR(ResolverLoggerIPtr, ResolverLoggerI);
+
+void
+pingConcurrently(const vector<TestIntfPrxPtr>& proxies)
+{
+#ifdef ICE_CPP11_MAPPING
+    vector<future<void>> results;
+    for(vector<TestIntfPrxPtr>::const_iterator p = proxies.begin(); p != proxies.end(); ++p)
+    {
+        results.push_back((*p)->ice_pingAsync());
+    }
+    for(vector<future<void>>::iterator p = results.begin(); p != results.end(); ++p)
+    {
+        p->get();
+    }
+#else
+    vector<Ice::AsyncResultPtr> results;
+    for(vector<TestIntfPrxPtr>::const_iterator p = proxies.begin(); p != proxies.end(); ++p)
+    {
+        results.push_back((*p)->begin_ice_ping());
+    }
+    for(size_t i = 0; i < proxies.size(); ++i)
+    {
+        proxies[i]->end_ice_ping(results[i]);
+    }
+#endif
+}
+
 string
 getAdapterNameWithAMI(const TestIntfPrxPtr& test)
 {
@@ -548,6 +639,341 @@ allTests(const Ice::CommunicatorPtr& communicator)
     }
     cout << "ok" << endl;
 
+    cout << "testing parallel connection establishment... " << flush;
+    {
+        vector<RemoteObjectAdapterPrxPtr> adapters;
+        adapters.push_back(com->createObjectAdapter("Adapter37", "default"));
+        adapters.push_back(com->createObjectAdapter("Adapter38", "default"));
+        adapters.push_back(com->createObjectAdapter("Adapter39", "default"));
+
+        TestIntfPrxPtr test = createTestIntfPrx(adapters);
+        test = ICE_UNCHECKED_CAST(TestIntfPrx, test->ice_endpointSelection(Ice::Ordered)->ice_parallelConnect(true));
+        test(test->ice_isParallelConnect());
+
+        //
+        // The connection attempts to the deactivated adapters fail and
+        // the connection is established with the remaining adapter.
+        //
+        com->deactivateObjectAdapter(adapters[0]);
+        com->deactivateObjectAdapter(adapters[1]);
+        test(test->getAdapterName() == "Adapter39");
+        test(getAdapterNameWithAMI(test) == "Adapter39");
+        test->ice_getConnection()->close(false);
+
+        com->deactivateObjectAdapter(adapters[2]);
+        try
+        {
+            test->getAdapterName();
+            test(false);
+        }
+        catch(const Ice::ConnectFailedException&)
+        {
+        }
+    }
+    cout << "ok" << endl;
+
+    cout << "testing endpoint ejection... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.EndpointHealth.FailureThreshold", "1");
+        initData.properties->setProperty("Ice.EndpointHealth.EjectionTime", "1000");
+        Ice::CommunicatorPtr comm = Ice::initialize(initData);
+
+        vector<RemoteObjectAdapterPrxPtr> adapters;
+        adapters.push_back(com->createObjectAdapter("Adapter71", "default"));
+        adapters.push_back(com->createObjectAdapter("Adapter72", "default"));
+
+        TestIntfPrxPtr test = createTestIntfPrx(adapters);
+        test = ICE_UNCHECKED_CAST(TestIntfPrx, comm->stringToProxy(communicator->proxyToString(test)));
+        test = ICE_UNCHECKED_CAST(TestIntfPrx, test->ice_endpointSelection(Ice::Ordered));
+        Ice::EndpointSeq endpoints = test->ice_getEndpoints();
+
+        //
+        // The connection to the first endpoint fails, the endpoint is
+        // ejected and skipped until the ejection time expires.
+        //
+        com->deactivateObjectAdapter(adapters[0]);
+        test(test->getAdapterName() == "Adapter72");
+        adapters[0] = com->createObjectAdapter("Adapter73", endpoints[0]->toString());
+        test->ice_getConnection()->close(false);
+        test(test->getAdapterName() == "Adapter72");
+
+        //
+        // Once the ejection time expires, the next connection establishment
+        // probes the endpoint.
+        //
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(1100));
+        test->ice_getConnection()->close(false);
+        test(test->getAdapterName() == "Adapter73");
+
+        deactivate(com, adapters);
+        comm->destroy();
+    }
+    cout << "ok" << endl;
+
+    cout << "testing endpoint ejection on latency... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.EndpointHealth.LatencyThreshold", "50");
+        initData.properties->setProperty("Ice.EndpointHealth.EjectionTime", "1000");
+        initData.properties->setProperty("Ice.Admin.Enabled", "1");
+        initData.properties->setProperty("IceMX.Metrics.View.Map.EndpointHealth.GroupBy", "id");
+        Ice::CommunicatorPtr comm = Ice::initialize(initData);
+        IceMX::MetricsAdminPtr metrics = ICE_DYNAMIC_CAST(IceMX::MetricsAdmin, comm->findAdminFacet("Metrics"));
+        test(metrics);
+
+        vector<RemoteObjectAdapterPrxPtr> adapters;
+        adapters.push_back(com->createObjectAdapter("Adapter75", "default"));
+        adapters.push_back(com->createObjectAdapter("Adapter76", "default"));
+
+        TestIntfPrxPtr test = createTestIntfPrx(adapters);
+        test = ICE_UNCHECKED_CAST(TestIntfPrx, comm->stringToProxy(communicator->proxyToString(test)));
+        test = ICE_UNCHECKED_CAST(TestIntfPrx, test->ice_endpointSelection(Ice::Ordered));
+        test(test->getAdapterName() == "Adapter75");
+
+        //
+        // The replies of the first adapter are delayed while it's held,
+        // the average latency exceeds the threshold and the endpoint is
+        // ejected.
+        //
+        adapters[0]->hold();
+#ifdef ICE_CPP11_MAPPING
+        vector<future<string>> results;
+        for(int i = 0; i < 10; ++i)
+        {
+            results.push_back(test->getAdapterNameAsync());
+        }
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(200));
+        adapters[0]->activate();
+        for(vector<future<string>>::iterator p = results.begin(); p != results.end(); ++p)
+        {
+            test(p->get() == "Adapter75");
+        }
+#else
+        vector<Ice::AsyncResultPtr> results;
+        for(int i = 0; i < 10; ++i)
+        {
+            results.push_back(test->begin_getAdapterName());
+        }
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(200));
+        adapters[0]->activate();
+        for(vector<Ice::AsyncResultPtr>::const_iterator p = results.begin(); p != results.end(); ++p)
+        {
+            test(test->end_getAdapterName(*p) == "Adapter75");
+        }
+#endif
+
+        //
+        // New connections skip the ejected endpoint.
+        //
+        test(test->ice_connectionId("ejected")->getAdapterName() == "Adapter76");
+
+        Ice::Long timestamp;
+        IceMX::MetricsMap health = metrics->getMetricsView("View", timestamp, Ice::Current())["EndpointHealth"];
+        test(health.size() == 1);
+        test(health[0]->current == 1 && health[0]->total == 1 && health[0]->failures == 1);
+
+        //
+        // Once the ejection time expires, the endpoint is probed. The
+        // probe reuses the connection to the first adapter, its reply
+        // settles the probe and the endpoint is healthy again.
+        //
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(1100));
+        TestIntfPrxPtr uncached = ICE_UNCHECKED_CAST(TestIntfPrx, test->ice_connectionCached(false));
+        test(uncached->getAdapterName() == "Adapter75");
+        test(uncached->ice_getConnection() == test->ice_getConnection());
+        test(test->ice_connectionId("healthy")->getAdapterName() == "Adapter75");
+
+        health = metrics->getMetricsView("View", timestamp, Ice::Current())["EndpointHealth"];
+        test(health.size() == 1);
+        test(health[0]->current == 0 && health[0]->total == 1);
+
+        deactivate(com, adapters);
+        comm->destroy();
+    }
+    cout << "ok" << endl;
+
+    if(communicator->getProperties()->getPropertyAsIntWithDefault("Ice.IPv4", 1) > 0)
+    {
+        cout << "testing endpoint host resolver... " << flush;
+        {
+            RemoteObjectAdapterPrxPtr adapter = com->createObjectAdapter("Adapter74", "default");
+
+            //
+            // Use the localhost host name, the endpoint host resolver
+            // resolves it.
+            //
+            string endpoint = adapter->getTestIntf()->ice_getEndpoints()[0]->toString();
+            string::size_type pos = endpoint.find("-h ");
+            test(pos != string::npos);
+            string::size_type end = endpoint.find(' ', pos + 3);
+            endpoint = endpoint.substr(0, pos) + "-h localhost" + (end == string::npos ? "" : endpoint.substr(end));
+
+            //
+            // Without cache, each connection establishment resolves the
+            // host.
+            //
+            {
+                Ice::InitializationData initData;
+                initData.properties = communicator->getProperties()->clone();
+                initData.properties->setProperty("Ice.Trace.Network", "2");
+                ResolverLoggerIPtr logger = ICE_MAKE_SHARED(ResolverLoggerI);
+                initData.logger = logger;
+                Ice::CommunicatorPtr comm = Ice::initialize(initData);
+
+                TestIntfPrxPtr prx = ICE_UNCHECKED_CAST(TestIntfPrx, comm->stringToProxy("test:" + endpoint));
+                prx->ice_ping();
+                test(logger->getLookups() == 1);
+                prx->ice_getConnection()->close(false);
+                prx->ice_ping();
+                test(logger->getLookups() == 2);
+                comm->destroy();
+            }
+
+            //
+            // With cache, concurrent connection establishments wait for
+            // the pending lookup and later ones use the cached addresses.
+            //
+            {
+                Ice::InitializationData initData;
+                initData.properties = communicator->getProperties()->clone();
+                initData.properties->setProperty("Ice.Trace.Network", "2");
+                initData.properties->setProperty("Ice.HostResolver.CacheTimeout", "60");
+                ResolverLoggerIPtr logger = ICE_MAKE_SHARED(ResolverLoggerI);
+                initData.logger = logger;
+                Ice::CommunicatorPtr comm = Ice::initialize(initData);
+
+                vector<TestIntfPrxPtr> proxies;
+                for(int i = 0; i < 10; ++i)
+                {
+                    ostringstream id;
+                    id << "connection" << i;
+                    proxies.push_back(ICE_UNCHECKED_CAST(TestIntfPrx,
+                                        comm->stringToProxy("test:" + endpoint)->ice_connectionId(id.str())));
+                }
+                pingConcurrently(proxies);
+                test(logger->getLookups() == 1);
+
+                for(vector<TestIntfPrxPtr>::const_iterator p = proxies.begin(); p != proxies.end(); ++p)
+                {
+                    (*p)->ice_getConnection()->close(false);
+                }
+                pingConcurrently(proxies);
+                test(logger->getLookups() == 1);
+                comm->destroy();
+            }
+
+            com->deactivateObjectAdapter(adapter);
+        }
+        cout << "ok" << endl;
+    }
+
+    cout << "testing connection pools... " << flush;
+    {
+        RemoteObjectAdapterPrxPtr adapter = com->createObjectAdapter("Adapter40", "default");
+        TestIntfPrxPtr test = ICE_UNCHECKED_CAST(TestIntfPrx, adapter->getTestIntf()->ice_connectionPoolSize(3));
+        test(test->ice_getConnectionPoolSize() == 3);
+
+        Ice::ConnectionPtr connection = test->ice_getConnection();
+        for(int i = 0; i < 10; ++i)
+        {
+            test(test->getAdapterName() == "Adapter40");
+            test(getAdapterNameWithAMI(test) == "Adapter40");
+        }
+
+        //
+        // ice_getConnection always returns the first connection of the pool.
+        //
+        test(test->ice_getConnection() == connection);
+
+        //
+        // Payloads larger than the grow threshold queue up on the first
+        // connection, the pool then grows and the payloads are striped
+        // over several connections. The pool isn't released between two
+        // rounds, only once it has been idle for the idle timeout.
+        //
+        Ice::ByteSeq seq(256 * 1024);
+        set<string> connections;
+        for(int i = 0; i < 10 && connections.size() < 2; ++i)
+        {
+#ifdef ICE_CPP11_MAPPING
+            vector<future<string>> results;
+            for(int j = 0; j < 20; ++j)
+            {
+                results.push_back(test->opWithPayloadAsync(seq));
+            }
+            for(vector<future<string>>::iterator p = results.begin(); p != results.end(); ++p)
+            {
+                connections.insert(p->get());
+            }
+#else
+            vector<Ice::AsyncResultPtr> results;
+            for(int j = 0; j < 20; ++j)
+            {
+                results.push_back(test->begin_opWithPayload(seq));
+            }
+            for(vector<Ice::AsyncResultPtr>::const_iterator p = results.begin(); p != results.end(); ++p)
+            {
+                connections.insert(test->end_opWithPayload(*p));
+            }
+#endif
+        }
+        test(connections.size() > 1 && connections.size() <= 3);
+
+        com->deactivateObjectAdapter(adapter);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing request hedging... " << flush;
+    {
+        vector<RemoteObjectAdapterPrxPtr> adapters;
+        adapters.push_back(com->createObjectAdapter("Adapter42", "default"));
+        adapters.push_back(com->createObjectAdapter("Adapter43", "default"));
+
+        TestIntfPrxPtr test = createTestIntfPrx(adapters);
+        test = ICE_UNCHECKED_CAST(TestIntfPrx, test->ice_endpointSelection(Ice::Ordered)->ice_hedging(true));
+        test(test->ice_isHedging());
+
+        //
+        // Requests aren't hedged until the proxy has enough latencies to
+        // compute the hedging delay and enough tokens for a duplicate.
+        //
+        for(int i = 0; i < 20; ++i)
+        {
+            test(test->getAdapterNameIdempotent() == "Adapter42");
+        }
+
+        //
+        // The first adapter doesn't dispatch the request while it's held,
+        // the duplicate sent to the second endpoint provides the reply.
+        //
+        adapters[0]->hold();
+        test(test->getAdapterNameIdempotent() == "Adapter43");
+        adapters[0]->activate();
+
+        //
+        // Non-idempotent requests aren't hedged.
+        //
+        adapters[0]->hold();
+#ifdef ICE_CPP11_MAPPING
+        auto f = test->getAdapterNameAsync();
+        test(f.wait_for(chrono::milliseconds(200)) == future_status::timeout);
+        adapters[0]->activate();
+        test(f.get() == "Adapter42");
+#else
+        Ice::AsyncResultPtr r = test->begin_getAdapterName();
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(200));
+        test(!r->isCompleted());
+        adapters[0]->activate();
+        test(test->end_getAdapterName(r) == "Adapter42");
+#endif
+
+        deactivate(com, adapters);
+    }
+    cout << "ok" << endl;
+
     cout << "testing per request binding with single endpoint... " << flush;
     {
         RemoteObjectAdapterPrxPtr adapter = com->createObjectAdapter("Adapter41", "default");
@@ -843,7 +1269,7 @@ allTests(const Ice::CommunicatorPtr& communicator)
             for(i = 0; i < 5; i++)
             {
                 test(test->getAdapterName() == "Adapter82");
-                test->ice_getConnection()->close(false);
+                prx->ice_getConnection()->close(false);
             }
 
             TestIntfPrxPtr testSecure = ICE_UNCHECKED_CAST(TestIntfPrx, test->ice_secure(true));
@@ -859,7 +1285,7 @@ allTests(const Ice::CommunicatorPtr& communicator)
             for(i = 0; i < 5; i++)
             {
                 test(test->getAdapterName() == "Adapter81");
-                test->ice_getConnection()->close(false);
+                prx->ice_getConnection()->close(false);
             }
 
             com->createObjectAdapter("Adapter83", (test->ice_getEndpoints()[1])->toString()); // Reactive tcp OA.
@@ -867,7 +1293,7 @@ allTests(const Ice::CommunicatorPtr& communicator)
             for(i = 0; i < 5; i++)
             {
                 test(test->getAdapterName() == "Adapter83");
-                test->ice_getConnection()->close(false);
+                prx->ice_getConnection()->close(false);
             }
 
             com->deactivateObjectAdapter(adapters[0]);
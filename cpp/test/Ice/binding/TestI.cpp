@@ -7,6 +7,7 @@
 //
 // **********************************************************************
 
+#include <IceUtil/IceUtil.h>
 #include <Ice/Ice.h>
 #include <TestI.h>
 
@@ -80,6 +81,19 @@ RemoteObjectAdapterI::getTestIntf(const Ice::Current&)
     return _testIntf;
 }
 
+void
+RemoteObjectAdapterI::hold(const Ice::Current&)
+{
+    _adapter->hold();
+    _adapter->waitForHold();
+}
+
+void
+RemoteObjectAdapterI::activate(const Ice::Current&)
+{
+    _adapter->activate();
+}
+
 void
 RemoteObjectAdapterI::deactivate(const Ice::Current& current)
 {
@@ -98,3 +112,19 @@ TestI::getAdapterName(const Ice::Current& current)
     return current.adapter->getName();
 }
 
+std::string
+TestI::opWithPayload(ICE_IN(Ice::ByteSeq), const Ice::Current& current)
+{
+    //
+    // Process the payloads slowly, so that they queue up on the client
+    // connections.
+    //
+    IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(20));
+    return current.con->toString();
+}
+
+std::string
+TestI::getAdapterNameIdempotent(const Ice::Current& current)
+{
+    return current.adapter->getName();
+}
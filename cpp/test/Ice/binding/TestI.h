@@ -40,6 +40,8 @@ public:
     RemoteObjectAdapterI(const Ice::ObjectAdapterPtr&);
     
     virtual Test::TestIntfPrxPtr getTestIntf(const Ice::Current&);
+    virtual void hold(const Ice::Current&);
+    virtual void activate(const Ice::Current&);
     virtual void deactivate(const Ice::Current&);
 
 private:
@@ -53,6 +55,8 @@ class TestI : public Test::TestIntf
 public:
 
     virtual std::string getAdapterName(const Ice::Current&);
+    virtual std::string opWithPayload(ICE_IN(Ice::ByteSeq), const Ice::Current&);
+    virtual std::string getAdapterNameIdempotent(const Ice::Current&);
 };
 
 #endif
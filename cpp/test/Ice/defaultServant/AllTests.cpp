@@ -7,6 +7,7 @@
 //
 // **********************************************************************
 
+#include <IceUtil/IceUtil.h>
 #include <Ice/Ice.h>
 #include <TestCommon.h>
 #include <TestI.h>
@@ -14,8 +15,103 @@
 using namespace std;
 using namespace Test;
 
+namespace
+{
+
+Ice::Identity
+servantIdentity(int i)
+{
+    ostringstream os;
+    os << i;
+    Ice::Identity ident;
+    ident.name = os.str();
+    ident.category = i % 2 ? "odd" : "";
+    return ident;
+}
+
+//
+// The servant manager is internal to the Ice library, the lookups go
+// through ObjectAdapter::find which also locks the adapter mutex to
+// check for deactivation. The dispatch path calls the servant manager
+// directly and doesn't take that lock.
+//
+class FindThread : public IceUtil::Thread
+{
+public:
+
+    FindThread(const Ice::ObjectAdapterPtr& adapter, const vector<Ice::Identity>& ids, int lookups, size_t first) :
+        _adapter(adapter), _ids(ids), _lookups(lookups), _first(first)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        size_t j = _first;
+        for(int i = 0; i < _lookups; ++i)
+        {
+            test(_adapter->find(_ids[j]));
+            j = (j + 7919) % _ids.size();
+        }
+    }
+
+private:
+
+    const Ice::ObjectAdapterPtr _adapter;
+    const vector<Ice::Identity>& _ids;
+    const int _lookups;
+    const size_t _first;
+};
+
 void
-allTests(const Ice::CommunicatorPtr& communicator)
+benchmark(const Ice::CommunicatorPtr& communicator)
+{
+    const int count = 1000000;
+    const int lookups = 1000000;
+    const int threads[] = { 1, 8, 32 };
+
+    Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("");
+    Ice::ObjectPtr servant = ICE_MAKE_SHARED(MyObjectI);
+
+    vector<Ice::Identity> ids;
+    ids.reserve(count);
+    IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    for(int i = 0; i < count; ++i)
+    {
+        ids.push_back(servantIdentity(i));
+        adapter->add(servant, ids.back());
+    }
+    IceUtil::Time addTime = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+    cout << "  " << count << " servants: " << addTime.toMicroSecondsDouble() / count << " us/add" << endl;
+
+    for(size_t i = 0; i < sizeof(threads) / sizeof(int); ++i)
+    {
+        vector<IceUtil::ThreadControl> controls;
+        start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        for(int j = 0; j < threads[i]; ++j)
+        {
+            IceUtil::ThreadPtr thread = new FindThread(adapter, ids, lookups, j * (count / threads[i]));
+            controls.push_back(thread->start());
+        }
+        for(vector<IceUtil::ThreadControl>::iterator p = controls.begin(); p != controls.end(); ++p)
+        {
+            p->join();
+        }
+        IceUtil::Time findTime = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+
+        const double total = static_cast<double>(threads[i]) * lookups;
+        cout << "  " << threads[i] << " threads: "
+             << total / max<double>(findTime.toMicroSecondsDouble(), 1) << " M lookups/s, "
+             << findTime.toMicroSecondsDouble() * threads[i] / total << " us/lookup" << endl;
+    }
+
+    adapter->destroy();
+}
+
+}
+
+void
+allTests(const Ice::CommunicatorPtr& communicator, bool verbose)
 {
     Ice::ObjectAdapterPtr oa = communicator->createObjectAdapterWithEndpoints("MyOA", "tcp -h localhost");
     oa->activate();
@@ -157,4 +253,72 @@ allTests(const Ice::CommunicatorPtr& communicator)
     }
 
     cout << "ok" << endl;
+
+    cout << "testing active servant map... " << flush;
+    {
+        Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("");
+
+        const int count = 10000;
+        for(int i = 0; i < count; ++i)
+        {
+            adapter->add(servant, servantIdentity(i));
+            if(i % 10 == 0)
+            {
+                adapter->addFacet(servant, servantIdentity(i), "facet");
+            }
+        }
+
+        try
+        {
+            adapter->add(servant, servantIdentity(count / 2));
+            test(false);
+        }
+        catch(const Ice::AlreadyRegisteredException&)
+        {
+            // Expected
+        }
+
+        for(int i = 0; i < count; ++i)
+        {
+            test(adapter->find(servantIdentity(i)) == servant);
+            test((adapter->findFacet(servantIdentity(i), "facet") == servant) == (i % 10 == 0));
+            test(adapter->findAllFacets(servantIdentity(i)).size() == (i % 10 == 0 ? 2U : 1U));
+        }
+
+        for(int i = 0; i < count; ++i)
+        {
+            if(i % 10 == 0)
+            {
+                test(adapter->removeAllFacets(servantIdentity(i)).size() == 2);
+            }
+            else if(i % 2)
+            {
+                test(adapter->remove(servantIdentity(i)) == servant);
+            }
+        }
+
+        try
+        {
+            adapter->remove(servantIdentity(1));
+            test(false);
+        }
+        catch(const Ice::NotRegisteredException&)
+        {
+            // Expected
+        }
+
+        for(int i = 0; i < count; ++i)
+        {
+            test((adapter->find(servantIdentity(i)) == servant) == (i % 2 == 0 && i % 10 != 0));
+        }
+
+        adapter->destroy();
+    }
+    cout << "ok" << endl;
+
+    if(verbose)
+    {
+        cout << "measuring ObjectAdapter::find throughput, including the adapter mutex..." << endl;
+        benchmark(communicator);
+    }
 }
@@ -17,10 +17,23 @@ using namespace Test;
 DEFINE_TEST("client")
 
 int
-run(int, char**, const Ice::CommunicatorPtr& communicator)
+run(int argc, char** argv, const Ice::CommunicatorPtr& communicator)
 {
-    void allTests(const Ice::CommunicatorPtr&);
-    allTests(communicator);
+    //
+    // With -v, the client also measures the active servant map lookup
+    // throughput with 1M servants.
+    //
+    bool verbose = false;
+    for(int i = 1; i < argc; ++i)
+    {
+        if(string(argv[i]) == "-v")
+        {
+            verbose = true;
+        }
+    }
+
+    void allTests(const Ice::CommunicatorPtr&, bool);
+    allTests(communicator, verbose);
     return EXIT_SUCCESS;
 }
 
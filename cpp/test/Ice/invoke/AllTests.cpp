@@ -284,6 +284,51 @@ private:
 typedef IceUtil::Handle<Callback> CallbackPtr;
 #endif
 
+class BroadcastReceiverI : public Ice::Blobject, public IceUtil::Monitor<IceUtil::Mutex>
+{
+public:
+
+    BroadcastReceiverI(const Ice::CommunicatorPtr& communicator) :
+        _communicator(communicator),
+        _count(0)
+    {
+    }
+
+    virtual bool ice_invoke(const vector<Ice::Byte>& inEncaps, vector<Ice::Byte>&, const Ice::Current& current)
+    {
+        test(current.operation == "opString");
+        test(current.requestId == 0);
+
+        Ice::InputStream in(_communicator, inEncaps);
+        in.startEncapsulation();
+        string s;
+        in.read(s);
+        test(s == testString);
+        in.endEncapsulation();
+
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+        ++_count;
+        notifyAll();
+        return true;
+    }
+
+    void waitForCount(int count)
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+        while(_count < count)
+        {
+            wait();
+        }
+        test(_count == count);
+    }
+
+private:
+
+    const Ice::CommunicatorPtr _communicator;
+    int _count;
+};
+ICE_DEFINE_PTR(BroadcastReceiverIPtr, BroadcastReceiverI);
+
 Test::MyClassPrxPtr
 allTests(const Ice::CommunicatorPtr& communicator)
 {
@@ -784,5 +829,54 @@ allTests(const Ice::CommunicatorPtr& communicator)
     }
 #endif
     cout << "ok" << endl;
+
+    cout << "testing connection group broadcast... " << flush;
+    {
+        Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapterWithEndpoints("BroadcastAdapter", "default");
+        BroadcastReceiverIPtr receiver = ICE_MAKE_SHARED(BroadcastReceiverI, communicator);
+        Ice::ObjectPrxPtr prx = adapter->add(receiver, Ice::stringToIdentity("receiver"));
+        prx = prx->ice_collocationOptimized(false);
+        adapter->activate();
+
+        vector<Ice::ConnectionPtr> connections;
+        Ice::ConnectionGroupPtr group = ICE_MAKE_SHARED(Ice::ConnectionGroup, communicator);
+        for(int i = 0; i < 3; ++i)
+        {
+            ostringstream os;
+            os << "connection" << i;
+            connections.push_back(prx->ice_connectionId(os.str())->ice_getConnection());
+            group->add(connections.back());
+        }
+        group->add(connections[0]);
+        test(group->size() == 3);
+
+        Ice::OutputStream out(communicator);
+        out.startEncapsulation();
+        out.write(testString);
+        out.endEncapsulation();
+        Ice::ByteSeq inEncaps;
+        out.finished(inEncaps);
+
+        Ice::Identity id = Ice::stringToIdentity("receiver");
+        test(group->broadcast(id, "", "opString", ICE_ENUM(OperationMode, Normal), inEncaps) == 3);
+        receiver->waitForCount(3);
+
+        //
+        // Closed connections are removed from the group.
+        //
+        connections[0]->close(false);
+        test(group->broadcast(id, "", "opString", ICE_ENUM(OperationMode, Normal), inEncaps) == 2);
+        test(group->size() == 2);
+        receiver->waitForCount(5);
+
+        group->remove(connections[1]);
+        test(group->size() == 1);
+        test(group->broadcast(id, "", "opString", ICE_ENUM(OperationMode, Normal), inEncaps) == 1);
+        receiver->waitForCount(6);
+
+        adapter->destroy();
+    }
+    cout << "ok" << endl;
+
     return cl;
 }
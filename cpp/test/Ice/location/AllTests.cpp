@@ -627,6 +627,117 @@ allTests(const Ice::CommunicatorPtr& communicator, const string& ref)
     }
     cout << "ok" << endl;
 
+    cout << "testing locator cache refresh ahead... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.LocatorCacheRefreshAhead", "50");
+        Ice::CommunicatorPtr ic = Ice::initialize(initData);
+
+        int count = locator->getRequestCount();
+        ic->stringToProxy("test@TestAdapter")->ice_locatorCacheTimeout(2)->ice_ping(); // 2s timeout.
+        test(++count == locator->getRequestCount());
+        ic->stringToProxy("test@TestAdapter")->ice_locatorCacheTimeout(2)->ice_ping(); // 2s timeout.
+        test(count == locator->getRequestCount());
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(1300));
+
+        // The entry is older than half of its timeout, the following request uses the cached
+        // endpoints and triggers a background update.
+        ic->stringToProxy("test@TestAdapter")->ice_locatorCacheTimeout(2)->ice_ping(); // 2s timeout.
+        int nRetry = 100;
+        while(locator->getRequestCount() == count && --nRetry > 0)
+        {
+            IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+        }
+        test(++count == locator->getRequestCount());
+
+        // The background update is only triggered once.
+        ic->stringToProxy("test@TestAdapter")->ice_locatorCacheTimeout(2)->ice_ping(); // 2s timeout.
+        test(count == locator->getRequestCount());
+        ic->destroy();
+    }
+    cout << "ok" << endl;
+
+    cout << "testing locator cache jitter... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.LocatorCacheJitter", "50");
+        Ice::CommunicatorPtr ic = Ice::initialize(initData);
+
+        const int nAdapters = 20;
+        for(int i = 0; i < nAdapters; ++i)
+        {
+            ostringstream id;
+            id << "JitterAdapter" << i;
+            registry->setAdapterDirectProxy(id.str(), locator->findAdapterById("TestAdapter"));
+        }
+
+        int count = locator->getRequestCount();
+        for(int i = 0; i < nAdapters; ++i)
+        {
+            ostringstream id;
+            id << "test@JitterAdapter" << i;
+            ic->stringToProxy(id.str())->ice_locatorCacheTimeout(2)->ice_ping(); // 2s timeout.
+        }
+        count += nAdapters;
+        test(count == locator->getRequestCount());
+
+        //
+        // The entries expire between 1s and 2s after they were added,
+        // some of them expired after 1.5s but not all of them.
+        //
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(1500));
+        for(int i = 0; i < nAdapters; ++i)
+        {
+            ostringstream id;
+            id << "test@JitterAdapter" << i;
+            ic->stringToProxy(id.str())->ice_locatorCacheTimeout(2)->ice_ping(); // 2s timeout.
+        }
+        test(locator->getRequestCount() > count && locator->getRequestCount() < count + nAdapters);
+
+        for(int i = 0; i < nAdapters; ++i)
+        {
+            ostringstream id;
+            id << "JitterAdapter" << i;
+            registry->setAdapterDirectProxy(id.str(), 0);
+        }
+        ic->destroy();
+    }
+    cout << "ok" << endl;
+
+    cout << "testing locator cache metrics... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.LocatorCacheRefreshAhead", "50");
+        initData.properties->setProperty("Ice.Admin.Enabled", "1");
+        initData.properties->setProperty("IceMX.Metrics.View.Map.LocatorCache.GroupBy", "id");
+        Ice::CommunicatorPtr ic = Ice::initialize(initData);
+        IceMX::MetricsAdminPtr metrics = ICE_DYNAMIC_CAST(IceMX::MetricsAdmin, ic->findAdminFacet("Metrics"));
+        test(metrics);
+
+        ic->stringToProxy("test@TestAdapter")->ice_locatorCacheTimeout(2)->ice_ping(); // Miss
+        ic->stringToProxy("test@TestAdapter")->ice_locatorCacheTimeout(2)->ice_ping(); // Hit
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(1300));
+        ic->stringToProxy("test@TestAdapter")->ice_locatorCacheTimeout(2)->ice_ping(); // Refresh
+
+        Ice::Long timestamp;
+        IceMX::MetricsView view = metrics->getMetricsView("View", timestamp, Ice::Current());
+        IceMX::MetricsMap lookups = view["LocatorCache"];
+        map<string, IceMX::MetricsPtr> results;
+        for(IceMX::MetricsMap::const_iterator p = lookups.begin(); p != lookups.end(); ++p)
+        {
+            results[(*p)->id] = *p;
+        }
+        test(results.find("miss") != results.end() && results["miss"]->total == 1);
+        test(results.find("hit") != results.end() && results["hit"]->total >= 1);
+        test(results.find("refresh") != results.end() && results["refresh"]->total == 1);
+        test(results.find("stale") == results.end());
+        ic->destroy();
+    }
+    cout << "ok" << endl;
+
     cout << "testing proxy from server after shutdown... " << flush;
     hello = obj->getReplicatedHello();
     obj->shutdown();
@@ -11,6 +11,7 @@
 #include <TestCommon.h>
 #include <Test.h>
 #include <limits>
+#include <algorithm>
 
 //
 // Visual C++ defines min and max as macros
@@ -435,6 +436,37 @@ twoways(const Ice::CommunicatorPtr& communicator, const Test::MyClassPrxPtr& p)
         test(rso[7] == Ice::Byte(0xf4));
     }
 
+    {
+        //
+        // Compressed messages larger than Ice.Compression.ParallelUncompressSize
+        // are uncompressed outside the connection's IO. The payloads are
+        // pseudo-random, so that the compressed messages stay large.
+        //
+        Test::MyClassPrxPtr c = ICE_UNCHECKED_CAST(Test::MyClassPrx, p->ice_compress(true));
+
+        Test::ByteS bsi1(150 * 1024);
+        Test::ByteS bsi2(150 * 1024);
+        unsigned int seed = 1;
+        for(size_t i = 0; i < bsi1.size(); ++i)
+        {
+            seed = seed * 1103515245 + 12345;
+            bsi1[i] = Ice::Byte(seed >> 16);
+            seed = seed * 1103515245 + 12345;
+            bsi2[i] = Ice::Byte(seed >> 16);
+        }
+
+        for(int i = 0; i < 3; ++i)
+        {
+            Test::ByteS bso;
+            Test::ByteS rso = c->opByteS(bsi1, bsi2, bso);
+            test(bso.size() == bsi1.size());
+            test(std::equal(bso.begin(), bso.end(), bsi1.rbegin()));
+            test(rso.size() == bsi1.size() + bsi2.size());
+            test(std::equal(bsi1.begin(), bsi1.end(), rso.begin()));
+            test(std::equal(bsi2.begin(), bsi2.end(), rso.begin() + bsi1.size()));
+        }
+    }
+
     {
         Test::BoolS bsi1;
         Test::BoolS bsi2;
@@ -413,6 +413,27 @@ allTests(const Ice::CommunicatorPtr& communicator)
     test(b1->ice_isPreferSecure());
     prop->setProperty(property, "");
 
+    property = propertyPrefix + ".ParallelConnect";
+    test(!b1->ice_isParallelConnect());
+    prop->setProperty(property, "1");
+    b1 = communicator->propertyToProxy(propertyPrefix);
+    test(b1->ice_isParallelConnect());
+    prop->setProperty(property, "");
+
+    property = propertyPrefix + ".ConnectionPoolSize";
+    test(b1->ice_getConnectionPoolSize() == 1);
+    prop->setProperty(property, "4");
+    b1 = communicator->propertyToProxy(propertyPrefix);
+    test(b1->ice_getConnectionPoolSize() == 4);
+    prop->setProperty(property, "");
+
+    property = propertyPrefix + ".Hedging";
+    test(!b1->ice_isHedging());
+    prop->setProperty(property, "1");
+    b1 = communicator->propertyToProxy(propertyPrefix);
+    test(b1->ice_isHedging());
+    prop->setProperty(property, "");
+
     property = propertyPrefix + ".ConnectionCached";
     test(b1->ice_isConnectionCached());
     prop->setProperty(property, "0");
@@ -492,12 +513,15 @@ allTests(const Ice::CommunicatorPtr& communicator)
     b1 = b1->ice_locator(ICE_UNCHECKED_CAST(Ice::LocatorPrx, locator));
 
     Ice::PropertyDict proxyProps = communicator->proxyToProperty(b1, "Test");
-    test(proxyProps.size() == 21);
+    test(proxyProps.size() == 30);
 
     test(proxyProps["Test"] == "test -t -e 1.0");
     test(proxyProps["Test.CollocationOptimized"] == "1");
     test(proxyProps["Test.ConnectionCached"] == "1");
     test(proxyProps["Test.PreferSecure"] == "0");
+    test(proxyProps["Test.ParallelConnect"] == "0");
+    test(proxyProps["Test.ConnectionPoolSize"] == "1");
+    test(proxyProps["Test.Hedging"] == "0");
     test(proxyProps["Test.EndpointSelection"] == "Ordered");
     test(proxyProps["Test.LocatorCacheTimeout"] == "100");
     test(proxyProps["Test.InvocationTimeout"] == "1234");
@@ -507,6 +531,9 @@ allTests(const Ice::CommunicatorPtr& communicator)
     //test(proxyProps["Test.Locator.CollocationOptimized"] == "1");
     test(proxyProps["Test.Locator.ConnectionCached"] == "0");
     test(proxyProps["Test.Locator.PreferSecure"] == "1");
+    test(proxyProps["Test.Locator.ParallelConnect"] == "0");
+    test(proxyProps["Test.Locator.ConnectionPoolSize"] == "1");
+    test(proxyProps["Test.Locator.Hedging"] == "0");
     test(proxyProps["Test.Locator.EndpointSelection"] == "Random");
     test(proxyProps["Test.Locator.LocatorCacheTimeout"] == "300");
     test(proxyProps["Test.Locator.InvocationTimeout"] == "1500");
@@ -515,6 +542,9 @@ allTests(const Ice::CommunicatorPtr& communicator)
     test(proxyProps["Test.Locator.Router.CollocationOptimized"] == "0");
     test(proxyProps["Test.Locator.Router.ConnectionCached"] == "1");
     test(proxyProps["Test.Locator.Router.PreferSecure"] == "1");
+    test(proxyProps["Test.Locator.Router.ParallelConnect"] == "0");
+    test(proxyProps["Test.Locator.Router.ConnectionPoolSize"] == "1");
+    test(proxyProps["Test.Locator.Router.Hedging"] == "0");
     test(proxyProps["Test.Locator.Router.EndpointSelection"] == "Random");
     test(proxyProps["Test.Locator.Router.LocatorCacheTimeout"] == "200");
     test(proxyProps["Test.Locator.Router.InvocationTimeout"] == "1500");
@@ -542,6 +572,20 @@ allTests(const Ice::CommunicatorPtr& communicator)
     test(!base->ice_collocationOptimized(false)->ice_isCollocationOptimized());
     test(base->ice_preferSecure(true)->ice_isPreferSecure());
     test(!base->ice_preferSecure(false)->ice_isPreferSecure());
+    test(base->ice_parallelConnect(true)->ice_isParallelConnect());
+    test(!base->ice_parallelConnect(false)->ice_isParallelConnect());
+    test(base->ice_connectionPoolSize(4)->ice_getConnectionPoolSize() == 4);
+    test(base->ice_connectionPoolSize(1)->ice_getConnectionPoolSize() == 1);
+    try
+    {
+        base->ice_connectionPoolSize(0);
+        test(false);
+    }
+    catch(const IceUtil::IllegalArgumentException&)
+    {
+    }
+    test(base->ice_hedging(true)->ice_isHedging());
+    test(!base->ice_hedging(false)->ice_isHedging());
     test(base->ice_encodingVersion(Ice::Encoding_1_0)->ice_getEncodingVersion() == Ice::Encoding_1_0);
     test(base->ice_encodingVersion(Ice::Encoding_1_1)->ice_getEncodingVersion() == Ice::Encoding_1_1);
     test(base->ice_encodingVersion(Ice::Encoding_1_0)->ice_getEncodingVersion() != Ice::Encoding_1_1);
@@ -731,6 +775,18 @@ allTests(const Ice::CommunicatorPtr& communicator)
     test(Ice::targetLess(compObj->ice_preferSecure(false), compObj->ice_preferSecure(true)));
     test(Ice::targetGreaterEqual(compObj->ice_preferSecure(true), compObj->ice_preferSecure(false)));
 
+    test(Ice::targetEqualTo(compObj->ice_parallelConnect(true), compObj->ice_parallelConnect(true)));
+    test(Ice::targetNotEqualTo(compObj->ice_parallelConnect(true), compObj->ice_parallelConnect(false)));
+    test(Ice::targetLess(compObj->ice_parallelConnect(false), compObj->ice_parallelConnect(true)));
+
+    test(Ice::targetEqualTo(compObj->ice_connectionPoolSize(2), compObj->ice_connectionPoolSize(2)));
+    test(Ice::targetNotEqualTo(compObj->ice_connectionPoolSize(2), compObj->ice_connectionPoolSize(3)));
+    test(Ice::targetLess(compObj->ice_connectionPoolSize(2), compObj->ice_connectionPoolSize(3)));
+
+    test(Ice::targetEqualTo(compObj->ice_hedging(true), compObj->ice_hedging(true)));
+    test(Ice::targetNotEqualTo(compObj->ice_hedging(true), compObj->ice_hedging(false)));
+    test(Ice::targetLess(compObj->ice_hedging(false), compObj->ice_hedging(true)));
+
     auto compObj1 = communicator->stringToProxy("foo:tcp -h 127.0.0.1 -p 10000");
     auto compObj2 = communicator->stringToProxy("foo:tcp -h 127.0.0.1 -p 10001");
     test(Ice::targetNotEqualTo(compObj1, compObj2));
@@ -899,6 +955,18 @@ allTests(const Ice::CommunicatorPtr& communicator)
     test(compObj->ice_preferSecure(false) < compObj->ice_preferSecure(true));
     test(!(compObj->ice_preferSecure(true) < compObj->ice_preferSecure(false)));
 
+    test(compObj->ice_parallelConnect(true) == compObj->ice_parallelConnect(true));
+    test(compObj->ice_parallelConnect(true) != compObj->ice_parallelConnect(false));
+    test(compObj->ice_parallelConnect(false) < compObj->ice_parallelConnect(true));
+
+    test(compObj->ice_connectionPoolSize(2) == compObj->ice_connectionPoolSize(2));
+    test(compObj->ice_connectionPoolSize(2) != compObj->ice_connectionPoolSize(3));
+    test(compObj->ice_connectionPoolSize(2) < compObj->ice_connectionPoolSize(3));
+
+    test(compObj->ice_hedging(true) == compObj->ice_hedging(true));
+    test(compObj->ice_hedging(true) != compObj->ice_hedging(false));
+    test(compObj->ice_hedging(false) < compObj->ice_hedging(true));
+
     Ice::ObjectPrxPtr compObj1 = communicator->stringToProxy("foo:tcp -h 127.0.0.1 -p 10000");
     Ice::ObjectPrxPtr compObj2 = communicator->stringToProxy("foo:tcp -h 127.0.0.1 -p 10001");
     test(compObj1 != compObj2);
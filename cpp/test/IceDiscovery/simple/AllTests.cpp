@@ -194,6 +194,106 @@ allTests(const CommunicatorPtr& communicator, int num)
     }
     cout << "ok" << endl;
 
+    cout << "testing lookup batching and caching... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("IceDiscovery.BatchDelay", "10");
+        initData.properties->setProperty("IceDiscovery.CacheTimeout", "60000");
+        initData.properties->setProperty("IceDiscovery.NegativeCacheTimeout", "60000");
+        Ice::CommunicatorPtr com = Ice::initialize(initData);
+
+        //
+        // Concurrent lookups are sent as batch datagrams.
+        //
+#ifdef ICE_CPP11_MAPPING
+        vector<future<void>> results;
+        for(int i = 0; i < num; ++i)
+        {
+            ostringstream os;
+            os << "controller" << i;
+            results.push_back(com->stringToProxy(os.str())->ice_pingAsync());
+            os << "@control" << i;
+            results.push_back(com->stringToProxy(os.str())->ice_pingAsync());
+        }
+        for(vector<future<void>>::iterator p = results.begin(); p != results.end(); ++p)
+        {
+            p->get();
+        }
+#else
+        vector<Ice::AsyncResultPtr> results;
+        for(int i = 0; i < num; ++i)
+        {
+            ostringstream os;
+            os << "controller" << i;
+            results.push_back(com->stringToProxy(os.str())->begin_ice_ping());
+            os << "@control" << i;
+            results.push_back(com->stringToProxy(os.str())->begin_ice_ping());
+        }
+        for(vector<Ice::AsyncResultPtr>::const_iterator p = results.begin(); p != results.end(); ++p)
+        {
+            (*p)->getProxy()->end_ice_ping(*p);
+        }
+#endif
+
+        //
+        // The adapter isn't found and this is cached until the adapter
+        // activation is announced.
+        //
+        try
+        {
+            com->stringToProxy("object @ oa1")->ice_ping();
+            test(false);
+        }
+        catch(const Ice::NoEndpointException&)
+        {
+        }
+
+        proxies[0]->activateObjectAdapter("oa", "oa1", "");
+        proxies[0]->addObject("oa", "object");
+        int nRetry = 100;
+        while(true)
+        {
+            try
+            {
+                com->stringToProxy("object @ oa1")->ice_ping();
+                break;
+            }
+            catch(const Ice::NoEndpointException&)
+            {
+                test(--nRetry > 0);
+                IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+            }
+        }
+
+        //
+        // The deactivation is also announced, it removes the cached adapter.
+        //
+        proxies[0]->removeObject("oa", "object");
+        proxies[0]->deactivateObjectAdapter("oa");
+        nRetry = 100;
+        while(true)
+        {
+            try
+            {
+                com->stringToProxy("object @ oa1")->ice_locatorCacheTimeout(0)->ice_ping();
+                test(false);
+            }
+            catch(const Ice::NoEndpointException&)
+            {
+                break;
+            }
+            catch(const Ice::LocalException&)
+            {
+                test(--nRetry > 0);
+                IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+            }
+        }
+
+        com->destroy();
+    }
+    cout << "ok" << endl;
+
     cout << "shutting down... " << flush;
     for(vector<ControllerPrxPtr>::const_iterator p = proxies.begin(); p != proxies.end(); ++p)
     {
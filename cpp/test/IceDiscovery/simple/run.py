@@ -33,7 +33,7 @@ elif TestUtil.isDarwin():
     args += " --IceDiscovery.Interface=\"::1\""
 
 # Set the plugin property only for the server, the client uses Ice::registerIceDiscovery()
-serverArgs = " --Ice.Plugin.IceDiscovery=IceDiscovery:createIceDiscovery" + args
+serverArgs = " --Ice.Plugin.IceDiscovery=IceDiscovery:createIceDiscovery --IceDiscovery.Announce=1" + args
 serverProc = []
 for i in range(0, num):
     sys.stdout.write("starting server #%d... " % (i + 1))
@@ -683,6 +683,103 @@ allTests(const Ice::CommunicatorPtr& communicator)
     }
     cout << "ok" << endl;
 
+    cout << "testing concurrent activations... " << flush;
+    {
+        //
+        // node-1 spawns at most 2 servers concurrently, start more
+        // servers concurrently and check the activation metrics.
+        //
+        IceGrid::ApplicationInfo info = admin->getApplicationInfo("Test");
+        IceGrid::ApplicationDescriptor testApp;
+        testApp.name = "ActivationApp";
+        testApp.serverTemplates = info.descriptor.serverTemplates;
+        testApp.variables = info.descriptor.variables;
+        const int nServers = 10;
+        for(int i = 0; i < nServers; ++i)
+        {
+            ostringstream id;
+            id << "activation-" << i;
+            IceGrid::ServerInstanceDescriptor server;
+            server._cpp_template = "Server";
+            server.parameterValues["id"] = id.str();
+            testApp.nodes["node-1"].serverInstances.push_back(server);
+        }
+        IceGrid::ServerInstanceDescriptor server;
+        server._cpp_template = "Server";
+        server.parameterValues["id"] = "activation-failure";
+        server.parameterValues["fail-on-startup"] = "1";
+        testApp.nodes["node-1"].serverInstances.push_back(server);
+        try
+        {
+            admin->addApplication(testApp);
+        }
+        catch(const IceGrid::DeploymentException& ex)
+        {
+            cerr << ex.reason << endl;
+            test(false);
+        }
+
+        vector<Ice::AsyncResultPtr> results;
+        for(int i = 0; i < nServers; ++i)
+        {
+            ostringstream id;
+            id << "activation-" << i;
+            results.push_back(admin->begin_startServer(id.str()));
+        }
+        Ice::AsyncResultPtr failure = admin->begin_startServer("activation-failure");
+        for(vector<Ice::AsyncResultPtr>::const_iterator p = results.begin(); p != results.end(); ++p)
+        {
+            admin->end_startServer(*p);
+        }
+        try
+        {
+            admin->end_startServer(failure);
+            test(false);
+        }
+        catch(const IceGrid::ServerStartException&)
+        {
+        }
+
+        IceMX::MetricsAdminPrx metrics =
+            IceMX::MetricsAdminPrx::checkedCast(admin->getNodeAdmin("node-1"), "Metrics");
+        test(metrics);
+        Ice::Long timestamp;
+        IceMX::MetricsView view = metrics->getMetricsView("View", timestamp);
+        IceMX::MetricsMap activations = view["ServerActivation"];
+        int activated = 0;
+        bool failed = false;
+        for(IceMX::MetricsMap::const_iterator p = activations.begin(); p != activations.end(); ++p)
+        {
+            if((*p)->id.find("activation-") != 0)
+            {
+                continue;
+            }
+            test((*p)->total == 1);
+            test((*p)->current == 0);
+            if((*p)->id == "activation-failure")
+            {
+                test((*p)->failures == 1);
+                failed = true;
+            }
+            else
+            {
+                test((*p)->failures == 0);
+                ++activated;
+            }
+        }
+        test(activated == nServers);
+        test(failed);
+
+        for(int i = 0; i < nServers; ++i)
+        {
+            ostringstream id;
+            id << "activation-" << i;
+            admin->stopServer(id.str());
+        }
+        admin->removeApplication("ActivationApp");
+    }
+    cout << "ok" << endl;
+
     admin->stopServer("node-1");
     admin->stopServer("node-2");
 
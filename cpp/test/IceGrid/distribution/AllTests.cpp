@@ -19,6 +19,32 @@ using namespace std;
 using namespace Test;
 using namespace IceGrid;
 
+namespace
+{
+
+//
+// Returns the size of the replies of the given operation dispatched
+// by the given IcePatch2 server, or -1 if it wasn't dispatched.
+//
+Ice::Long
+getReplySize(const AdminPrx& admin, const string& server, const string& operation)
+{
+    IceMX::MetricsAdminPrx metrics = IceMX::MetricsAdminPrx::checkedCast(admin->getServerAdmin(server), "Metrics");
+    Ice::Long timestamp;
+    IceMX::MetricsView view = metrics->getMetricsView("View", timestamp);
+    IceMX::MetricsMap& dispatch = view["Dispatch"];
+    for(IceMX::MetricsMap::const_iterator p = dispatch.begin(); p != dispatch.end(); ++p)
+    {
+        if((*p)->id == operation)
+        {
+            return IceMX::DispatchMetricsPtr::dynamicCast(*p)->replySize;
+        }
+    }
+    return -1;
+}
+
+}
+
 void
 allTests(const Ice::CommunicatorPtr& communicator)
 {
@@ -55,12 +81,21 @@ allTests(const Ice::CommunicatorPtr& communicator)
         test(test->getServerFile("dir1/file1") == "dummy-file1");
         test(test->getServerFile("dir1/file2") == "dummy-file2");
         test(test->getServerFile("dir2/file3") == "dummy-file3");
+        test(test->getServerFile("dir1/large") == "large-original");
+        test(test->getServerFile("dir1/stale") == "stale-original");
+        test(test->getServerFile("dir3/file5") == "dummy-file5");
+        test(test->getServerFile("dir4") == "dummy-dir4");
 
         test(test->getApplicationFile("rootfile") == "");
         test(test->getApplicationFile("dir1/file1") == "");
         test(test->getApplicationFile("dir1/file2") == "");
         test(test->getApplicationFile("dir2/file3") == "dummy-file3");
 
+        //
+        // The files don't exist on the node yet, they are downloaded in full.
+        //
+        test(getReplySize(admin, "Test.IcePatch2", "getFileChunk") == -1);
+
         test = TestIntfPrx::uncheckedCast(communicator->stringToProxy("server-all-direct"));
 
         test(test->getServerFile("rootfile") == "");
@@ -149,6 +184,26 @@ allTests(const Ice::CommunicatorPtr& communicator)
         test(test->getServerFile("dir2/file3") == "dummy-file3");
         test(test->getServerFile("dir2/file4") == "dummy-file4");
 
+        //
+        // The removed files are removed, the updated files are replaced
+        // and the files replaced by directories (and conversely) are
+        // removed.
+        //
+        test(test->getServerFile("dir3") == "dummy-dir3");
+        test(test->getServerFile("dir3/file5") == "");
+        test(test->getServerFile("dir4/file6") == "dummy-file6");
+
+        //
+        // dir1/large is patched from the chunks that changed, the chunks
+        // are much smaller than the file. dir1/stale doesn't match its
+        // checksum once patched from its chunks, it's downloaded in full.
+        //
+        test(test->getServerFile("dir1/large") == "large-updated!");
+        test(test->getServerFile("dir1/stale") == "stale-updated!");
+        Ice::Long chunksSize = getReplySize(admin, "Test.IcePatch2", "getFileChunk");
+        test(chunksSize > 0 && chunksSize < 1024 * 1024);
+        test(getReplySize(admin, "Test.IcePatch2", "getChunkInfoSeq") > 0);
+
         test(test->getApplicationFile("rootfile") == "");
         test(test->getApplicationFile("dir1/file1") == "");
         test(test->getApplicationFile("dir1/file2") == "");
@@ -171,6 +226,10 @@ allTests(const Ice::CommunicatorPtr& communicator)
         test(test->getServerFile("dir1/file2") == "dummy-file2-updated!");
         test(test->getServerFile("dir2/file3") == "dummy-file3");
         test(test->getServerFile("dir2/file4") == "dummy-file4");
+        test(test->getServerFile("dir3") == "dummy-dir3");
+        test(test->getServerFile("dir4/file6") == "dummy-file6");
+        test(test->getServerFile("dir1/large") == "large-updated!");
+        test(test->getServerFile("dir1/stale") == "stale-updated!");
 
         test(test->getApplicationFile("rootfile") == "");
         test(test->getApplicationFile("dir1/file1") == "");
@@ -194,6 +253,8 @@ allTests(const Ice::CommunicatorPtr& communicator)
         test(test->getServerFile("dir1/file2") == "dummy-file2-updated!");
         test(test->getServerFile("dir2/file3") == "");
         test(test->getServerFile("dir2/file4") == "");
+        test(test->getServerFile("dir1/large") == "large-updated!");
+        test(test->getServerFile("dir1/stale") == "stale-updated!");
 
         test(test->getApplicationFile("rootfile") == "");
         test(test->getApplicationFile("dir1/file1") == "");
@@ -27,6 +27,16 @@ def icepatch2Calc(datadir, dirname):
 
 datadir = os.path.join(os.getcwd(), "data")
 
+#
+# Large files which already exist on the node are patched by only
+# downloading the chunks that changed.
+#
+def largeFile(first, modified):
+    lines = [first]
+    for i in range(0, 160000):
+        lines.append("line %d%s" % (i, " modified" if modified and i == 80000 else ""))
+    return "\n".join(lines) + "\n"
+
 files = [
   [ "original/rootfile", "rootfile" ],
   [ "original/dir1/file1", "dummy-file1"],
@@ -36,6 +46,14 @@ files = [
   [ "updated/dir1/file2", "dummy-file2-updated!"],
   [ "updated/dir2/file3", "dummy-file3"],
   [ "updated/dir2/file4", "dummy-file4"],
+  [ "original/dir1/large", largeFile("large-original", False) ],
+  [ "original/dir1/stale", largeFile("stale-original", False) ],
+  [ "original/dir3/file5", "dummy-file5" ],
+  [ "original/dir4", "dummy-dir4" ],
+  [ "updated/dir1/large", largeFile("large-updated!", True) ],
+  [ "updated/dir1/stale", largeFile("stale-updated!", True) ],
+  [ "updated/dir3", "dummy-dir3" ],
+  [ "updated/dir4/file6", "dummy-file6" ],
 ]
 
 
@@ -56,6 +74,15 @@ for [file, content] in files:
 
 icepatch2Calc(datadir, "original")
 icepatch2Calc(datadir, "updated")
+
+#
+# Modify the uncompressed updated/dir1/stale file once its checksum is
+# computed: the file patched from its chunks doesn't match the checksum
+# and the patcher falls back to downloading the compressed file.
+#
+f = open(os.path.join(datadir, "updated/dir1/stale"), 'w')
+f.write(largeFile("stale-corrupt!", True))
+f.close()
 print("ok")
 
 IceGridAdmin.iceGridTest("application.xml", "", "server.dir='%s'" % TestUtil.getTestDirectory("server"))
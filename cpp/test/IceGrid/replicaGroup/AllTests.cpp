@@ -480,6 +480,38 @@ allTests(const Ice::CommunicatorPtr& comm)
     }
     cout << "ok" << endl;
 
+    cout << "testing replication with power of two choices load balancing... " << flush;
+    {
+        map<string, string> params;
+        params["replicaGroup"] = "PowerOfTwo";
+        params["id"] = "Server1";
+        instantiateServer(admin, "Server", "localnode", params);
+        params["id"] = "Server2";
+        instantiateServer(admin, "Server", "localnode", params);
+        params["id"] = "Server3";
+        instantiateServer(admin, "Server", "localnode", params);
+        TestIntfPrx obj = TestIntfPrx::uncheckedCast(comm->stringToProxy("PowerOfTwo"));
+        obj = TestIntfPrx::uncheckedCast(obj->ice_locatorCacheTimeout(0));
+        obj = TestIntfPrx::uncheckedCast(obj->ice_connectionCached(false));
+        set<string> replicaIds = serverReplicaIds;
+        while(!replicaIds.empty())
+        {
+            try
+            {
+                replicaIds.erase(obj->getReplicaId());
+            }
+            catch(const Ice::LocalException& ex)
+            {
+                cerr << ex << endl;
+                test(false);
+            }
+        }
+        removeServer(admin, "Server1");
+        removeServer(admin, "Server2");
+        removeServer(admin, "Server3");
+    }
+    cout << "ok" << endl;
+
     cout << "testing filters... " << flush;
     {
         map<string, string> params;
@@ -266,6 +266,9 @@ allTests(const Ice::CommunicatorPtr& comm)
     params["id"] = "Master";
     params["replicaName"] = "";
     params["port"] = "12050";
+    params["admin"] = "1"; // For the group commit test
+    params["traceObject"] = "2";
+    params["updateLogSize"] = "20"; // For the replica synchronization test
     instantiateServer(admin, "IceGridRegistry", params);
 
     params.clear();
@@ -278,6 +281,8 @@ allTests(const Ice::CommunicatorPtr& comm)
     params["id"] = "Slave2";
     params["replicaName"] = "Slave2";
     params["port"] = "12052";
+    params["admin"] = "1"; // For the replica synchronization test
+    params["traceObject"] = "1";
     instantiateServer(admin, "IceGridRegistry", params);
 
     Ice::LocatorPrx masterLocator =
@@ -511,6 +516,197 @@ allTests(const Ice::CommunicatorPtr& comm)
     }
     cout << "ok" << endl;
 
+    //
+    // Group commit test: concurrent adapter and object updates sent
+    // to the master are committed together and replicated.
+    //
+    cout << "testing group commit... " << flush;
+    {
+        Ice::LoggerAdminPrx logger =
+            Ice::LoggerAdminPrx::checkedCast(masterAdmin->getRegistryAdmin("Master"), "Logger");
+        test(logger);
+
+        Ice::LocatorRegistryPrx locatorRegistry = masterLocator->getRegistry();
+        Ice::ObjectPrx proxy = comm->stringToProxy("dummy:tcp -p 12345 -h 127.0.0.1");
+
+        const int nWrites = 10;
+        bool batched = false;
+        for(int i = 0; i < 10 && !batched; ++i)
+        {
+            ostringstream os;
+            os << "GroupCommit" << i;
+
+            vector<Ice::AsyncResultPtr> objects;
+            vector<Ice::AsyncResultPtr> adapters;
+            for(int j = 0; j < nWrites; ++j)
+            {
+                ostringstream id;
+                id << os.str() << "-" << j;
+                objects.push_back(masterAdmin->begin_addObjectWithType(
+                                      comm->stringToProxy(id.str() + ":tcp -p 12345 -h 127.0.0.1"), "::Test"));
+                adapters.push_back(locatorRegistry->begin_setAdapterDirectProxy(id.str(), proxy));
+            }
+            for(vector<Ice::AsyncResultPtr>::const_iterator p = objects.begin(); p != objects.end(); ++p)
+            {
+                masterAdmin->end_addObjectWithType(*p);
+            }
+            for(vector<Ice::AsyncResultPtr>::const_iterator p = adapters.begin(); p != adapters.end(); ++p)
+            {
+                locatorRegistry->end_setAdapterDirectProxy(*p);
+            }
+
+            vector<Ice::AsyncResultPtr> results;
+            for(int j = 0; j < nWrites; ++j)
+            {
+                ostringstream id;
+                id << os.str() << "-" << j;
+                results.push_back(masterAdmin->begin_updateObject(
+                                      comm->stringToProxy(id.str() + ":tcp -p 12346 -h 127.0.0.1")));
+            }
+            for(vector<Ice::AsyncResultPtr>::const_iterator p = results.begin(); p != results.end(); ++p)
+            {
+                masterAdmin->end_updateObject(*p);
+            }
+
+            for(int j = 0; j < nWrites; ++j)
+            {
+                ostringstream id;
+                id << os.str() << "-" << j;
+                ObjectInfo info = slave1Admin->getObjectInfo(Ice::stringToIdentity(id.str()));
+                test(info.type == "::Test");
+                test(info.proxy->ice_getEndpoints()[0]->toString().find("-p 12346") != string::npos);
+                test(slave1Admin->getAdapterInfo(id.str())[0].proxy == proxy);
+            }
+
+            Ice::LogMessageTypeSeq messageTypes;
+            messageTypes.push_back(Ice::TraceMessage);
+            Ice::StringSeq traceCategories;
+            traceCategories.push_back("Object");
+            string prefix;
+            Ice::LogMessageSeq messages = logger->getLog(messageTypes, traceCategories, -1, prefix);
+            for(Ice::LogMessageSeq::const_iterator p = messages.begin(); p != messages.end() && !batched; ++p)
+            {
+                batched = p->message.find("writes in one transaction") != string::npos;
+            }
+
+            for(int j = 0; j < nWrites; ++j)
+            {
+                ostringstream id;
+                id << os.str() << "-" << j;
+                masterAdmin->removeObject(Ice::stringToIdentity(id.str()));
+                locatorRegistry->setAdapterDirectProxy(id.str(), 0);
+            }
+        }
+        test(batched);
+    }
+    cout << "ok" << endl;
+
+    //
+    // Replica synchronization test: a replica which reconnects only
+    // receives the updates it missed if the master still has them in
+    // its update log, it's initialized with the full state otherwise.
+    //
+    cout << "testing replica synchronization... " << flush;
+    {
+        Ice::LogMessageTypeSeq messageTypes;
+        messageTypes.push_back(Ice::TraceMessage);
+        Ice::StringSeq traceCategories;
+        traceCategories.push_back("Object");
+        string prefix;
+
+        //
+        // Less updates than the master update log size (20).
+        //
+        slave2Admin->shutdown();
+        waitForServerState(admin, "Slave2", false);
+        for(int i = 0; i < 3; ++i)
+        {
+            ostringstream id;
+            id << "Delta-" << i;
+            masterAdmin->addObjectWithType(comm->stringToProxy(id.str() + ":tcp -p 12345 -h 127.0.0.1"), "::Test");
+        }
+        admin->startServer("Slave2");
+        slave2Admin = createAdminSession(slave2Locator, "Slave2");
+        for(int i = 0; i < 3; ++i)
+        {
+            ostringstream id;
+            id << "Delta-" << i;
+            test(slave2Admin->getObjectInfo(Ice::stringToIdentity(id.str())).type == "::Test");
+        }
+
+        Ice::LoggerAdminPrx logger =
+            Ice::LoggerAdminPrx::checkedCast(slave2Admin->getRegistryAdmin("Slave2"), "Logger");
+        Ice::LogMessageSeq messages = logger->getLog(messageTypes, traceCategories, -1, prefix);
+        int added = 0;
+        for(Ice::LogMessageSeq::const_iterator p = messages.begin(); p != messages.end(); ++p)
+        {
+            test(p->message.find("synchronized objects") == string::npos);
+            if(p->message.find("added object `Delta-") != string::npos)
+            {
+                ++added;
+            }
+        }
+        test(added == 3);
+
+        //
+        // More updates than the master update log size, the log is
+        // truncated.
+        //
+        slave2Admin->shutdown();
+        waitForServerState(admin, "Slave2", false);
+        for(int i = 0; i < 3; ++i)
+        {
+            ostringstream id;
+            id << "Delta-" << i;
+            masterAdmin->removeObject(Ice::stringToIdentity(id.str()));
+        }
+        for(int i = 0; i < 25; ++i)
+        {
+            ostringstream id;
+            id << "Truncated-" << i;
+            masterAdmin->addObjectWithType(comm->stringToProxy(id.str() + ":tcp -p 12345 -h 127.0.0.1"), "::Test");
+        }
+        admin->startServer("Slave2");
+        slave2Admin = createAdminSession(slave2Locator, "Slave2");
+        for(int i = 0; i < 25; ++i)
+        {
+            ostringstream id;
+            id << "Truncated-" << i;
+            test(slave2Admin->getObjectInfo(Ice::stringToIdentity(id.str())).type == "::Test");
+        }
+        for(int i = 0; i < 3; ++i)
+        {
+            ostringstream id;
+            id << "Delta-" << i;
+            try
+            {
+                slave2Admin->getObjectInfo(Ice::stringToIdentity(id.str()));
+                test(false);
+            }
+            catch(const ObjectNotRegisteredException&)
+            {
+            }
+        }
+
+        logger = Ice::LoggerAdminPrx::checkedCast(slave2Admin->getRegistryAdmin("Slave2"), "Logger");
+        messages = logger->getLog(messageTypes, traceCategories, -1, prefix);
+        bool synchronized = false;
+        for(Ice::LogMessageSeq::const_iterator p = messages.begin(); p != messages.end(); ++p)
+        {
+            test(p->message.find("added object `Truncated-") == string::npos);
+            synchronized = synchronized || p->message.find("synchronized objects") != string::npos;
+        }
+        test(synchronized);
+
+        for(int i = 0; i < 25; ++i)
+        {
+            ostringstream id;
+            id << "Truncated-" << i;
+            masterAdmin->removeObject(Ice::stringToIdentity(id.str()));
+        }
+    }
+    cout << "ok" << endl;
+
     //
     // Registry update test:
     //
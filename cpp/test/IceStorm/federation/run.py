@@ -58,6 +58,19 @@ def runtest(type, **args):
     icestorm.admin("create fed1 fed2 fed3; link fed1 fed2 10; link fed2 fed3 5")
     print("ok")
 
+    #
+    # Check that all the topics and their links are recreated when a
+    # persistent service restarts.
+    #
+    if type == "persistent":
+        sys.stdout.write("restarting icestorm... ")
+        sys.stdout.flush()
+        icestorm.stop()
+        icestorm.start(echo = False)
+        icestorm.admin("topics", expect = "fed1.*fed2.*fed3")
+        icestorm.admin("links", expect = "fed1 to fed2 with cost 10.*fed2 to fed3 with cost 5")
+        print("ok")
+
     #
     # Test oneway subscribers.
     #
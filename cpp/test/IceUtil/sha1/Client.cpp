@@ -8,6 +8,7 @@
 // **********************************************************************
 
 #include <IceUtil/SHA1.h>
+#include <IceUtil/Time.h>
 #include <TestCommon.h>
 
 using namespace std;
@@ -73,10 +74,74 @@ string toHex(const string& data)
     return os.str();
 }
 
+string toHex(const vector<unsigned char>& md)
+{
+    return toHex(string(reinterpret_cast<const char*>(&md[0]), md.size()));
+}
+
+void
+usage(const char* myName)
+{
+    cerr << "Usage: " << myName << " [-v]" << endl;
+    cerr << "-v: measure the hashing throughput." << endl;
+}
+
+void
+benchmark()
+{
+    const size_t sizes[] = { 64, 4 * 1024, 1024 * 1024 };
+    const size_t total = 64 * 1024 * 1024;
+
+    vector<unsigned char> data(sizes[2]);
+    for(size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<unsigned char>(i * 7);
+    }
+
+    for(size_t i = 0; i < sizeof(sizes) / sizeof(size_t); ++i)
+    {
+        const size_t count = total / sizes[i];
+        vector<unsigned char> md;
+
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        for(size_t j = 0; j < count; ++j)
+        {
+            IceUtilInternal::sha1(&data[0], sizes[i], md);
+        }
+        IceUtil::Time sha1Time = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+
+        start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        for(size_t j = 0; j < count; ++j)
+        {
+            IceUtilInternal::SHA1 hasher;
+            hasher.update(&data[0], sizes[i]);
+            hasher.finalize(md);
+        }
+        IceUtil::Time hasherTime = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+
+        cout << "  " << sizes[i] << " bytes: sha1() "
+             << static_cast<double>(total) / max<double>(sha1Time.toMicroSecondsDouble(), 1) << " MB/s, "
+             << sha1Time.toMicroSecondsDouble() / count << " us/hash; SHA1 "
+             << static_cast<double>(total) / max<double>(hasherTime.toMicroSecondsDouble(), 1) << " MB/s, "
+             << hasherTime.toMicroSecondsDouble() / count << " us/hash" << endl;
+    }
+}
+
 }
 
 int main(int argc, char* argv[])
 {
+    bool verbose = false;
+    if(argc > 2 || (argc == 2 && string(argv[1]) != "-v"))
+    {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    else if(argc == 2)
+    {
+        verbose = true;
+    }
+
     cout << "Testing sha1 hash computation... ";
     for(int i = 0; i < itemsSize; ++i)
     {
@@ -110,5 +175,47 @@ int main(int argc, char* argv[])
         test(item->digest == digest);
     }
     cout << "ok" << endl;
+
+    cout << "Testing sha1 hash computation of large data... " << flush;
+    {
+        //
+        // One million repetitions of "a", from FIPS 180-2.
+        //
+        const string digest = "34aa973cd4c4daa4f61eeb2bdbad27316534016f";
+        vector<unsigned char> data(1000000, 'a');
+
+        vector<unsigned char> md;
+        IceUtilInternal::sha1(&data[0], data.size(), md);
+        test(toHex(md) == digest);
+
+        //
+        // Update sizes which aren't multiples of the SHA-1 block size.
+        //
+        const size_t packetSizes[] = { 1, 63, 65, 1000, 4096, 65537 };
+        for(size_t i = 0; i < sizeof(packetSizes) / sizeof(size_t); ++i)
+        {
+            IceUtilInternal::SHA1 hasher;
+            for(size_t pos = 0; pos < data.size(); pos += packetSizes[i])
+            {
+                hasher.update(&data[pos], min(packetSizes[i], data.size() - pos));
+            }
+            hasher.finalize(md);
+            test(toHex(md) == digest);
+        }
+
+        //
+        // The empty message.
+        //
+        IceUtilInternal::SHA1 hasher;
+        hasher.finalize(md);
+        test(toHex(md) == "da39a3ee5e6b4b0d3255bfef95601890afd80709");
+    }
+    cout << "ok" << endl;
+
+    if(verbose)
+    {
+        cout << "Measuring sha1 hash throughput..." << endl;
+        benchmark();
+    }
     return EXIT_SUCCESS;
 }
@@ -39,6 +39,9 @@ public final class PropertyNames
         new Property("Ice\\.Admin\\.Locator\\.EndpointSelection", false, null),
         new Property("Ice\\.Admin\\.Locator\\.ConnectionCached", false, null),
         new Property("Ice\\.Admin\\.Locator\\.PreferSecure", false, null),
+        new Property("Ice\\.Admin\\.Locator\\.ParallelConnect", false, null),
+        new Property("Ice\\.Admin\\.Locator\\.ConnectionPoolSize", false, null),
+        new Property("Ice\\.Admin\\.Locator\\.Hedging", false, null),
         new Property("Ice\\.Admin\\.Locator\\.LocatorCacheTimeout", false, null),
         new Property("Ice\\.Admin\\.Locator\\.InvocationTimeout", false, null),
         new Property("Ice\\.Admin\\.Locator\\.Locator", false, null),
@@ -51,6 +54,9 @@ public final class PropertyNames
         new Property("Ice\\.Admin\\.Router\\.EndpointSelection", false, null),
         new Property("Ice\\.Admin\\.Router\\.ConnectionCached", false, null),
         new Property("Ice\\.Admin\\.Router\\.PreferSecure", false, null),
+        new Property("Ice\\.Admin\\.Router\\.ParallelConnect", false, null),
+        new Property("Ice\\.Admin\\.Router\\.ConnectionPoolSize", false, null),
+        new Property("Ice\\.Admin\\.Router\\.Hedging", false, null),
         new Property("Ice\\.Admin\\.Router\\.LocatorCacheTimeout", false, null),
         new Property("Ice\\.Admin\\.Router\\.InvocationTimeout", false, null),
         new Property("Ice\\.Admin\\.Router\\.Locator", false, null),
@@ -81,9 +87,13 @@ public final class PropertyNames
         new Property("Ice\\.ChangeUser", false, null),
         new Property("Ice\\.ClientAccessPolicyProtocol", false, null),
         new Property("Ice\\.Compression\\.Level", false, null),
+        new Property("Ice\\.Compression\\.ParallelUncompressSize", false, null),
         new Property("Ice\\.CollectObjects", false, null),
         new Property("Ice\\.Config", false, null),
         new Property("Ice\\.ConsoleListener", false, null),
+        new Property("Ice\\.ConnectionPool\\.GrowThreshold", false, null),
+        new Property("Ice\\.ConnectionPool\\.IdleTimeout", false, null),
+        new Property("Ice\\.ConnectionPool\\.Striping", false, null),
         new Property("Ice\\.Default\\.CollocationOptimized", false, null),
         new Property("Ice\\.Default\\.EncodingVersion", false, null),
         new Property("Ice\\.Default\\.EndpointSelection", false, null),
@@ -91,6 +101,9 @@ public final class PropertyNames
         new Property("Ice\\.Default\\.Locator\\.EndpointSelection", false, null),
         new Property("Ice\\.Default\\.Locator\\.ConnectionCached", false, null),
         new Property("Ice\\.Default\\.Locator\\.PreferSecure", false, null),
+        new Property("Ice\\.Default\\.Locator\\.ParallelConnect", false, null),
+        new Property("Ice\\.Default\\.Locator\\.ConnectionPoolSize", false, null),
+        new Property("Ice\\.Default\\.Locator\\.Hedging", false, null),
         new Property("Ice\\.Default\\.Locator\\.LocatorCacheTimeout", false, null),
         new Property("Ice\\.Default\\.Locator\\.InvocationTimeout", false, null),
         new Property("Ice\\.Default\\.Locator\\.Locator", false, null),
@@ -102,10 +115,16 @@ public final class PropertyNames
         new Property("Ice\\.Default\\.InvocationTimeout", false, null),
         new Property("Ice\\.Default\\.Package", false, null),
         new Property("Ice\\.Default\\.PreferSecure", false, null),
+        new Property("Ice\\.Default\\.ParallelConnect", false, null),
+        new Property("Ice\\.Default\\.ConnectionPoolSize", false, null),
+        new Property("Ice\\.Default\\.Hedging", false, null),
         new Property("Ice\\.Default\\.Protocol", false, null),
         new Property("Ice\\.Default\\.Router\\.EndpointSelection", false, null),
         new Property("Ice\\.Default\\.Router\\.ConnectionCached", false, null),
         new Property("Ice\\.Default\\.Router\\.PreferSecure", false, null),
+        new Property("Ice\\.Default\\.Router\\.ParallelConnect", false, null),
+        new Property("Ice\\.Default\\.Router\\.ConnectionPoolSize", false, null),
+        new Property("Ice\\.Default\\.Router\\.Hedging", false, null),
         new Property("Ice\\.Default\\.Router\\.LocatorCacheTimeout", false, null),
         new Property("Ice\\.Default\\.Router\\.InvocationTimeout", false, null),
         new Property("Ice\\.Default\\.Router\\.Locator", false, null),
@@ -116,14 +135,26 @@ public final class PropertyNames
         new Property("Ice\\.Default\\.SlicedFormat", false, null),
         new Property("Ice\\.Default\\.SourceAddress", false, null),
         new Property("Ice\\.Default\\.Timeout", false, null),
+        new Property("Ice\\.EndpointHealth\\.EjectionTime", false, null),
+        new Property("Ice\\.EndpointHealth\\.FailureThreshold", false, null),
+        new Property("Ice\\.EndpointHealth\\.LatencyThreshold", false, null),
+        new Property("Ice\\.EndpointHealth\\.MaxEjectionTime", false, null),
         new Property("Ice\\.EventLog\\.Source", false, null),
         new Property("Ice\\.FactoryAssemblies", false, null),
         new Property("Ice\\.HTTPProxyHost", false, null),
         new Property("Ice\\.HTTPProxyPort", false, null),
+        new Property("Ice\\.Hedging\\.Budget", false, null),
+        new Property("Ice\\.Hedging\\.MinDelay", false, null),
+        new Property("Ice\\.Hedging\\.Percentile", false, null),
+        new Property("Ice\\.HostResolver\\.CacheTimeout", false, null),
+        new Property("Ice\\.HostResolver\\.NegativeCacheTimeout", false, null),
+        new Property("Ice\\.HostResolver\\.SizeMax", false, null),
         new Property("Ice\\.ImplicitContext", false, null),
         new Property("Ice\\.InitPlugins", false, null),
         new Property("Ice\\.IPv4", false, null),
         new Property("Ice\\.IPv6", false, null),
+        new Property("Ice\\.LocatorCacheJitter", false, null),
+        new Property("Ice\\.LocatorCacheRefreshAhead", false, null),
         new Property("Ice\\.LogFile", false, null),
         new Property("Ice\\.LogFile\\.SizeMax", false, null),
         new Property("Ice\\.LogStdErr\\.Convert", false, null),
@@ -136,6 +167,7 @@ public final class PropertyNames
         new Property("Ice\\.Override\\.Timeout", false, null),
         new Property("Ice\\.Override\\.Secure", false, null),
         new Property("Ice\\.Package\\.[^\\s]+", false, null),
+        new Property("Ice\\.ParallelConnectDelay", false, null),
         new Property("Ice\\.Plugin\\.[^\\s]+", false, null),
         new Property("Ice\\.PluginLoadOrder", false, null),
         new Property("Ice\\.PreferIPv6Address", false, null),
@@ -216,6 +248,9 @@ public final class PropertyNames
         new Property("IceDiscovery\\.Multicast\\.Locator\\.EndpointSelection", false, null),
         new Property("IceDiscovery\\.Multicast\\.Locator\\.ConnectionCached", false, null),
         new Property("IceDiscovery\\.Multicast\\.Locator\\.PreferSecure", false, null),
+        new Property("IceDiscovery\\.Multicast\\.Locator\\.ParallelConnect", false, null),
+        new Property("IceDiscovery\\.Multicast\\.Locator\\.ConnectionPoolSize", false, null),
+        new Property("IceDiscovery\\.Multicast\\.Locator\\.Hedging", false, null),
         new Property("IceDiscovery\\.Multicast\\.Locator\\.LocatorCacheTimeout", false, null),
         new Property("IceDiscovery\\.Multicast\\.Locator\\.InvocationTimeout", false, null),
         new Property("IceDiscovery\\.Multicast\\.Locator\\.Locator", false, null),
@@ -228,6 +263,9 @@ public final class PropertyNames
         new Property("IceDiscovery\\.Multicast\\.Router\\.EndpointSelection", false, null),
         new Property("IceDiscovery\\.Multicast\\.Router\\.ConnectionCached", false, null),
         new Property("IceDiscovery\\.Multicast\\.Router\\.PreferSecure", false, null),
+        new Property("IceDiscovery\\.Multicast\\.Router\\.ParallelConnect", false, null),
+        new Property("IceDiscovery\\.Multicast\\.Router\\.ConnectionPoolSize", false, null),
+        new Property("IceDiscovery\\.Multicast\\.Router\\.Hedging", false, null),
         new Property("IceDiscovery\\.Multicast\\.Router\\.LocatorCacheTimeout", false, null),
         new Property("IceDiscovery\\.Multicast\\.Router\\.InvocationTimeout", false, null),
         new Property("IceDiscovery\\.Multicast\\.Router\\.Locator", false, null),
@@ -253,6 +291,9 @@ public final class PropertyNames
         new Property("IceDiscovery\\.Reply\\.Locator\\.EndpointSelection", false, null),
         new Property("IceDiscovery\\.Reply\\.Locator\\.ConnectionCached", false, null),
         new Property("IceDiscovery\\.Reply\\.Locator\\.PreferSecure", false, null),
+        new Property("IceDiscovery\\.Reply\\.Locator\\.ParallelConnect", false, null),
+        new Property("IceDiscovery\\.Reply\\.Locator\\.ConnectionPoolSize", false, null),
+        new Property("IceDiscovery\\.Reply\\.Locator\\.Hedging", false, null),
         new Property("IceDiscovery\\.Reply\\.Locator\\.LocatorCacheTimeout", false, null),
         new Property("IceDiscovery\\.Reply\\.Locator\\.InvocationTimeout", false, null),
         new Property("IceDiscovery\\.Reply\\.Locator\\.Locator", false, null),
@@ -265,6 +306,9 @@ public final class PropertyNames
         new Property("IceDiscovery\\.Reply\\.Router\\.EndpointSelection", false, null),
         new Property("IceDiscovery\\.Reply\\.Router\\.ConnectionCached", false, null),
         new Property("IceDiscovery\\.Reply\\.Router\\.PreferSecure", false, null),
+        new Property("IceDiscovery\\.Reply\\.Router\\.ParallelConnect", false, null),
+        new Property("IceDiscovery\\.Reply\\.Router\\.ConnectionPoolSize", false, null),
+        new Property("IceDiscovery\\.Reply\\.Router\\.Hedging", false, null),
         new Property("IceDiscovery\\.Reply\\.Router\\.LocatorCacheTimeout", false, null),
         new Property("IceDiscovery\\.Reply\\.Router\\.InvocationTimeout", false, null),
         new Property("IceDiscovery\\.Reply\\.Router\\.Locator", false, null),
@@ -290,6 +334,9 @@ public final class PropertyNames
         new Property("IceDiscovery\\.Locator\\.Locator\\.EndpointSelection", false, null),
         new Property("IceDiscovery\\.Locator\\.Locator\\.ConnectionCached", false, null),
         new Property("IceDiscovery\\.Locator\\.Locator\\.PreferSecure", false, null),
+        new Property("IceDiscovery\\.Locator\\.Locator\\.ParallelConnect", false, null),
+        new Property("IceDiscovery\\.Locator\\.Locator\\.ConnectionPoolSize", false, null),
+        new Property("IceDiscovery\\.Locator\\.Locator\\.Hedging", false, null),
         new Property("IceDiscovery\\.Locator\\.Locator\\.LocatorCacheTimeout", false, null),
         new Property("IceDiscovery\\.Locator\\.Locator\\.InvocationTimeout", false, null),
         new Property("IceDiscovery\\.Locator\\.Locator\\.Locator", false, null),
@@ -302,6 +349,9 @@ public final class PropertyNames
         new Property("IceDiscovery\\.Locator\\.Router\\.EndpointSelection", false, null),
         new Property("IceDiscovery\\.Locator\\.Router\\.ConnectionCached", false, null),
         new Property("IceDiscovery\\.Locator\\.Router\\.PreferSecure", false, null),
+        new Property("IceDiscovery\\.Locator\\.Router\\.ParallelConnect", false, null),
+        new Property("IceDiscovery\\.Locator\\.Router\\.ConnectionPoolSize", false, null),
+        new Property("IceDiscovery\\.Locator\\.Router\\.Hedging", false, null),
         new Property("IceDiscovery\\.Locator\\.Router\\.LocatorCacheTimeout", false, null),
         new Property("IceDiscovery\\.Locator\\.Router\\.InvocationTimeout", false, null),
         new Property("IceDiscovery\\.Locator\\.Router\\.Locator", false, null),
@@ -326,6 +376,10 @@ public final class PropertyNames
         new Property("IceDiscovery\\.Port", false, null),
         new Property("IceDiscovery\\.Interface", false, null),
         new Property("IceDiscovery\\.DomainId", false, null),
+        new Property("IceDiscovery\\.BatchDelay", false, null),
+        new Property("IceDiscovery\\.CacheTimeout", false, null),
+        new Property("IceDiscovery\\.NegativeCacheTimeout", false, null),
+        new Property("IceDiscovery\\.Announce", false, null),
         null
     };
 
@@ -340,6 +394,9 @@ public final class PropertyNames
         new Property("IceGridDiscovery\\.Reply\\.Locator\\.EndpointSelection", false, null),
         new Property("IceGridDiscovery\\.Reply\\.Locator\\.ConnectionCached", false, null),
         new Property("IceGridDiscovery\\.Reply\\.Locator\\.PreferSecure", false, null),
+        new Property("IceGridDiscovery\\.Reply\\.Locator\\.ParallelConnect", false, null),
+        new Property("IceGridDiscovery\\.Reply\\.Locator\\.ConnectionPoolSize", false, null),
+        new Property("IceGridDiscovery\\.Reply\\.Locator\\.Hedging", false, null),
         new Property("IceGridDiscovery\\.Reply\\.Locator\\.LocatorCacheTimeout", false, null),
         new Property("IceGridDiscovery\\.Reply\\.Locator\\.InvocationTimeout", false, null),
         new Property("IceGridDiscovery\\.Reply\\.Locator\\.Locator", false, null),
@@ -352,6 +409,9 @@ public final class PropertyNames
         new Property("IceGridDiscovery\\.Reply\\.Router\\.EndpointSelection", false, null),
         new Property("IceGridDiscovery\\.Reply\\.Router\\.ConnectionCached", false, null),
         new Property("IceGridDiscovery\\.Reply\\.Router\\.PreferSecure", false, null),
+        new Property("IceGridDiscovery\\.Reply\\.Router\\.ParallelConnect", false, null),
+        new Property("IceGridDiscovery\\.Reply\\.Router\\.ConnectionPoolSize", false, null),
+        new Property("IceGridDiscovery\\.Reply\\.Router\\.Hedging", false, null),
         new Property("IceGridDiscovery\\.Reply\\.Router\\.LocatorCacheTimeout", false, null),
         new Property("IceGridDiscovery\\.Reply\\.Router\\.InvocationTimeout", false, null),
         new Property("IceGridDiscovery\\.Reply\\.Router\\.Locator", false, null),
@@ -377,6 +437,9 @@ public final class PropertyNames
         new Property("IceGridDiscovery\\.Locator\\.Locator\\.EndpointSelection", false, null),
         new Property("IceGridDiscovery\\.Locator\\.Locator\\.ConnectionCached", false, null),
         new Property("IceGridDiscovery\\.Locator\\.Locator\\.PreferSecure", false, null),
+        new Property("IceGridDiscovery\\.Locator\\.Locator\\.ParallelConnect", false, null),
+        new Property("IceGridDiscovery\\.Locator\\.Locator\\.ConnectionPoolSize", false, null),
+        new Property("IceGridDiscovery\\.Locator\\.Locator\\.Hedging", false, null),
         new Property("IceGridDiscovery\\.Locator\\.Locator\\.LocatorCacheTimeout", false, null),
         new Property("IceGridDiscovery\\.Locator\\.Locator\\.InvocationTimeout", false, null),
         new Property("IceGridDiscovery\\.Locator\\.Locator\\.Locator", false, null),
@@ -389,6 +452,9 @@ public final class PropertyNames
         new Property("IceGridDiscovery\\.Locator\\.Router\\.EndpointSelection", false, null),
         new Property("IceGridDiscovery\\.Locator\\.Router\\.ConnectionCached", false, null),
         new Property("IceGridDiscovery\\.Locator\\.Router\\.PreferSecure", false, null),
+        new Property("IceGridDiscovery\\.Locator\\.Router\\.ParallelConnect", false, null),
+        new Property("IceGridDiscovery\\.Locator\\.Router\\.ConnectionPoolSize", false, null),
+        new Property("IceGridDiscovery\\.Locator\\.Router\\.Hedging", false, null),
         new Property("IceGridDiscovery\\.Locator\\.Router\\.LocatorCacheTimeout", false, null),
         new Property("IceGridDiscovery\\.Locator\\.Router\\.InvocationTimeout", false, null),
         new Property("IceGridDiscovery\\.Locator\\.Router\\.Locator", false, null),
@@ -443,6 +509,9 @@ public final class PropertyNames
         new Property("IceBoxAdmin\\.ServiceManager\\.Proxy\\.EndpointSelection", false, null),
         new Property("IceBoxAdmin\\.ServiceManager\\.Proxy\\.ConnectionCached", false, null),
         new Property("IceBoxAdmin\\.ServiceManager\\.Proxy\\.PreferSecure", false, null),
+        new Property("IceBoxAdmin\\.ServiceManager\\.Proxy\\.ParallelConnect", false, null),
+        new Property("IceBoxAdmin\\.ServiceManager\\.Proxy\\.ConnectionPoolSize", false, null),
+        new Property("IceBoxAdmin\\.ServiceManager\\.Proxy\\.Hedging", false, null),
         new Property("IceBoxAdmin\\.ServiceManager\\.Proxy\\.LocatorCacheTimeout", false, null),
         new Property("IceBoxAdmin\\.ServiceManager\\.Proxy\\.InvocationTimeout", false, null),
         new Property("IceBoxAdmin\\.ServiceManager\\.Proxy\\.Locator", false, null),
@@ -475,6 +544,9 @@ public final class PropertyNames
         new Property("IceGridAdmin\\.Discovery\\.Reply\\.Locator\\.EndpointSelection", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Reply\\.Locator\\.ConnectionCached", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Reply\\.Locator\\.PreferSecure", false, null),
+        new Property("IceGridAdmin\\.Discovery\\.Reply\\.Locator\\.ParallelConnect", false, null),
+        new Property("IceGridAdmin\\.Discovery\\.Reply\\.Locator\\.ConnectionPoolSize", false, null),
+        new Property("IceGridAdmin\\.Discovery\\.Reply\\.Locator\\.Hedging", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Reply\\.Locator\\.LocatorCacheTimeout", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Reply\\.Locator\\.InvocationTimeout", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Reply\\.Locator\\.Locator", false, null),
@@ -487,6 +559,9 @@ public final class PropertyNames
         new Property("IceGridAdmin\\.Discovery\\.Reply\\.Router\\.EndpointSelection", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Reply\\.Router\\.ConnectionCached", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Reply\\.Router\\.PreferSecure", false, null),
+        new Property("IceGridAdmin\\.Discovery\\.Reply\\.Router\\.ParallelConnect", false, null),
+        new Property("IceGridAdmin\\.Discovery\\.Reply\\.Router\\.ConnectionPoolSize", false, null),
+        new Property("IceGridAdmin\\.Discovery\\.Reply\\.Router\\.Hedging", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Reply\\.Router\\.LocatorCacheTimeout", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Reply\\.Router\\.InvocationTimeout", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Reply\\.Router\\.Locator", false, null),
@@ -519,6 +594,9 @@ public final class PropertyNames
         new Property("IceGrid\\.AdminRouter\\.Locator\\.EndpointSelection", false, null),
         new Property("IceGrid\\.AdminRouter\\.Locator\\.ConnectionCached", false, null),
         new Property("IceGrid\\.AdminRouter\\.Locator\\.PreferSecure", false, null),
+        new Property("IceGrid\\.AdminRouter\\.Locator\\.ParallelConnect", false, null),
+        new Property("IceGrid\\.AdminRouter\\.Locator\\.ConnectionPoolSize", false, null),
+        new Property("IceGrid\\.AdminRouter\\.Locator\\.Hedging", false, null),
         new Property("IceGrid\\.AdminRouter\\.Locator\\.LocatorCacheTimeout", false, null),
         new Property("IceGrid\\.AdminRouter\\.Locator\\.InvocationTimeout", false, null),
         new Property("IceGrid\\.AdminRouter\\.Locator\\.Locator", false, null),
@@ -531,6 +609,9 @@ public final class PropertyNames
         new Property("IceGrid\\.AdminRouter\\.Router\\.EndpointSelection", false, null),
         new Property("IceGrid\\.AdminRouter\\.Router\\.ConnectionCached", false, null),
         new Property("IceGrid\\.AdminRouter\\.Router\\.PreferSecure", false, null),
+        new Property("IceGrid\\.AdminRouter\\.Router\\.ParallelConnect", false, null),
+        new Property("IceGrid\\.AdminRouter\\.Router\\.ConnectionPoolSize", false, null),
+        new Property("IceGrid\\.AdminRouter\\.Router\\.Hedging", false, null),
         new Property("IceGrid\\.AdminRouter\\.Router\\.LocatorCacheTimeout", false, null),
         new Property("IceGrid\\.AdminRouter\\.Router\\.InvocationTimeout", false, null),
         new Property("IceGrid\\.AdminRouter\\.Router\\.Locator", false, null),
@@ -557,6 +638,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Node\\.Locator\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Node\\.Locator\\.ConnectionCached", false, null),
         new Property("IceGrid\\.Node\\.Locator\\.PreferSecure", false, null),
+        new Property("IceGrid\\.Node\\.Locator\\.ParallelConnect", false, null),
+        new Property("IceGrid\\.Node\\.Locator\\.ConnectionPoolSize", false, null),
+        new Property("IceGrid\\.Node\\.Locator\\.Hedging", false, null),
         new Property("IceGrid\\.Node\\.Locator\\.LocatorCacheTimeout", false, null),
         new Property("IceGrid\\.Node\\.Locator\\.InvocationTimeout", false, null),
         new Property("IceGrid\\.Node\\.Locator\\.Locator", false, null),
@@ -569,6 +653,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Node\\.Router\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Node\\.Router\\.ConnectionCached", false, null),
         new Property("IceGrid\\.Node\\.Router\\.PreferSecure", false, null),
+        new Property("IceGrid\\.Node\\.Router\\.ParallelConnect", false, null),
+        new Property("IceGrid\\.Node\\.Router\\.ConnectionPoolSize", false, null),
+        new Property("IceGrid\\.Node\\.Router\\.Hedging", false, null),
         new Property("IceGrid\\.Node\\.Router\\.LocatorCacheTimeout", false, null),
         new Property("IceGrid\\.Node\\.Router\\.InvocationTimeout", false, null),
         new Property("IceGrid\\.Node\\.Router\\.Locator", false, null),
@@ -590,6 +677,7 @@ public final class PropertyNames
         new Property("IceGrid\\.Node\\.CollocateRegistry", false, null),
         new Property("IceGrid\\.Node\\.Data", false, null),
         new Property("IceGrid\\.Node\\.DisableOnFailure", false, null),
+        new Property("IceGrid\\.Node\\.MaxConcurrentActivations", false, null),
         new Property("IceGrid\\.Node\\.Name", false, null),
         new Property("IceGrid\\.Node\\.Output", false, null),
         new Property("IceGrid\\.Node\\.ProcessorSocketCount", false, null),
@@ -605,6 +693,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Node\\.UserAccountMapper\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Node\\.UserAccountMapper\\.ConnectionCached", false, null),
         new Property("IceGrid\\.Node\\.UserAccountMapper\\.PreferSecure", false, null),
+        new Property("IceGrid\\.Node\\.UserAccountMapper\\.ParallelConnect", false, null),
+        new Property("IceGrid\\.Node\\.UserAccountMapper\\.ConnectionPoolSize", false, null),
+        new Property("IceGrid\\.Node\\.UserAccountMapper\\.Hedging", false, null),
         new Property("IceGrid\\.Node\\.UserAccountMapper\\.LocatorCacheTimeout", false, null),
         new Property("IceGrid\\.Node\\.UserAccountMapper\\.InvocationTimeout", false, null),
         new Property("IceGrid\\.Node\\.UserAccountMapper\\.Locator", false, null),
@@ -617,6 +708,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.AdminPermissionsVerifier\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Registry\\.AdminPermissionsVerifier\\.ConnectionCached", false, null),
         new Property("IceGrid\\.Registry\\.AdminPermissionsVerifier\\.PreferSecure", false, null),
+        new Property("IceGrid\\.Registry\\.AdminPermissionsVerifier\\.ParallelConnect", false, null),
+        new Property("IceGrid\\.Registry\\.AdminPermissionsVerifier\\.ConnectionPoolSize", false, null),
+        new Property("IceGrid\\.Registry\\.AdminPermissionsVerifier\\.Hedging", false, null),
         new Property("IceGrid\\.Registry\\.AdminPermissionsVerifier\\.LocatorCacheTimeout", false, null),
         new Property("IceGrid\\.Registry\\.AdminPermissionsVerifier\\.InvocationTimeout", false, null),
         new Property("IceGrid\\.Registry\\.AdminPermissionsVerifier\\.Locator", false, null),
@@ -634,6 +728,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.AdminSessionManager\\.Locator\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Registry\\.AdminSessionManager\\.Locator\\.ConnectionCached", false, null),
         new Property("IceGrid\\.Registry\\.AdminSessionManager\\.Locator\\.PreferSecure", false, null),
+        new Property("IceGrid\\.Registry\\.AdminSessionManager\\.Locator\\.ParallelConnect", false, null),
+        new Property("IceGrid\\.Registry\\.AdminSessionManager\\.Locator\\.ConnectionPoolSize", false, null),
+        new Property("IceGrid\\.Registry\\.AdminSessionManager\\.Locator\\.Hedging", false, null),
         new Property("IceGrid\\.Registry\\.AdminSessionManager\\.Locator\\.LocatorCacheTimeout", false, null),
         new Property("IceGrid\\.Registry\\.AdminSessionManager\\.Locator\\.InvocationTimeout", false, null),
         new Property("IceGrid\\.Registry\\.AdminSessionManager\\.Locator\\.Locator", false, null),
@@ -646,6 +743,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.AdminSessionManager\\.Router\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Registry\\.AdminSessionManager\\.Router\\.ConnectionCached", false, null),
         new Property("IceGrid\\.Registry\\.AdminSessionManager\\.Router\\.PreferSecure", false, null),
+        new Property("IceGrid\\.Registry\\.AdminSessionManager\\.Router\\.ParallelConnect", false, null),
+        new Property("IceGrid\\.Registry\\.AdminSessionManager\\.Router\\.ConnectionPoolSize", false, null),
+        new Property("IceGrid\\.Registry\\.AdminSessionManager\\.Router\\.Hedging", false, null),
         new Property("IceGrid\\.Registry\\.AdminSessionManager\\.Router\\.LocatorCacheTimeout", false, null),
         new Property("IceGrid\\.Registry\\.AdminSessionManager\\.Router\\.InvocationTimeout", false, null),
         new Property("IceGrid\\.Registry\\.AdminSessionManager\\.Router\\.Locator", false, null),
@@ -665,6 +765,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.AdminSSLPermissionsVerifier\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Registry\\.AdminSSLPermissionsVerifier\\.ConnectionCached", false, null),
         new Property("IceGrid\\.Registry\\.AdminSSLPermissionsVerifier\\.PreferSecure", false, null),
+        new Property("IceGrid\\.Registry\\.AdminSSLPermissionsVerifier\\.ParallelConnect", false, null),
+        new Property("IceGrid\\.Registry\\.AdminSSLPermissionsVerifier\\.ConnectionPoolSize", false, null),
+        new Property("IceGrid\\.Registry\\.AdminSSLPermissionsVerifier\\.Hedging", false, null),
         new Property("IceGrid\\.Registry\\.AdminSSLPermissionsVerifier\\.LocatorCacheTimeout", false, null),
         new Property("IceGrid\\.Registry\\.AdminSSLPermissionsVerifier\\.InvocationTimeout", false, null),
         new Property("IceGrid\\.Registry\\.AdminSSLPermissionsVerifier\\.Locator", false, null),
@@ -681,6 +784,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.Client\\.Locator\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Registry\\.Client\\.Locator\\.ConnectionCached", false, null),
         new Property("IceGrid\\.Registry\\.Client\\.Locator\\.PreferSecure", false, null),
+        new Property("IceGrid\\.Registry\\.Client\\.Locator\\.ParallelConnect", false, null),
+        new Property("IceGrid\\.Registry\\.Client\\.Locator\\.ConnectionPoolSize", false, null),
+        new Property("IceGrid\\.Registry\\.Client\\.Locator\\.Hedging", false, null),
         new Property("IceGrid\\.Registry\\.Client\\.Locator\\.LocatorCacheTimeout", false, null),
         new Property("IceGrid\\.Registry\\.Client\\.Locator\\.InvocationTimeout", false, null),
         new Property("IceGrid\\.Registry\\.Client\\.Locator\\.Locator", false, null),
@@ -693,6 +799,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.Client\\.Router\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Registry\\.Client\\.Router\\.ConnectionCached", false, null),
         new Property("IceGrid\\.Registry\\.Client\\.Router\\.PreferSecure", false, null),
+        new Property("IceGrid\\.Registry\\.Client\\.Router\\.ParallelConnect", false, null),
+        new Property("IceGrid\\.Registry\\.Client\\.Router\\.ConnectionPoolSize", false, null),
+        new Property("IceGrid\\.Registry\\.Client\\.Router\\.Hedging", false, null),
         new Property("IceGrid\\.Registry\\.Client\\.Router\\.LocatorCacheTimeout", false, null),
         new Property("IceGrid\\.Registry\\.Client\\.Router\\.InvocationTimeout", false, null),
         new Property("IceGrid\\.Registry\\.Client\\.Router\\.Locator", false, null),
@@ -720,6 +829,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.Discovery\\.Locator\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Registry\\.Discovery\\.Locator\\.ConnectionCached", false, null),
         new Property("IceGrid\\.Registry\\.Discovery\\.Locator\\.PreferSecure", false, null),
+        new Property("IceGrid\\.Registry\\.Discovery\\.Locator\\.ParallelConnect", false, null),
+        new Property("IceGrid\\.Registry\\.Discovery\\.Locator\\.ConnectionPoolSize", false, null),
+        new Property("IceGrid\\.Registry\\.Discovery\\.Locator\\.Hedging", false, null),
         new Property("IceGrid\\.Registry\\.Discovery\\.Locator\\.LocatorCacheTimeout", false, null),
         new Property("IceGrid\\.Registry\\.Discovery\\.Locator\\.InvocationTimeout", false, null),
         new Property("IceGrid\\.Registry\\.Discovery\\.Locator\\.Locator", false, null),
@@ -732,6 +844,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.Discovery\\.Router\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Registry\\.Discovery\\.Router\\.ConnectionCached", false, null),
         new Property("IceGrid\\.Registry\\.Discovery\\.Router\\.PreferSecure", false, null),
+        new Property("IceGrid\\.Registry\\.Discovery\\.Router\\.ParallelConnect", false, null),
+        new Property("IceGrid\\.Registry\\.Discovery\\.Router\\.ConnectionPoolSize", false, null),
+        new Property("IceGrid\\.Registry\\.Discovery\\.Router\\.Hedging", false, null),
         new Property("IceGrid\\.Registry\\.Discovery\\.Router\\.LocatorCacheTimeout", false, null),
         new Property("IceGrid\\.Registry\\.Discovery\\.Router\\.InvocationTimeout", false, null),
         new Property("IceGrid\\.Registry\\.Discovery\\.Router\\.Locator", false, null),
@@ -762,6 +877,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.Internal\\.Locator\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Registry\\.Internal\\.Locator\\.ConnectionCached", false, null),
         new Property("IceGrid\\.Registry\\.Internal\\.Locator\\.PreferSecure", false, null),
+        new Property("IceGrid\\.Registry\\.Internal\\.Locator\\.ParallelConnect", false, null),
+        new Property("IceGrid\\.Registry\\.Internal\\.Locator\\.ConnectionPoolSize", false, null),
+        new Property("IceGrid\\.Registry\\.Internal\\.Locator\\.Hedging", false, null),
         new Property("IceGrid\\.Registry\\.Internal\\.Locator\\.LocatorCacheTimeout", false, null),
         new Property("IceGrid\\.Registry\\.Internal\\.Locator\\.InvocationTimeout", false, null),
         new Property("IceGrid\\.Registry\\.Internal\\.Locator\\.Locator", false, null),
@@ -774,6 +892,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.Internal\\.Router\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Registry\\.Internal\\.Router\\.ConnectionCached", false, null),
         new Property("IceGrid\\.Registry\\.Internal\\.Router\\.PreferSecure", false, null),
+        new Property("IceGrid\\.Registry\\.Internal\\.Router\\.ParallelConnect", false, null),
+        new Property("IceGrid\\.Registry\\.Internal\\.Router\\.ConnectionPoolSize", false, null),
+        new Property("IceGrid\\.Registry\\.Internal\\.Router\\.Hedging", false, null),
         new Property("IceGrid\\.Registry\\.Internal\\.Router\\.LocatorCacheTimeout", false, null),
         new Property("IceGrid\\.Registry\\.Internal\\.Router\\.InvocationTimeout", false, null),
         new Property("IceGrid\\.Registry\\.Internal\\.Router\\.Locator", false, null),
@@ -796,6 +917,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.PermissionsVerifier\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Registry\\.PermissionsVerifier\\.ConnectionCached", false, null),
         new Property("IceGrid\\.Registry\\.PermissionsVerifier\\.PreferSecure", false, null),
+        new Property("IceGrid\\.Registry\\.PermissionsVerifier\\.ParallelConnect", false, null),
+        new Property("IceGrid\\.Registry\\.PermissionsVerifier\\.ConnectionPoolSize", false, null),
+        new Property("IceGrid\\.Registry\\.PermissionsVerifier\\.Hedging", false, null),
         new Property("IceGrid\\.Registry\\.PermissionsVerifier\\.LocatorCacheTimeout", false, null),
         new Property("IceGrid\\.Registry\\.PermissionsVerifier\\.InvocationTimeout", false, null),
         new Property("IceGrid\\.Registry\\.PermissionsVerifier\\.Locator", false, null),
@@ -816,6 +940,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.Server\\.Locator\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Registry\\.Server\\.Locator\\.ConnectionCached", false, null),
         new Property("IceGrid\\.Registry\\.Server\\.Locator\\.PreferSecure", false, null),
+        new Property("IceGrid\\.Registry\\.Server\\.Locator\\.ParallelConnect", false, null),
+        new Property("IceGrid\\.Registry\\.Server\\.Locator\\.ConnectionPoolSize", false, null),
+        new Property("IceGrid\\.Registry\\.Server\\.Locator\\.Hedging", false, null),
         new Property("IceGrid\\.Registry\\.Server\\.Locator\\.LocatorCacheTimeout", false, null),
         new Property("IceGrid\\.Registry\\.Server\\.Locator\\.InvocationTimeout", false, null),
         new Property("IceGrid\\.Registry\\.Server\\.Locator\\.Locator", false, null),
@@ -828,6 +955,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.Server\\.Router\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Registry\\.Server\\.Router\\.ConnectionCached", false, null),
         new Property("IceGrid\\.Registry\\.Server\\.Router\\.PreferSecure", false, null),
+        new Property("IceGrid\\.Registry\\.Server\\.Router\\.ParallelConnect", false, null),
+        new Property("IceGrid\\.Registry\\.Server\\.Router\\.ConnectionPoolSize", false, null),
+        new Property("IceGrid\\.Registry\\.Server\\.Router\\.Hedging", false, null),
         new Property("IceGrid\\.Registry\\.Server\\.Router\\.LocatorCacheTimeout", false, null),
         new Property("IceGrid\\.Registry\\.Server\\.Router\\.InvocationTimeout", false, null),
         new Property("IceGrid\\.Registry\\.Server\\.Router\\.Locator", false, null),
@@ -854,6 +984,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.SessionManager\\.Locator\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Registry\\.SessionManager\\.Locator\\.ConnectionCached", false, null),
         new Property("IceGrid\\.Registry\\.SessionManager\\.Locator\\.PreferSecure", false, null),
+        new Property("IceGrid\\.Registry\\.SessionManager\\.Locator\\.ParallelConnect", false, null),
+        new Property("IceGrid\\.Registry\\.SessionManager\\.Locator\\.ConnectionPoolSize", false, null),
+        new Property("IceGrid\\.Registry\\.SessionManager\\.Locator\\.Hedging", false, null),
         new Property("IceGrid\\.Registry\\.SessionManager\\.Locator\\.LocatorCacheTimeout", false, null),
         new Property("IceGrid\\.Registry\\.SessionManager\\.Locator\\.InvocationTimeout", false, null),
         new Property("IceGrid\\.Registry\\.SessionManager\\.Locator\\.Locator", false, null),
@@ -866,6 +999,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.SessionManager\\.Router\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Registry\\.SessionManager\\.Router\\.ConnectionCached", false, null),
         new Property("IceGrid\\.Registry\\.SessionManager\\.Router\\.PreferSecure", false, null),
+        new Property("IceGrid\\.Registry\\.SessionManager\\.Router\\.ParallelConnect", false, null),
+        new Property("IceGrid\\.Registry\\.SessionManager\\.Router\\.ConnectionPoolSize", false, null),
+        new Property("IceGrid\\.Registry\\.SessionManager\\.Router\\.Hedging", false, null),
         new Property("IceGrid\\.Registry\\.SessionManager\\.Router\\.LocatorCacheTimeout", false, null),
         new Property("IceGrid\\.Registry\\.SessionManager\\.Router\\.InvocationTimeout", false, null),
         new Property("IceGrid\\.Registry\\.SessionManager\\.Router\\.Locator", false, null),
@@ -886,6 +1022,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.SSLPermissionsVerifier\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Registry\\.SSLPermissionsVerifier\\.ConnectionCached", false, null),
         new Property("IceGrid\\.Registry\\.SSLPermissionsVerifier\\.PreferSecure", false, null),
+        new Property("IceGrid\\.Registry\\.SSLPermissionsVerifier\\.ParallelConnect", false, null),
+        new Property("IceGrid\\.Registry\\.SSLPermissionsVerifier\\.ConnectionPoolSize", false, null),
+        new Property("IceGrid\\.Registry\\.SSLPermissionsVerifier\\.Hedging", false, null),
         new Property("IceGrid\\.Registry\\.SSLPermissionsVerifier\\.LocatorCacheTimeout", false, null),
         new Property("IceGrid\\.Registry\\.SSLPermissionsVerifier\\.InvocationTimeout", false, null),
         new Property("IceGrid\\.Registry\\.SSLPermissionsVerifier\\.Locator", false, null),
@@ -905,6 +1044,7 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.Trace\\.Subscriber", false, null),
         new Property("IceGrid\\.Registry\\.Trace\\.Topic", false, null),
         new Property("IceGrid\\.Registry\\.Trace\\.TopicManager", false, null),
+        new Property("IceGrid\\.Registry\\.UpdateLogSize", false, null),
         new Property("IceGrid\\.Registry\\.UserAccounts", false, null),
         null
     };
@@ -920,6 +1060,9 @@ public final class PropertyNames
         new Property("IcePatch2\\.Locator\\.EndpointSelection", false, null),
         new Property("IcePatch2\\.Locator\\.ConnectionCached", false, null),
         new Property("IcePatch2\\.Locator\\.PreferSecure", false, null),
+        new Property("IcePatch2\\.Locator\\.ParallelConnect", false, null),
+        new Property("IcePatch2\\.Locator\\.ConnectionPoolSize", false, null),
+        new Property("IcePatch2\\.Locator\\.Hedging", false, null),
         new Property("IcePatch2\\.Locator\\.LocatorCacheTimeout", false, null),
         new Property("IcePatch2\\.Locator\\.InvocationTimeout", false, null),
         new Property("IcePatch2\\.Locator\\.Locator", false, null),
@@ -932,6 +1075,9 @@ public final class PropertyNames
         new Property("IcePatch2\\.Router\\.EndpointSelection", false, null),
         new Property("IcePatch2\\.Router\\.ConnectionCached", false, null),
         new Property("IcePatch2\\.Router\\.PreferSecure", false, null),
+        new Property("IcePatch2\\.Router\\.ParallelConnect", false, null),
+        new Property("IcePatch2\\.Router\\.ConnectionPoolSize", false, null),
+        new Property("IcePatch2\\.Router\\.Hedging", false, null),
         new Property("IcePatch2\\.Router\\.LocatorCacheTimeout", false, null),
         new Property("IcePatch2\\.Router\\.InvocationTimeout", false, null),
         new Property("IcePatch2\\.Router\\.Locator", false, null),
@@ -950,12 +1096,16 @@ public final class PropertyNames
         new Property("IcePatch2\\.MessageSizeMax", false, null),
         new Property("IcePatch2\\.Directory", false, null),
         new Property("IcePatch2\\.InstanceName", false, null),
+        new Property("IcePatch2\\.MaxOpenFiles", false, null),
         null
     };
 
     public static final Property IcePatch2ClientProps[] = 
     {
         new Property("IcePatch2Client\\.ChunkSize", false, null),
+        new Property("IcePatch2Client\\.ChunkWindow", false, null),
+        new Property("IcePatch2Client\\.DecompressThreads", false, null),
+        new Property("IcePatch2Client\\.DeltaMinSize", false, null),
         new Property("IcePatch2Client\\.Directory", false, null),
         new Property("IcePatch2Client\\.Proxy", false, null),
         new Property("IcePatch2Client\\.Remove", false, null),
@@ -1037,6 +1187,9 @@ public final class PropertyNames
         new Property("Glacier2\\.Client\\.Locator\\.EndpointSelection", false, null),
         new Property("Glacier2\\.Client\\.Locator\\.ConnectionCached", false, null),
         new Property("Glacier2\\.Client\\.Locator\\.PreferSecure", false, null),
+        new Property("Glacier2\\.Client\\.Locator\\.ParallelConnect", false, null),
+        new Property("Glacier2\\.Client\\.Locator\\.ConnectionPoolSize", false, null),
+        new Property("Glacier2\\.Client\\.Locator\\.Hedging", false, null),
         new Property("Glacier2\\.Client\\.Locator\\.LocatorCacheTimeout", false, null),
         new Property("Glacier2\\.Client\\.Locator\\.InvocationTimeout", false, null),
         new Property("Glacier2\\.Client\\.Locator\\.Locator", false, null),
@@ -1049,6 +1202,9 @@ public final class PropertyNames
         new Property("Glacier2\\.Client\\.Router\\.EndpointSelection", false, null),
         new Property("Glacier2\\.Client\\.Router\\.ConnectionCached", false, null),
         new Property("Glacier2\\.Client\\.Router\\.PreferSecure", false, null),
+        new Property("Glacier2\\.Client\\.Router\\.ParallelConnect", false, null),
+        new Property("Glacier2\\.Client\\.Router\\.ConnectionPoolSize", false, null),
+        new Property("Glacier2\\.Client\\.Router\\.Hedging", false, null),
         new Property("Glacier2\\.Client\\.Router\\.LocatorCacheTimeout", false, null),
         new Property("Glacier2\\.Client\\.Router\\.InvocationTimeout", false, null),
         new Property("Glacier2\\.Client\\.Router\\.Locator", false, null),
@@ -1084,6 +1240,9 @@ public final class PropertyNames
         new Property("Glacier2\\.PermissionsVerifier\\.EndpointSelection", false, null),
         new Property("Glacier2\\.PermissionsVerifier\\.ConnectionCached", false, null),
         new Property("Glacier2\\.PermissionsVerifier\\.PreferSecure", false, null),
+        new Property("Glacier2\\.PermissionsVerifier\\.ParallelConnect", false, null),
+        new Property("Glacier2\\.PermissionsVerifier\\.ConnectionPoolSize", false, null),
+        new Property("Glacier2\\.PermissionsVerifier\\.Hedging", false, null),
         new Property("Glacier2\\.PermissionsVerifier\\.LocatorCacheTimeout", false, null),
         new Property("Glacier2\\.PermissionsVerifier\\.InvocationTimeout", false, null),
         new Property("Glacier2\\.PermissionsVerifier\\.Locator", false, null),
@@ -1095,6 +1254,9 @@ public final class PropertyNames
         new Property("Glacier2\\.SSLPermissionsVerifier\\.EndpointSelection", false, null),
         new Property("Glacier2\\.SSLPermissionsVerifier\\.ConnectionCached", false, null),
         new Property("Glacier2\\.SSLPermissionsVerifier\\.PreferSecure", false, null),
+        new Property("Glacier2\\.SSLPermissionsVerifier\\.ParallelConnect", false, null),
+        new Property("Glacier2\\.SSLPermissionsVerifier\\.ConnectionPoolSize", false, null),
+        new Property("Glacier2\\.SSLPermissionsVerifier\\.Hedging", false, null),
         new Property("Glacier2\\.SSLPermissionsVerifier\\.LocatorCacheTimeout", false, null),
         new Property("Glacier2\\.SSLPermissionsVerifier\\.InvocationTimeout", false, null),
         new Property("Glacier2\\.SSLPermissionsVerifier\\.Locator", false, null),
@@ -1112,6 +1274,9 @@ public final class PropertyNames
         new Property("Glacier2\\.Server\\.Locator\\.EndpointSelection", false, null),
         new Property("Glacier2\\.Server\\.Locator\\.ConnectionCached", false, null),
         new Property("Glacier2\\.Server\\.Locator\\.PreferSecure", false, null),
+        new Property("Glacier2\\.Server\\.Locator\\.ParallelConnect", false, null),
+        new Property("Glacier2\\.Server\\.Locator\\.ConnectionPoolSize", false, null),
+        new Property("Glacier2\\.Server\\.Locator\\.Hedging", false, null),
         new Property("Glacier2\\.Server\\.Locator\\.LocatorCacheTimeout", false, null),
         new Property("Glacier2\\.Server\\.Locator\\.InvocationTimeout", false, null),
         new Property("Glacier2\\.Server\\.Locator\\.Locator", false, null),
@@ -1124,6 +1289,9 @@ public final class PropertyNames
         new Property("Glacier2\\.Server\\.Router\\.EndpointSelection", false, null),
         new Property("Glacier2\\.Server\\.Router\\.ConnectionCached", false, null),
         new Property("Glacier2\\.Server\\.Router\\.PreferSecure", false, null),
+        new Property("Glacier2\\.Server\\.Router\\.ParallelConnect", false, null),
+        new Property("Glacier2\\.Server\\.Router\\.ConnectionPoolSize", false, null),
+        new Property("Glacier2\\.Server\\.Router\\.Hedging", false, null),
         new Property("Glacier2\\.Server\\.Router\\.LocatorCacheTimeout", false, null),
         new Property("Glacier2\\.Server\\.Router\\.InvocationTimeout", false, null),
         new Property("Glacier2\\.Server\\.Router\\.Locator", false, null),
@@ -1149,6 +1317,9 @@ public final class PropertyNames
         new Property("Glacier2\\.SessionManager\\.EndpointSelection", false, null),
         new Property("Glacier2\\.SessionManager\\.ConnectionCached", false, null),
         new Property("Glacier2\\.SessionManager\\.PreferSecure", false, null),
+        new Property("Glacier2\\.SessionManager\\.ParallelConnect", false, null),
+        new Property("Glacier2\\.SessionManager\\.ConnectionPoolSize", false, null),
+        new Property("Glacier2\\.SessionManager\\.Hedging", false, null),
         new Property("Glacier2\\.SessionManager\\.LocatorCacheTimeout", false, null),
         new Property("Glacier2\\.SessionManager\\.InvocationTimeout", false, null),
         new Property("Glacier2\\.SessionManager\\.Locator", false, null),
@@ -1159,6 +1330,9 @@ public final class PropertyNames
         new Property("Glacier2\\.SSLSessionManager\\.EndpointSelection", false, null),
         new Property("Glacier2\\.SSLSessionManager\\.ConnectionCached", false, null),
         new Property("Glacier2\\.SSLSessionManager\\.PreferSecure", false, null),
+        new Property("Glacier2\\.SSLSessionManager\\.ParallelConnect", false, null),
+        new Property("Glacier2\\.SSLSessionManager\\.ConnectionPoolSize", false, null),
+        new Property("Glacier2\\.SSLSessionManager\\.Hedging", false, null),
         new Property("Glacier2\\.SSLSessionManager\\.LocatorCacheTimeout", false, null),
         new Property("Glacier2\\.SSLSessionManager\\.InvocationTimeout", false, null),
         new Property("Glacier2\\.SSLSessionManager\\.Locator", false, null),
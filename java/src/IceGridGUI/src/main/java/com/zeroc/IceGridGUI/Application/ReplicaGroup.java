@@ -205,6 +205,12 @@ class ReplicaGroup extends TreeNode
                 {
                     attributes.add(createAttribute("type", "round-robin"));
                 }
+                else if(_descriptor.loadBalancing instanceof PowerOfTwoLoadBalancingPolicy)
+                {
+                    attributes.add(createAttribute("type", "power-of-two"));
+                    PowerOfTwoLoadBalancingPolicy policy = (PowerOfTwoLoadBalancingPolicy)_descriptor.loadBalancing;
+                    attributes.add(createAttribute("load-sample", policy.loadSample));
+                }
                 else if(_descriptor.loadBalancing instanceof AdaptiveLoadBalancingPolicy)
                 {
                     attributes.add(createAttribute("type", "adaptive"));
@@ -185,8 +185,8 @@ class ReplicaGroupEditor extends Editor
                         updated();
 
                         Object item = e.getItem();
-                        _loadSampleLabel.setVisible(item == ADAPTIVE);
-                        _loadSample.setVisible(item == ADAPTIVE);
+                        _loadSampleLabel.setVisible(item == ADAPTIVE || item == POWER_OF_TWO);
+                        _loadSample.setVisible(item == ADAPTIVE || item == POWER_OF_TWO);
                     }
                 }
             });
@@ -249,6 +249,11 @@ class ReplicaGroupEditor extends Editor
             descriptor.loadBalancing = new AdaptiveLoadBalancingPolicy(
                 _nReplicas.getText().trim(), _loadSample.getSelectedItem().toString().trim());
         }
+        else if(loadBalancing == POWER_OF_TWO)
+        {
+            descriptor.loadBalancing = new PowerOfTwoLoadBalancingPolicy(
+                _nReplicas.getText().trim(), _loadSample.getSelectedItem().toString().trim());
+        }
         else
         {
             assert false;
@@ -389,6 +394,14 @@ class ReplicaGroupEditor extends Editor
             _nReplicas.setText(Utils.substitute(descriptor.loadBalancing.nReplicas, resolver));
             _loadSample.setSelectedItem("1");
         }
+        else if(descriptor.loadBalancing instanceof PowerOfTwoLoadBalancingPolicy)
+        {
+            _loadBalancing.setSelectedItem(POWER_OF_TWO);
+            _nReplicas.setText(Utils.substitute(descriptor.loadBalancing.nReplicas, resolver));
+
+            _loadSample.setSelectedItem(
+                Utils.substitute(((PowerOfTwoLoadBalancingPolicy)descriptor.loadBalancing).loadSample, resolver));
+        }
         else if(descriptor.loadBalancing instanceof AdaptiveLoadBalancingPolicy)
         {
             _loadBalancing.setSelectedItem(ADAPTIVE);
@@ -469,6 +482,7 @@ class ReplicaGroupEditor extends Editor
     static private String RANDOM = "Random";
     static private String ROUND_ROBIN = "Round-robin";
     static private String ADAPTIVE = "Adaptive";
+    static private String POWER_OF_TWO = "Power of two choices";
 
     private JTextField _id = new JTextField(20);
     private JTextArea _description = new JTextArea(3, 20);
@@ -477,6 +491,7 @@ class ReplicaGroupEditor extends Editor
 
     private JComboBox _loadBalancing = new JComboBox(new String[] {ADAPTIVE, 
                                                                    ORDERED, 
+                                                                   POWER_OF_TWO,
                                                                    RANDOM, 
                                                                    ROUND_ROBIN});
 
@@ -40,6 +40,9 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Admin\.Locator\.EndpointSelection/", false, null),
     new Property("/^Ice\.Admin\.Locator\.ConnectionCached/", false, null),
     new Property("/^Ice\.Admin\.Locator\.PreferSecure/", false, null),
+    new Property("/^Ice\.Admin\.Locator\.ParallelConnect/", false, null),
+    new Property("/^Ice\.Admin\.Locator\.ConnectionPoolSize/", false, null),
+    new Property("/^Ice\.Admin\.Locator\.Hedging/", false, null),
     new Property("/^Ice\.Admin\.Locator\.LocatorCacheTimeout/", false, null),
     new Property("/^Ice\.Admin\.Locator\.InvocationTimeout/", false, null),
     new Property("/^Ice\.Admin\.Locator\.Locator/", false, null),
@@ -52,6 +55,9 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Admin\.Router\.EndpointSelection/", false, null),
     new Property("/^Ice\.Admin\.Router\.ConnectionCached/", false, null),
     new Property("/^Ice\.Admin\.Router\.PreferSecure/", false, null),
+    new Property("/^Ice\.Admin\.Router\.ParallelConnect/", false, null),
+    new Property("/^Ice\.Admin\.Router\.ConnectionPoolSize/", false, null),
+    new Property("/^Ice\.Admin\.Router\.Hedging/", false, null),
     new Property("/^Ice\.Admin\.Router\.LocatorCacheTimeout/", false, null),
     new Property("/^Ice\.Admin\.Router\.InvocationTimeout/", false, null),
     new Property("/^Ice\.Admin\.Router\.Locator/", false, null),
@@ -82,9 +88,13 @@ PropertyNames.IceProps =
     new Property("/^Ice\.ChangeUser/", false, null),
     new Property("/^Ice\.ClientAccessPolicyProtocol/", false, null),
     new Property("/^Ice\.Compression\.Level/", false, null),
+    new Property("/^Ice\.Compression\.ParallelUncompressSize/", false, null),
     new Property("/^Ice\.CollectObjects/", false, null),
     new Property("/^Ice\.Config/", false, null),
     new Property("/^Ice\.ConsoleListener/", false, null),
+    new Property("/^Ice\.ConnectionPool\.GrowThreshold/", false, null),
+    new Property("/^Ice\.ConnectionPool\.IdleTimeout/", false, null),
+    new Property("/^Ice\.ConnectionPool\.Striping/", false, null),
     new Property("/^Ice\.Default\.CollocationOptimized/", false, null),
     new Property("/^Ice\.Default\.EncodingVersion/", false, null),
     new Property("/^Ice\.Default\.EndpointSelection/", false, null),
@@ -92,6 +102,9 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Default\.Locator\.EndpointSelection/", false, null),
     new Property("/^Ice\.Default\.Locator\.ConnectionCached/", false, null),
     new Property("/^Ice\.Default\.Locator\.PreferSecure/", false, null),
+    new Property("/^Ice\.Default\.Locator\.ParallelConnect/", false, null),
+    new Property("/^Ice\.Default\.Locator\.ConnectionPoolSize/", false, null),
+    new Property("/^Ice\.Default\.Locator\.Hedging/", false, null),
     new Property("/^Ice\.Default\.Locator\.LocatorCacheTimeout/", false, null),
     new Property("/^Ice\.Default\.Locator\.InvocationTimeout/", false, null),
     new Property("/^Ice\.Default\.Locator\.Locator/", false, null),
@@ -103,10 +116,16 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Default\.InvocationTimeout/", false, null),
     new Property("/^Ice\.Default\.Package/", false, null),
     new Property("/^Ice\.Default\.PreferSecure/", false, null),
+    new Property("/^Ice\.Default\.ParallelConnect/", false, null),
+    new Property("/^Ice\.Default\.ConnectionPoolSize/", false, null),
+    new Property("/^Ice\.Default\.Hedging/", false, null),
     new Property("/^Ice\.Default\.Protocol/", false, null),
     new Property("/^Ice\.Default\.Router\.EndpointSelection/", false, null),
     new Property("/^Ice\.Default\.Router\.ConnectionCached/", false, null),
     new Property("/^Ice\.Default\.Router\.PreferSecure/", false, null),
+    new Property("/^Ice\.Default\.Router\.ParallelConnect/", false, null),
+    new Property("/^Ice\.Default\.Router\.ConnectionPoolSize/", false, null),
+    new Property("/^Ice\.Default\.Router\.Hedging/", false, null),
     new Property("/^Ice\.Default\.Router\.LocatorCacheTimeout/", false, null),
     new Property("/^Ice\.Default\.Router\.InvocationTimeout/", false, null),
     new Property("/^Ice\.Default\.Router\.Locator/", false, null),
@@ -117,14 +136,26 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Default\.SlicedFormat/", false, null),
     new Property("/^Ice\.Default\.SourceAddress/", false, null),
     new Property("/^Ice\.Default\.Timeout/", false, null),
+    new Property("/^Ice\.EndpointHealth\.EjectionTime/", false, null),
+    new Property("/^Ice\.EndpointHealth\.FailureThreshold/", false, null),
+    new Property("/^Ice\.EndpointHealth\.LatencyThreshold/", false, null),
+    new Property("/^Ice\.EndpointHealth\.MaxEjectionTime/", false, null),
     new Property("/^Ice\.EventLog\.Source/", false, null),
     new Property("/^Ice\.FactoryAssemblies/", false, null),
     new Property("/^Ice\.HTTPProxyHost/", false, null),
     new Property("/^Ice\.HTTPProxyPort/", false, null),
+    new Property("/^Ice\.Hedging\.Budget/", false, null),
+    new Property("/^Ice\.Hedging\.MinDelay/", false, null),
+    new Property("/^Ice\.Hedging\.Percentile/", false, null),
+    new Property("/^Ice\.HostResolver\.CacheTimeout/", false, null),
+    new Property("/^Ice\.HostResolver\.NegativeCacheTimeout/", false, null),
+    new Property("/^Ice\.HostResolver\.SizeMax/", false, null),
     new Property("/^Ice\.ImplicitContext/", false, null),
     new Property("/^Ice\.InitPlugins/", false, null),
     new Property("/^Ice\.IPv4/", false, null),
     new Property("/^Ice\.IPv6/", false, null),
+    new Property("/^Ice\.LocatorCacheJitter/", false, null),
+    new Property("/^Ice\.LocatorCacheRefreshAhead/", false, null),
     new Property("/^Ice\.LogFile/", false, null),
     new Property("/^Ice\.LogFile\.SizeMax/", false, null),
     new Property("/^Ice\.LogStdErr\.Convert/", false, null),
@@ -137,6 +168,7 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Override\.Timeout/", false, null),
     new Property("/^Ice\.Override\.Secure/", false, null),
     new Property("/^Ice\.Package\../", false, null),
+    new Property("/^Ice\.ParallelConnectDelay/", false, null),
     new Property("/^Ice\.Plugin\../", false, null),
     new Property("/^Ice\.PluginLoadOrder/", false, null),
     new Property("/^Ice\.PreferIPv6Address/", false, null),